@@ -1117,6 +1117,115 @@ void C2_MacroAssembler::stringL_indexof_char(Register str1, Register cnt1,
   BIND(DONE);
 }
 
+// Compute the polynomial hash code of ary[0..cnt), continuing from the
+// initial value in result:
+//   result = 31^^cnt * result + 31^^(cnt-1) * ary[0] + ... + ary[cnt-1]
+// The main loop handles four elements per iteration. Their contribution is
+// summed up off the critical path, so that result only sees one maddw per
+// iteration.
+void C2_MacroAssembler::arrays_hashcode(Register ary, Register cnt, Register result,
+                                        Register tmp1, Register tmp2, Register tmp3,
+                                        Register tmp4, Register tmp5, Register tmp6,
+                                        BasicType eltype) {
+  assert_different_registers(ary, cnt, result, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6,
+                             rscratch1, rscratch2);
+
+  const int elsize = arrays_hashcode_elsize(eltype);
+  const int chunks_end_shift = exact_log2(elsize);
+
+  switch (eltype) {
+  case T_BOOLEAN: BLOCK_COMMENT("arrays_hashcode(unsigned byte) {"); break;
+  case T_CHAR:    BLOCK_COMMENT("arrays_hashcode(char) {");          break;
+  case T_BYTE:    BLOCK_COMMENT("arrays_hashcode(byte) {");          break;
+  case T_SHORT:   BLOCK_COMMENT("arrays_hashcode(short) {");         break;
+  case T_INT:     BLOCK_COMMENT("arrays_hashcode(int) {");           break;
+  default:
+    ShouldNotReachHere();
+  }
+
+  const int stride = 4;
+  const Register pow31_4 = tmp1;
+  const Register pow31_3 = tmp2;
+  const Register pow31_2 = tmp3;
+  const Register chunks_end = tmp4;
+  const Register el0 = tmp5;
+  const Register el1 = tmp6;
+  const Register el2 = rscratch1;
+  const Register el3 = rscratch2;
+
+  Label DONE, TAIL, TAIL_LOOP, WIDE_LOOP;
+
+  // result has a value initially
+
+  cbzw(cnt, DONE);
+
+  andw(chunks_end, cnt, ~(stride - 1));
+  cbzw(chunks_end, TAIL);
+
+  movw(pow31_4, 923521);                        // [31^^4]
+  movw(pow31_3,  29791);                        // [31^^3]
+  movw(pow31_2,    961);                        // [31^^2]
+
+  add(chunks_end, ary, chunks_end, LSL, chunks_end_shift);
+  andw(cnt, cnt, stride - 1);                   // don't forget about tail!
+
+  bind(WIDE_LOOP);
+  arrays_hashcode_elload(el0, Address(ary, 0 * elsize), eltype);
+  arrays_hashcode_elload(el1, Address(ary, 1 * elsize), eltype);
+  arrays_hashcode_elload(el2, Address(ary, 2 * elsize), eltype);
+  arrays_hashcode_elload(el3, Address(ary, 3 * elsize), eltype);
+  add(ary, ary, elsize * stride);
+  mulw(el0, el0, pow31_3);                      // 31^^3 * ary[i+0]
+  maddw(el0, el1, pow31_2, el0);                // + 31^^2 * ary[i+1]
+  addw(el0, el0, el2, LSL, 5);                  // + 31^^1 * ary[i+2]
+  subw(el0, el0, el2);                          //   as (ary[i+2] << 5) - ary[i+2]
+  addw(el0, el0, el3);                          // + 31^^0 * ary[i+3]
+  maddw(result, result, pow31_4, el0);          // 31^^4 * h + the above
+  cmp(ary, chunks_end);
+  br(Assembler::NE, WIDE_LOOP);
+  cbzw(cnt, DONE);
+
+  bind(TAIL);
+  add(chunks_end, ary, cnt, ext::uxtw, chunks_end_shift);
+
+  bind(TAIL_LOOP);
+  arrays_hashcode_elload(el0, Address(post(ary, elsize)), eltype);
+  lslw(el1, result, 5);                         // optimize 31 * result
+  subw(result, el1, result);                    // with result<<5 - result
+  addw(result, result, el0);
+  cmp(ary, chunks_end);
+  br(Assembler::NE, TAIL_LOOP);
+
+  bind(DONE);
+  BLOCK_COMMENT("} // arrays_hashcode");
+}
+
+int C2_MacroAssembler::arrays_hashcode_elsize(BasicType eltype) {
+  switch (eltype) {
+  case T_BOOLEAN: return sizeof(jboolean);
+  case T_BYTE:    return sizeof(jbyte);
+  case T_SHORT:   return sizeof(jshort);
+  case T_CHAR:    return sizeof(jchar);
+  case T_INT:     return sizeof(jint);
+  default:
+    ShouldNotReachHere();
+    return -1;
+  }
+}
+
+void C2_MacroAssembler::arrays_hashcode_elload(Register dst, Address src, BasicType eltype) {
+  switch (eltype) {
+  // T_BOOLEAN used as surrogate for unsigned byte
+  case T_BOOLEAN: ldrb(dst, src);   break;
+  case T_BYTE:    ldrsbw(dst, src); break;
+  case T_SHORT:   ldrshw(dst, src); break;
+  case T_CHAR:    ldrh(dst, src);   break;
+  case T_INT:     ldrw(dst, src);   break;
+  default:
+    ShouldNotReachHere();
+  }
+}
+
 // Compare strings.
 void C2_MacroAssembler::string_compare(Register str1, Register str2,
     Register cnt1, Register cnt2, Register result, Register tmp1, Register tmp2,
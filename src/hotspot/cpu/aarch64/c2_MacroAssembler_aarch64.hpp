@@ -59,6 +59,16 @@
                            Register ch, Register result,
                            Register tmp1, Register tmp2, Register tmp3);
 
+  void arrays_hashcode(Register ary, Register cnt, Register result,
+                       Register tmp1, Register tmp2,
+                       Register tmp3, Register tmp4,
+                       Register tmp5, Register tmp6,
+                       BasicType eltype);
+
+  // helper function for arrays_hashcode
+  int arrays_hashcode_elsize(BasicType eltype);
+  void arrays_hashcode_elload(Register dst, Address src, BasicType eltype);
+
   void stringL_indexof_char(Register str1, Register cnt1,
                             Register ch, Register result,
                             Register tmp1, Register tmp2, Register tmp3);
@@ -1265,8 +1265,11 @@ void LIRGenerator::do_If(If* x) {
     __ safepoint(LIR_OprFact::illegalOpr, state_for(x, x->state_before()));
   }
 
+  bool profiled = profile_branch_sampled(x, cond, left, right);
   __ cmp(lir_cond(cond), left, right);
-  profile_branch(x, cond);
+  if (!profiled) {
+    profile_branch(x, cond);
+  }
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), x->tsux(), x->usux());
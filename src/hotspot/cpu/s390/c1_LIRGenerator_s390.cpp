@@ -1003,9 +1003,12 @@ void LIRGenerator::do_If (If* x) {
     __ safepoint(safepoint_poll_register(), state_for (x, x->state_before()));
   }
 
+  bool profiled = profile_branch_sampled(x, cond, left, right);
   __ cmp(lir_cond(cond), left, right);
   // Generate branch profiling. Profiling code doesn't kill flags.
-  profile_branch(x, cond);
+  if (!profiled) {
+    profile_branch(x, cond);
+  }
   move_to_phi(x->state());
   if (x->x()->type()->is_float_kind()) {
     __ branch(lir_cond(cond), x->tsux(), x->usux());
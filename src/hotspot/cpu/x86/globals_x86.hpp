@@ -188,6 +188,13 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              range(0, max_jint)                                             \
              constraint(AVX3ThresholdConstraintFunc,AfterErgo)              \
                                                                             \
+  product(int, AVX3NonTemporalCopyThreshold, 2621440, EXPERIMENTAL,         \
+             "Minimum array size in bytes for which AVX512 disjoint "       \
+             "arraycopy uses non-temporal stores, so that very large "      \
+             "copies do not evict the caches. Only used with "              \
+             "MaxVectorSize=64.")                                           \
+             range(4096, max_jint)                                          \
+                                                                            \
   product(bool, IntelJccErratumMitigation, true, DIAGNOSTIC,                \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")                       \
@@ -517,7 +517,7 @@ address StubGenerator::generate_disjoint_copy_avx3_masked(address* entry, const
 
   int avx3threshold = VM_Version::avx3_threshold();
   bool use64byteVector = (MaxVectorSize > 32) && (avx3threshold == 0);
-  const int large_threshold = 2621440; // 2.5 MB
+  const int large_threshold = AVX3NonTemporalCopyThreshold; // 2.5 MB by default
   Label L_main_loop, L_main_loop_64bytes, L_tail, L_tail64, L_exit, L_entry;
   Label L_repmovs, L_main_pre_loop, L_main_pre_loop_64bytes, L_pre_main_post_64;
   Label L_copy_large, L_finish;
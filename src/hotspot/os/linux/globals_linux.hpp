@@ -52,6 +52,12 @@
   product(bool, UseContainerSupport, true,                              \
           "Enable detection and runtime container configuration support") \
                                                                         \
+  product(uintx, ContainerMetricsCacheTimeout, 20, EXPERIMENTAL,        \
+          "Time in milliseconds for which the container memory limit "  \
+          "and active processor count are cached before cgroupfs is "   \
+          "read again. 0 re-reads on every query.")                     \
+          range(0, max_jint)                                            \
+                                                                        \
   product(bool, AdjustStackSizeForTLS, false,                           \
           "Increase the thread stack size to include space for glibc "  \
           "static thread-local storage (TLS) if true")                  \
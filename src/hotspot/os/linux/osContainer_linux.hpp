@@ -32,8 +32,9 @@
 
 #define OSCONTAINER_ERROR (-2)
 
-// 20ms timeout between re-reads of memory limit and _active_processor_count.
-#define OSCONTAINER_CACHE_TIMEOUT (NANOSECS_PER_SEC/50)
+// Timeout between re-reads of memory limit and _active_processor_count,
+// 20ms by default.
+#define OSCONTAINER_CACHE_TIMEOUT ((jlong)ContainerMetricsCacheTimeout * NANOSECS_PER_MILLISEC)
 
 class OSContainer: AllStatic {
 
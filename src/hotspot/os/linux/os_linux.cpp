@@ -5130,21 +5130,24 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   pid_t  tid = thread->osthread()->thread_id();
   char *s;
   char stat[2048];
-  size_t statlen;
+  ssize_t statlen;
   char proc_name[64];
   int count;
   long sys_time, user_time;
   char cdummy;
   int idummy;
   long ldummy;
-  FILE *fp;
 
+  // Read the file with a single read(2) rather than through stdio. This is
+  // called once per thread by ThreadMXBean.getThreadUserTime(long[]), and
+  // the stdio buffer allocation and locking dominate for many threads.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = os::fopen(proc_name, "r");
-  if (fp == nullptr) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  int fd = os::open(proc_name, O_RDONLY, 0);
+  if (fd == -1) return -1;
+  statlen = ::read(fd, stat, sizeof(stat) - 1);
+  ::close(fd);
+  if (statlen <= 0) return -1;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
@@ -5510,6 +5513,21 @@ bool os::trim_native_heap(os::size_change_t* rss_change) {
 #endif
 }
 
+size_t os::trimmable_native_heap_size() {
+#ifdef __GLIBC__
+  os::Linux::glibc_mallinfo mi;
+  bool might_have_wrapped = false;
+  os::Linux::get_mallinfo(&mi, &might_have_wrapped);
+  if (might_have_wrapped) {
+    return SIZE_MAX;
+  }
+  // Free chunks in the arenas, including the releasable top-most chunk.
+  return mi.fordblks;
+#else
+  return SIZE_MAX; // musl
+#endif
+}
+
 bool os::pd_dll_unload(void* libhandle, char* ebuf, int ebuflen) {
 
   if (ebuf && ebuflen > 0) {
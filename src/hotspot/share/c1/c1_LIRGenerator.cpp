@@ -922,22 +922,29 @@ LIR_Opr LIRGenerator::force_to_spill(LIR_Opr value, BasicType t) {
   return tmp;
 }
 
+void LIRGenerator::branch_profile_offsets(If* if_instr, ciMethodData** md, int* taken_count_offset, int* not_taken_count_offset) {
+  ciMethod* method = if_instr->profiled_method();
+  assert(method != nullptr, "method should be set if branch is profiled");
+  *md = method->method_data_or_null();
+  assert(*md != nullptr, "Sanity");
+  ciProfileData* data = (*md)->bci_to_data(if_instr->profiled_bci());
+  assert(data != nullptr, "must have profiling data");
+  assert(data->is_BranchData(), "need BranchData for two-way branches");
+  *taken_count_offset     = (*md)->byte_offset_of_slot(data, BranchData::taken_offset());
+  *not_taken_count_offset = (*md)->byte_offset_of_slot(data, BranchData::not_taken_offset());
+  if (if_instr->is_swapped()) {
+    int t = *taken_count_offset;
+    *taken_count_offset = *not_taken_count_offset;
+    *not_taken_count_offset = t;
+  }
+}
+
 void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
   if (if_instr->should_profile()) {
-    ciMethod* method = if_instr->profiled_method();
-    assert(method != nullptr, "method should be set if branch is profiled");
-    ciMethodData* md = method->method_data_or_null();
-    assert(md != nullptr, "Sanity");
-    ciProfileData* data = md->bci_to_data(if_instr->profiled_bci());
-    assert(data != nullptr, "must have profiling data");
-    assert(data->is_BranchData(), "need BranchData for two-way branches");
-    int taken_count_offset     = md->byte_offset_of_slot(data, BranchData::taken_offset());
-    int not_taken_count_offset = md->byte_offset_of_slot(data, BranchData::not_taken_offset());
-    if (if_instr->is_swapped()) {
-      int t = taken_count_offset;
-      taken_count_offset = not_taken_count_offset;
-      not_taken_count_offset = t;
-    }
+    ciMethodData* md;
+    int taken_count_offset;
+    int not_taken_count_offset;
+    branch_profile_offsets(if_instr, &md, &taken_count_offset, &not_taken_count_offset);
 
     LIR_Opr md_reg = new_register(T_METADATA);
     __ metadata2reg(md->constant_encoding(), md_reg);
@@ -959,6 +966,58 @@ void LIRGenerator::profile_branch(If* if_instr, If::Condition cond) {
   }
 }
 
+// Sampled branch profiling: with C1BranchProfileSampleRate > 1 only every
+// Nth profiled branch executed by a thread updates its counter, by N. This
+// needs a compare of its own and must be emitted before the compare of the
+// branch. Returns true if it did, and profile_branch must not be called.
+bool LIRGenerator::profile_branch_sampled(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right) {
+  if (C1BranchProfileSampleRate == 1 || !if_instr->should_profile()) {
+    return false;
+  }
+  ciMethodData* md;
+  int taken_count_offset;
+  int not_taken_count_offset;
+  branch_profile_offsets(if_instr, &md, &taken_count_offset, &not_taken_count_offset);
+
+  // Select the counter before the sampling check, so that left and right
+  // are not used inside the skipped code.
+  LIR_Opr md_reg = new_register(T_METADATA);
+  __ metadata2reg(md->constant_encoding(), md_reg);
+  LIR_Opr data_offset_reg = new_pointer_register();
+  if (left->type() == T_LONG) {
+    // long compares destroy the left operand on 32-bit platforms
+    LIR_Opr tmp = new_register(T_LONG);
+    __ move(left, tmp);
+    left = tmp;
+  }
+  __ cmp(lir_cond(cond), left, right);
+  __ cmove(lir_cond(cond),
+           LIR_OprFact::intptrConst(taken_count_offset),
+           LIR_OprFact::intptrConst(not_taken_count_offset),
+           data_offset_reg, as_BasicType(if_instr->x()->type()));
+
+  LIR_Address* countdown_addr = new LIR_Address(getThreadPointer(), in_bytes(JavaThread::profile_sample_countdown_offset()), T_INT);
+  LIR_Opr countdown = new_register(T_INT);
+  __ load(countdown_addr, countdown);
+  __ add(countdown, LIR_OprFact::intConst(-1), countdown);
+  __ store(countdown, countdown_addr);
+  LabelObj* L_skip = new LabelObj();
+  __ cmp(lir_cond_greater, countdown, LIR_OprFact::intConst(0));
+  __ branch(lir_cond_greater, L_skip->label());
+
+  LIR_Opr reset = load_immediate(C1BranchProfileSampleRate, T_INT);
+  __ store(reset, countdown_addr);
+  LIR_Opr data_reg = new_pointer_register();
+  LIR_Address* data_addr = new LIR_Address(md_reg, data_offset_reg, data_reg->type());
+  __ move(data_addr, data_reg);
+  LIR_Address* fake_incr_value = new LIR_Address(data_reg, DataLayout::counter_increment * C1BranchProfileSampleRate, T_INT);
+  __ leal(LIR_OprFact::address(fake_incr_value), data_reg);
+  __ move(data_reg, data_addr);
+
+  __ branch_destination(L_skip->label());
+  return true;
+}
+
 // Phi technique:
 // This is about passing live values from one basic block to the other.
 // In code generated with Java it is rather rare that more than one
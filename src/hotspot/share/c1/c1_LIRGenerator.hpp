@@ -400,7 +400,9 @@ class LIRGenerator: public InstructionVisitor, public BlockClosure {
 
   LIR_Opr safepoint_poll_register();
 
+  void branch_profile_offsets(If* if_instr, ciMethodData** md, int* taken_count_offset, int* not_taken_count_offset);
   void profile_branch(If* if_instr, If::Condition cond);
+  bool profile_branch_sampled(If* if_instr, If::Condition cond, LIR_Opr left, LIR_Opr right);
   void increment_event_counter_impl(CodeEmitInfo* info,
                                     ciMethod *method, LIR_Opr step, int frequency,
                                     int bci, bool backedge, bool notify);
@@ -5574,6 +5574,29 @@ bool LinearScanWalker::alloc_free_reg(Interval* cur) {
 }
 
 
+// loop depth of the block containing use_pos (0 if there is no further use)
+int LinearScanWalker::use_loop_depth(int use_pos) const {
+  if (use_pos > allocator()->max_lir_op_id()) {
+    return 0;
+  }
+  return block_of_op_with_id(use_pos)->loop_depth();
+}
+
+// The intervals of the register chosen for spilling must be reloaded at
+// their next use. Normally the register with the farthest next use is
+// taken. With LinearScanLoopSpillCost, a use in a less deeply nested loop
+// is preferred even if it is nearer, because the reload executes less often.
+bool LinearScanWalker::is_better_spill_candidate(int use_pos, int max_use_pos) const {
+  if (LinearScanLoopSpillCost) {
+    int depth = use_loop_depth(use_pos);
+    int max_depth = use_loop_depth(max_use_pos);
+    if (depth != max_depth) {
+      return depth < max_depth;
+    }
+  }
+  return use_pos > max_use_pos;
+}
+
 int LinearScanWalker::find_locked_reg(int reg_needed_until, int interval_to, int ignore_reg, bool* need_split) {
   int max_reg = any_reg;
 
@@ -5582,7 +5605,7 @@ int LinearScanWalker::find_locked_reg(int reg_needed_until, int interval_to, int
       // this register must be ignored
 
     } else if (_use_pos[i] > reg_needed_until) {
-      if (max_reg == any_reg || _use_pos[i] > _use_pos[max_reg]) {
+      if (max_reg == any_reg || is_better_spill_candidate(_use_pos[i], _use_pos[max_reg])) {
         max_reg = i;
       }
     }
@@ -5602,7 +5625,7 @@ int LinearScanWalker::find_locked_double_reg(int reg_needed_until, int interval_
 
   for (int i = _first_reg; i < _last_reg; i+=2) {
     if (_use_pos[i] > reg_needed_until && _use_pos[i + 1] > reg_needed_until) {
-      if (max_reg == any_reg || _use_pos[i] > _use_pos[max_reg]) {
+      if (max_reg == any_reg || is_better_spill_candidate(_use_pos[i], _use_pos[max_reg])) {
         max_reg = i;
       }
     }
@@ -769,6 +769,8 @@ class LinearScanWalker : public IntervalWalker {
   int  find_free_double_reg(int reg_needed_until, int interval_to, int hint_reg, bool* need_split);
   bool alloc_free_reg(Interval* cur);
 
+  int  use_loop_depth(int use_pos) const;
+  bool is_better_spill_candidate(int use_pos, int max_use_pos) const;
   int  find_locked_reg(int reg_needed_until, int interval_to, int ignore_reg, bool* need_split);
   int  find_locked_double_reg(int reg_needed_until, int interval_to, bool* need_split);
   void split_and_spill_intersecting_intervals(int reg, int regHi);
@@ -202,6 +202,10 @@
   develop_pd(bool, CSEArrayLength,                                          \
           "Create separate nodes for length in array accesses")             \
                                                                             \
+  product(bool, LinearScanLoopSpillCost, false, EXPERIMENTAL,               \
+          "When a register must be freed for spilling, prefer the "         \
+          "register whose next use is in the least deeply nested loop")     \
+                                                                            \
   develop(intx, TraceLinearScanLevel, 0,                                    \
           "Debug levels for the linear scan allocator")                     \
           range(0, 4)                                                       \
@@ -305,6 +309,11 @@
   product(bool, C1ProfileBranches, true,                                    \
           "Profile branches when generating code for updating MDOs")        \
                                                                             \
+  product(int, C1BranchProfileSampleRate, 1, EXPERIMENTAL,                  \
+          "Update the branch profile of tier 3 code only on every Nth "     \
+          "profiled branch executed by a thread, counting it N times")      \
+          range(1, 1024)                                                    \
+                                                                            \
   product(bool, C1ProfileCheckcasts, true,                                  \
           "Profile checkcasts when generating code for updating MDOs")      \
                                                                             \
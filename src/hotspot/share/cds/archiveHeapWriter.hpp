@@ -112,6 +112,13 @@ class ArchiveHeapWriter : AllStatic {
 public:
   static const intptr_t NOCOOPS_REQUESTED_BASE = 0x10000000;
 
+  // The minimum region size of all collectors that are supported by CDS in
+  // ArchiveHeapLoader::can_map() mode. Currently only G1 is supported. G1's region size
+  // depends on -Xmx, but can never be smaller than 1 * M.
+  // Shenandoah uses ArchiveHeapLoader::can_load() mode instead, and does not load
+  // archived objects that span multiple regions smaller than this.
+  static constexpr int MIN_GC_REGION_ALIGNMENT = 1 * M;
+
 private:
   class EmbeddedOopRelocator;
   struct NativePointerInfo {
@@ -119,12 +126,6 @@ class ArchiveHeapWriter : AllStatic {
     int _field_offset;
   };
 
-  // The minimum region size of all collectors that are supported by CDS in
-  // ArchiveHeapLoader::can_map() mode. Currently only G1 is supported. G1's region size
-  // depends on -Xmx, but can never be smaller than 1 * M.
-  // (TODO: Perhaps change to 256K to be compatible with Shenandoah)
-  static constexpr int MIN_GC_REGION_ALIGNMENT = 1 * M;
-
   static GrowableArrayCHeap<u1, mtClassShared>* _buffer;
 
   // The number of bytes that have written into _buffer (may be smaller than _buffer->length()).
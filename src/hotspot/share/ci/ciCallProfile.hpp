@@ -39,11 +39,12 @@ class ciCallProfile : StackObj {
   friend class ciMethodHandle;
 
   enum { MorphismLimit = 2 }; // Max call site's morphism we care about
+  enum { ReceiverLimit = 8 }; // Max receivers kept, the maximum TypeProfileWidth
   int  _limit;                // number of receivers have been determined
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
-  int  _receiver_count[MorphismLimit + 1]; // # times receivers have been seen
-  ciKlass*  _receiver[MorphismLimit + 1];  // receivers (exact)
+  int  _receiver_count[ReceiverLimit + 1]; // # times receivers have been seen
+  ciKlass*  _receiver[ReceiverLimit + 1];  // receivers (exact)
 
   ciCallProfile() {
     _limit = 0;
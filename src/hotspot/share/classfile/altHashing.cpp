@@ -50,6 +50,8 @@
 #include "oops/markWord.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/os.hpp"
+#include "utilities/byteswap.hpp"
+#include "utilities/bytes.hpp"
 
 // Get the hash code of the classes mirror if it exists, otherwise just
 // return a random number, which is one of the possible hash code used for
@@ -151,11 +153,10 @@ uint32_t AltHashing::halfsiphash_32(uint64_t seed, const void* in, int len) {
   // body
   while (count >= 4) {
 
-    // Avoid sign extension with 0x0ff
-    newdata = (data[off] & 0x0FF)
-        | (data[off + 1] & 0x0FF) << 8
-        | (data[off + 2] & 0x0FF) << 16
-        | data[off + 3] << 24;
+    // Load the next four bytes as one little-endian word, which is what
+    // assembling them byte by byte would produce on any platform.
+    newdata = Bytes::get_native_u4(const_cast<address>(data + off));
+    BIG_ENDIAN_ONLY(newdata = byteswap(newdata);)
 
     count -= 4;
     off += 4;
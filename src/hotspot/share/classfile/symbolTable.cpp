@@ -507,27 +507,12 @@ Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, boo
   Symbol* tmp = ::new ((void*)u1_buf) Symbol((const u1*)name, len,
                                              (is_permanent || CDSConfig::is_dumping_static_archive()) ? PERM_REFCOUNT : 1);
 
-  do {
-    if (_local_table->insert(current, lookup, *tmp, &rehash_warning, &clean_hint)) {
-      if (_local_table->get(current, lookup, stg, &rehash_warning)) {
-        sym = stg.get_res_sym();
-        // The get adds one to ref count, but we inserted with our ref already included.
-        // Therefore decrement with one.
-        if (sym->refcount() != PERM_REFCOUNT) {
-          sym->decrement_refcount();
-        }
-        break;
-      }
-    }
-
-    // In case another thread did a concurrent add, return value already in the table.
-    // This could fail if the symbol got deleted concurrently, so loop back until success.
-    if (_local_table->get(current, lookup, stg, &rehash_warning)) {
-      // The lookup added a refcount, which is ours.
-      sym = stg.get_res_sym();
-      break;
-    }
-  } while(true);
+  // Insert and fetch the resulting symbol in a single table operation. If
+  // another thread added the symbol concurrently, the lookup found it and added
+  // a refcount, which is ours. Otherwise our symbol was inserted with our ref
+  // already included. Dead symbols never match, so this cannot fail.
+  _local_table->insert_get(current, lookup, *tmp, stg, &rehash_warning, &clean_hint);
+  sym = stg.get_res_sym();
 
   update_needs_rehash(rehash_warning);
 
@@ -326,6 +326,17 @@ void CodeCache::initialize_heaps() {
   size_t offset = 0;
   if (profiled.enabled) {
     ReservedSpace profiled_space = rs.partition(offset, profiled.size);
+    // Keep the short-lived profiled code on small pages, so the large pages
+    // go to stubs and the C2 code. Pinned large pages cannot be split.
+    if (SmallPagesForProfiledCodeHeap && UseLargePages && ps > os::vm_page_size()) {
+      if (rs.special()) {
+        log_warning(codecache)("SmallPagesForProfiledCodeHeap is ignored for pinned large pages");
+      } else {
+        profiled_space = ReservedSpace::space_for_range(profiled_space.base(), profiled_space.size(),
+                                                        profiled_space.alignment(), os::vm_page_size(),
+                                                        false, profiled_space.executable());
+      }
+    }
     offset += profiled.size;
     // Tier 2 and tier 3 (profiled) methods
     add_heap(profiled_space, "CodeHeap 'profiled nmethods'", CodeBlobType::MethodProfiled);
@@ -1358,15 +1369,18 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method
   }
 }
 
-void CodeCache::make_marked_nmethods_deoptimized() {
+int CodeCache::make_marked_nmethods_deoptimized() {
+  int count = 0;
   RelaxedNMethodIterator iter(RelaxedNMethodIterator::not_unloading);
   while(iter.next()) {
     nmethod* nm = iter.method();
     if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() && nm->can_be_deoptimized()) {
       nm->make_not_entrant();
       nm->make_deoptimized();
+      count++;
     }
   }
+  return count;
 }
 
 // Marks compiled methods dependent on dependee.
@@ -1819,6 +1833,41 @@ void CodeCache::write_perf_map(const char* filename) {
 }
 #endif // LINUX
 
+// Write a compile command file that makes the methods compiled at the
+// highest tier reach their compile thresholds early in the next run.
+void CodeCache::write_hot_methods(const char* filename) {
+  MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+
+  fileStream fs(filename, "w");
+  if (!fs.is_open()) {
+    log_warning(codecache)("Failed to create %s for hot methods", filename);
+    return;
+  }
+
+  fs.print_cr("quiet");
+  int count = 0;
+  NMethodIterator iter(NMethodIterator::not_unloading);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    Method* m = nm->method();
+    if (nm->comp_level() != CompLevel_full_optimization || m->method_holder()->is_hidden()) {
+      continue;
+    }
+    if (nm->is_osr_method() && m->code() != nullptr && m->code()->comp_level() == CompLevel_full_optimization) {
+      // written for the normal nmethod of the method
+      continue;
+    }
+    ResourceMark rm;
+    fs.print_cr("CompileThresholdScaling,%s.%s%s,%f",
+                m->method_holder()->name()->as_C_string(),
+                m->name()->as_C_string(),
+                m->signature()->as_C_string(),
+                HotMethodsThresholdScaling);
+    count++;
+  }
+  log_info(codecache)("Wrote %d hot methods to %s", count, filename);
+}
+
 //---<  BEGIN  >--- CodeHeap State Analytics.
 
 void CodeCache::aggregate(outputStream *out, size_t granularity) {
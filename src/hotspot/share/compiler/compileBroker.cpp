@@ -445,6 +445,7 @@ CompileTask* CompileQueue::get(CompilerThread* thread) {
     save_method = methodHandle(thread, task->method());
     save_hot_method = methodHandle(thread, task->hot_method());
 
+    Atomic::store(&_last_wait, os::elapsed_counter() - task->time_queued());
     remove(task);
   }
   purge_stale_tasks(); // may temporarily release MCQ lock
@@ -1031,12 +1032,23 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   // Only do attempt to start additional threads if the lock is free.
   if (!CompileThread_lock->try_lock()) return;
 
+  // Threads of both compilers share the processor budget.
+  int cpu_limit = INT_MAX;
+  if (CompilerThreadsCPUPercent > 0) {
+    cpu_limit = MAX2(2, (int)(os::active_processor_count() * CompilerThreadsCPUPercent / 100));
+  }
+
   if (_c2_compile_queue != nullptr) {
     int old_c2_count = _compilers[1]->num_compiler_threads();
+    int c1_count = (_compilers[0] != nullptr) ? _compilers[0]->num_compiler_threads() : 0;
     int new_c2_count = MIN4(_c2_count,
         _c2_compile_queue->size() / 2,
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
+    new_c2_count = MIN2(new_c2_count, cpu_limit - c1_count);
+    if (_c2_compile_queue->last_wait_millis() < (jlong)CompilerThreadQueueWaitMillis) {
+      new_c2_count = old_c2_count;
+    }
 
     for (int i = old_c2_count; i < new_c2_count; i++) {
 #if INCLUDE_JVMCI
@@ -1094,10 +1106,15 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   if (_c1_compile_queue != nullptr) {
     int old_c1_count = _compilers[0]->num_compiler_threads();
+    int c2_count = (_compilers[1] != nullptr) ? _compilers[1]->num_compiler_threads() : 0;
     int new_c1_count = MIN4(_c1_count,
         _c1_compile_queue->size() / 4,
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
+    new_c1_count = MIN2(new_c1_count, cpu_limit - c2_count);
+    if (_c1_compile_queue->last_wait_millis() < (jlong)CompilerThreadQueueWaitMillis) {
+      new_c1_count = old_c1_count;
+    }
 
     for (int i = old_c1_count; i < new_c1_count; i++) {
       JavaThread *ct = make_thread(compiler_t, compiler1_object(i), _c1_compile_queue, _compilers[0], THREAD);
@@ -2116,6 +2133,10 @@ void CompileBroker::handle_compile_error(CompilerThread* thread, CompileTask* ta
 
 static void post_compilation_event(EventCompilation& event, CompileTask* task) {
   assert(task != nullptr, "invariant");
+  jlong queue_nanos = 0;
+  if (task->time_started() != 0) {
+    queue_nanos = (jlong)(TimeHelper::counter_to_seconds(task->time_started() - task->time_queued()) * NANOSECS_PER_SEC);
+  }
   CompilerEvent::CompilationEvent::post(event,
                                         task->compile_id(),
                                         task->compiler()->type(),
@@ -2125,7 +2146,8 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         task->nm_total_size(),
                                         task->num_inlined_bytecodes(),
-                                        task->arena_bytes());
+                                        task->arena_bytes(),
+                                        queue_nanos);
 }
 
 int DirectivesStack::_depth = 0;
@@ -32,6 +32,7 @@
 #include "compiler/compilerThread.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/perfDataTypes.hpp"
+#include "runtime/timer.hpp"
 #include "utilities/stack.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmciCompiler.hpp"
@@ -92,6 +93,8 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   uint _total_added;
   uint _total_removed;
 
+  volatile jlong _last_wait; // queue time of the last task taken, in elapsed counter ticks
+
   void purge_stale_tasks();
  public:
   CompileQueue(const char* name) {
@@ -103,6 +106,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _total_removed = 0;
     _peak_size = 0;
     _first_stale = nullptr;
+    _last_wait = 0;
   }
 
   const char*  name() const                      { return _name; }
@@ -121,6 +125,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   int         get_peak_size()     const          { return _peak_size; }
   uint        get_total_added()   const          { return _total_added; }
   uint        get_total_removed() const          { return _total_removed; }
+  jlong       last_wait_millis() const           { return (jlong)TimeHelper::counter_to_millis(Atomic::load(&_last_wait)); }
 
   // Redefine Classes support
   void mark_on_stack();
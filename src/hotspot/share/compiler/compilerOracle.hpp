@@ -90,6 +90,9 @@ NOT_PRODUCT(option(TraceAutoVectorization, "TraceAutoVectorization", Ccstrlist))
   option(CloneMapDebug, "CloneMapDebug", Bool) \
   option(IncrementalInlineForceCleanup, "IncrementalInlineForceCleanup", Bool) \
   option(MaxNodeLimit, "MaxNodeLimit", Intx)  \
+  option(MaxInlineSize, "MaxInlineSize", Intx) \
+  option(FreqInlineSize, "FreqInlineSize", Intx) \
+  option(LoopUnrollLimit, "LoopUnrollLimit", Intx) \
 NOT_PRODUCT(option(TestOptionInt,    "TestOptionInt",    Intx)) \
 NOT_PRODUCT(option(TestOptionUint,   "TestOptionUint",   Uintx)) \
 NOT_PRODUCT(option(TestOptionBool,   "TestOptionBool",   Bool)) \
@@ -304,6 +304,16 @@
   product(ccstrlist, CompileCommand, "",                                    \
           "Prepend to .hotspot_compiler; e.g. log,java/lang/String.<init>") \
                                                                             \
+  product(ccstr, HotMethodsFile, nullptr, EXPERIMENTAL,                     \
+          "At exit, write a compile command file to this file that lowers " \
+          "the compile thresholds of all methods compiled at the highest "  \
+          "tier, for use with CompileCommandFile in later runs")            \
+                                                                            \
+  product(double, HotMethodsThresholdScaling, 0.01, EXPERIMENTAL,           \
+          "CompileThresholdScaling written for each method to "             \
+          "HotMethodsFile")                                                 \
+          range(0.001, 1.0)                                                 \
+                                                                            \
   product(bool, ReplayCompiles, false, DIAGNOSTIC,                          \
           "Enable replay of compilations from ReplayDataFile")              \
                                                                             \
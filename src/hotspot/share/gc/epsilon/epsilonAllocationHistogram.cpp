@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/epsilon/epsilonAllocationHistogram.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/method.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/vframe.inline.hpp"
+#include "utilities/growableArray.hpp"
+
+// Number of hottest allocation sites to print at exit
+static const int MaxPrintedSites = 20;
+
+EpsilonAllocationHistogram::EpsilonAllocationHistogram(size_t sample_rate) :
+  _lock(Mutex::nosafepoint, "EpsilonAllocationHistogram_lock"),
+  _table(),
+  _sample_rate(sample_rate),
+  _refills(0),
+  _unattributed_bytes(0) {
+  assert(sample_rate > 0, "Sample rate should be positive");
+}
+
+void EpsilonAllocationHistogram::record_refill(Thread* thread, size_t size_in_bytes) {
+  size_t refill = Atomic::add(&_refills, (size_t)1);
+  if (refill % _sample_rate != 0) {
+    return;
+  }
+
+  // Find the Java frame that caused the refill. Walk the stack outside of
+  // the lock, it is only this thread that is touching it.
+  Site site = { nullptr, 0 };
+  if (thread->is_Java_thread()) {
+    JavaThread* jt = JavaThread::cast(thread);
+    if (jt->has_last_Java_frame()) {
+      vframeStream vfst(jt, false /* stop_at_java_call_stub */, false /* process_frames */);
+      if (!vfst.at_end()) {
+        site._method = vfst.method();
+        site._bci = vfst.bci();
+      }
+    }
+  }
+
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+  if (site._method == nullptr) {
+    _unattributed_bytes += size_in_bytes;
+    return;
+  }
+
+  bool created = false;
+  Entry* e = _table.put_if_absent(site, &created);
+  if (created) {
+    e->_site = site;
+    e->_samples = 0;
+    e->_bytes = 0;
+  }
+  e->_samples++;
+  e->_bytes += size_in_bytes;
+}
+
+int EpsilonAllocationHistogram::compare_by_bytes(Entry* a, Entry* b) {
+  if (a->_bytes > b->_bytes) return -1;
+  if (a->_bytes < b->_bytes) return 1;
+  return 0;
+}
+
+void EpsilonAllocationHistogram::print() {
+  LogTarget(Info, gc, alloc) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+
+  ResourceMark rm;
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+
+  GrowableArray<Entry> entries(_table.number_of_entries());
+  size_t total_bytes = _unattributed_bytes;
+  _table.iterate_all([&](const Site& site, const Entry& e) {
+    entries.append(e);
+    total_bytes += e._bytes;
+  });
+  entries.sort(compare_by_bytes);
+
+  // Every sample stands for _sample_rate refills; scale the sampled TLAB
+  // sizes back to estimate the bytes allocated from each site.
+  LogStream ls(lt);
+  ls.print_cr("Allocation sites (" SIZE_FORMAT " TLAB refills, 1 in " SIZE_FORMAT " sampled, "
+              "estimated " SIZE_FORMAT "%s attributed):",
+              Atomic::load(&_refills), _sample_rate,
+              byte_size_in_proper_unit(total_bytes * _sample_rate),
+              proper_unit_for_byte_size(total_bytes * _sample_rate));
+  for (int i = 0; i < MIN2(entries.length(), MaxPrintedSites); i++) {
+    const Entry& e = entries.at(i);
+    size_t bytes = e._bytes * _sample_rate;
+    ls.print_cr("  " SIZE_FORMAT_W(8) "%s (%5.1f%%) " SIZE_FORMAT_W(6) " samples  %s @ bci %d",
+                byte_size_in_proper_unit(bytes), proper_unit_for_byte_size(bytes),
+                percent_of(e._bytes, total_bytes),
+                e._samples,
+                e._site._method->external_name(), e._site._bci);
+  }
+  if (_unattributed_bytes > 0) {
+    size_t bytes = _unattributed_bytes * _sample_rate;
+    ls.print_cr("  " SIZE_FORMAT_W(8) "%s (%5.1f%%) without Java frames",
+                byte_size_in_proper_unit(bytes), proper_unit_for_byte_size(bytes),
+                percent_of(_unattributed_bytes, total_bytes));
+  }
+}
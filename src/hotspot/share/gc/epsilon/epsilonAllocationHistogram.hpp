@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_GC_EPSILON_EPSILONALLOCATIONHISTOGRAM_HPP
+#define SHARE_GC_EPSILON_EPSILONALLOCATIONHISTOGRAM_HPP
+
+#include "memory/allocation.hpp"
+#include "runtime/mutex.hpp"
+#include "utilities/resourceHash.hpp"
+
+class Method;
+class Thread;
+
+// Samples TLAB refills and attributes the sampled TLAB sizes to the Java
+// allocation site (method and bci) that caused the refill. Since Epsilon
+// never unloads classes, the recorded Method* stay valid until VM exit,
+// when the histogram is printed.
+class EpsilonAllocationHistogram : public CHeapObj<mtGC> {
+private:
+  struct Site {
+    const Method* _method;
+    int _bci;
+
+    static unsigned hash(const Site& s) {
+      return primitive_hash(s._method) ^ (unsigned) s._bci;
+    }
+    static bool equals(const Site& a, const Site& b) {
+      return a._method == b._method && a._bci == b._bci;
+    }
+  };
+
+  struct Entry {
+    Site _site;
+    size_t _samples;
+    size_t _bytes;
+  };
+
+  typedef ResourceHashtable<Site, Entry, 1009, AnyObj::C_HEAP, mtGC,
+                            Site::hash, Site::equals> SiteTable;
+
+  Mutex _lock;
+  SiteTable _table;
+  const size_t _sample_rate;
+  volatile size_t _refills;
+  size_t _unattributed_bytes;
+
+  static int compare_by_bytes(Entry* a, Entry* b);
+
+public:
+  EpsilonAllocationHistogram(size_t sample_rate);
+
+  // Called on every TLAB refill, samples every _sample_rate-th of them.
+  void record_refill(Thread* thread, size_t size_in_bytes);
+
+  void print();
+};
+
+#endif // SHARE_GC_EPSILON_EPSILONALLOCATIONHISTOGRAM_HPP
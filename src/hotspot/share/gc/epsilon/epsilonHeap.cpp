@@ -38,6 +38,8 @@
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -61,11 +63,21 @@ jint EpsilonHeap::initialize() {
   _step_heap_print = (EpsilonPrintHeapSteps == 0) ? SIZE_MAX : (max_byte_size / EpsilonPrintHeapSteps);
   _decay_time_ns = (int64_t) EpsilonTLABDecayTime * NANOSECS_PER_MILLISEC;
 
+  // Commit-ahead expands in large pages when they can be committed on demand,
+  // so that transparent huge pages back the allocation space.
+  _commit_granule = (UseLargePages && os::can_commit_large_page_memory()) ?
+                    os::large_page_size() : os::vm_page_size();
+
   // Enable monitoring
   _monitoring_support = new EpsilonMonitoringSupport(this);
   _last_counter_update = 0;
   _last_heap_print = 0;
 
+  // Enable allocation site sampling
+  if (EpsilonAllocationSiteSampleRate > 0) {
+    _allocation_histogram = new EpsilonAllocationHistogram(EpsilonAllocationSiteSampleRate);
+  }
+
   // Install barrier set
   BarrierSet::set_barrier_set(new EpsilonBarrierSet());
 
@@ -128,30 +140,34 @@ HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
       size_t uncommitted_space = max_capacity() - capacity();
       size_t unused_space = max_capacity() - used();
       size_t want_space = MAX2(size_in_bytes, EpsilonMinHeapExpand);
+      if (EpsilonCommitAhead > 0) {
+        want_space = align_up(want_space, _commit_granule);
+      }
       assert(unused_space >= uncommitted_space,
              "Unused (" SIZE_FORMAT ") >= uncommitted (" SIZE_FORMAT ")",
              unused_space, uncommitted_space);
 
       if (want_space < uncommitted_space) {
         // Enough space to expand in bulk:
-        bool expand = _virtual_space.expand_by(want_space);
-        assert(expand, "Should be able to expand");
+        expand_space(want_space);
       } else if (size_in_bytes < unused_space) {
         // No space to expand in bulk, and this allocation is still possible,
         // take all the remaining space:
-        bool expand = _virtual_space.expand_by(uncommitted_space);
-        assert(expand, "Should be able to expand");
+        expand_space(uncommitted_space);
       } else {
         // No space left:
         return nullptr;
       }
-
-      _space->set_end((HeapWord *) _virtual_space.high());
     }
   }
 
   size_t used = _space->used();
 
+  // Expand ahead of allocations, if the committed headroom is getting low
+  if (EpsilonCommitAhead > 0 && capacity() - used < EpsilonCommitAhead) {
+    commit_ahead();
+  }
+
   // Allocation successful, update counters
   if (verbose) {
     size_t last = _last_counter_update;
@@ -173,6 +189,39 @@ HeapWord* EpsilonHeap::allocate_work(size_t size, bool verbose) {
   return res;
 }
 
+void EpsilonHeap::expand_space(size_t bytes) {
+  assert_lock_strong(Heap_lock);
+
+  char* old_high = _virtual_space.high();
+  bool expand = _virtual_space.expand_by(bytes);
+  assert(expand, "Should be able to expand");
+
+  // Pre-touch the committed memory before publishing it, so that
+  // allocating threads do not fault on it.
+  if (EpsilonCommitAhead > 0) {
+    os::pretouch_memory(old_high, _virtual_space.high(), _commit_granule);
+  }
+
+  _space->set_end((HeapWord *) _virtual_space.high());
+}
+
+void EpsilonHeap::commit_ahead() {
+  // Opportunistic: if another thread holds the lock, it is either expanding
+  // already, or will see the low headroom on its next allocation.
+  if (!Heap_lock->try_lock()) {
+    return;
+  }
+
+  size_t headroom = capacity() - used();
+  size_t uncommitted_space = max_capacity() - capacity();
+  if (headroom < EpsilonCommitAhead && uncommitted_space > 0) {
+    size_t want_space = align_up(MAX2(EpsilonCommitAhead - headroom, EpsilonMinHeapExpand), _commit_granule);
+    expand_space(MIN2(want_space, uncommitted_space));
+  }
+
+  Heap_lock->unlock();
+}
+
 HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
                                          size_t requested_size,
                                          size_t* actual_size) {
@@ -244,6 +293,9 @@ HeapWord* EpsilonHeap::allocate_new_tlab(size_t min_size,
   if (res != nullptr) {
     // Allocation successful
     *actual_size = size;
+    if (_allocation_histogram != nullptr) {
+      _allocation_histogram->record_refill(thread, size * HeapWordSize);
+    }
     if (EpsilonElasticTLABDecay) {
       EpsilonThreadLocalData::set_last_tlab_time(thread, time);
     }
@@ -318,6 +370,9 @@ bool EpsilonHeap::print_location(outputStream* st, void* addr) const {
 void EpsilonHeap::print_tracing_info() const {
   print_heap_info(used());
   print_metaspace_info();
+  if (_allocation_histogram != nullptr) {
+    _allocation_histogram->print();
+  }
 }
 
 void EpsilonHeap::print_heap_info(size_t used) const {
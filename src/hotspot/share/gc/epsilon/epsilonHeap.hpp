@@ -26,6 +26,7 @@
 #ifndef SHARE_GC_EPSILON_EPSILONHEAP_HPP
 #define SHARE_GC_EPSILON_EPSILONHEAP_HPP
 
+#include "gc/epsilon/epsilonAllocationHistogram.hpp"
 #include "gc/epsilon/epsilonBarrierSet.hpp"
 #include "gc/epsilon/epsilonMonitoringSupport.hpp"
 #include "gc/shared/collectedHeap.hpp"
@@ -38,11 +39,13 @@ class EpsilonHeap : public CollectedHeap {
   friend class VMStructs;
 private:
   EpsilonMonitoringSupport* _monitoring_support;
+  EpsilonAllocationHistogram* _allocation_histogram;
   MemoryPool* _pool;
   GCMemoryManager _memory_manager;
   ContiguousSpace* _space;
   VirtualSpace _virtual_space;
   size_t _max_tlab_size;
+  size_t _commit_granule;
   size_t _step_counter_update;
   size_t _step_heap_print;
   int64_t _decay_time_ns;
@@ -53,6 +56,7 @@ class EpsilonHeap : public CollectedHeap {
   static EpsilonHeap* heap();
 
   EpsilonHeap() :
+          _allocation_histogram(nullptr),
           _memory_manager("Epsilon Heap"),
           _space(nullptr) {};
 
@@ -136,6 +140,9 @@ class EpsilonHeap : public CollectedHeap {
   bool print_location(outputStream* st, void* addr) const override;
 
 private:
+  void expand_space(size_t bytes);
+  void commit_ahead();
+
   void print_heap_info(size_t used) const;
   void print_metaspace_info() const;
 
@@ -57,6 +57,14 @@ void EpsilonInitLogger::print_gc_specific() {
   } else {
     log_info(gc, init)("TLAB: Disabled");
   }
+
+  if (EpsilonCommitAhead > 0) {
+    log_info(gc, init)("Commit Ahead: " SIZE_FORMAT "%s",
+                       byte_size_in_exact_unit(EpsilonCommitAhead), exact_unit_for_byte_size(EpsilonCommitAhead));
+  }
+  if (EpsilonAllocationSiteSampleRate > 0) {
+    log_info(gc, init)("Allocation Site Sampling: 1 in " SIZE_FORMAT " TLAB refills", EpsilonAllocationSiteSampleRate);
+  }
 }
 
 void EpsilonInitLogger::print() {
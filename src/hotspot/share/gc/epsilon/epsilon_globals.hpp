@@ -85,7 +85,22 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(size_t, EpsilonCommitAhead, 0, EXPERIMENTAL,                      \
+          "Keep at least this much memory committed and pre-touched ahead " \
+          "of the allocation top. The expansion is attempted before the "   \
+          "allocation space runs out, so that allocating threads do not "   \
+          "take page faults on fresh memory. Expansions are aligned to "    \
+          "the large page size when transparent huge pages are in use. "    \
+          "0 disables commit-ahead.")                                       \
+          range(0, max_intx)                                                \
+                                                                            \
+  product(size_t, EpsilonAllocationSiteSampleRate, 0, EXPERIMENTAL,         \
+          "Sample every Nth TLAB refill and attribute it to the Java "      \
+          "method and bci that caused it. The resulting histogram is "      \
+          "printed at exit with -Xlog:gc+alloc. 0 disables sampling.")      \
+          range(0, max_intx)
 
 // end of GC_EPSILON_FLAGS
 
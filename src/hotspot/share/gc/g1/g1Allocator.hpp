@@ -57,10 +57,11 @@ class G1Allocator : public CHeapObj<mtGC> {
   SurvivorGCAllocRegion* _survivor_gc_alloc_regions;
 
   // Alloc region used to satisfy allocation requests by the GC for
-  // old objects.
-  OldGCAllocRegion _old_gc_alloc_region;
+  // old objects, one per memory node.
+  OldGCAllocRegion* _old_gc_alloc_regions;
 
-  G1HeapRegion* _retained_old_gc_alloc_region;
+  // Old GC alloc regions retained across GCs, one per memory node.
+  G1HeapRegion** _retained_old_gc_alloc_regions;
 
   bool survivor_is_full() const;
   bool old_is_full() const;
@@ -75,7 +76,7 @@ class G1Allocator : public CHeapObj<mtGC> {
   // Accessors to the allocation regions.
   inline MutatorAllocRegion* mutator_alloc_region(uint node_index);
   inline SurvivorGCAllocRegion* survivor_gc_alloc_region(uint node_index);
-  inline OldGCAllocRegion* old_gc_alloc_region();
+  inline OldGCAllocRegion* old_gc_alloc_region(uint node_index);
 
   // Allocation attempt during GC for a survivor object / PLAB.
   HeapWord* survivor_attempt_allocation(size_t min_word_size,
@@ -86,7 +87,8 @@ class G1Allocator : public CHeapObj<mtGC> {
   // Allocation attempt during GC for an old object / PLAB.
   HeapWord* old_attempt_allocation(size_t min_word_size,
                                    size_t desired_word_size,
-                                   size_t* actual_word_size);
+                                   size_t* actual_word_size,
+                                   uint node_index);
 
   // Node index of current thread.
   inline uint current_node_index() const;
@@ -188,8 +190,7 @@ class G1PLABAllocator : public CHeapObj<mtGC> {
   inline PLAB* alloc_buffer(region_type_t dest, uint node_index) const;
 
   // Returns the number of allocation buffers for the given dest.
-  // There is only 1 buffer for Old while Young may have multiple buffers depending on
-  // active NUMA nodes.
+  // Both Young and Old have one buffer per active NUMA node.
   inline uint alloc_buffers_length(region_type_t dest) const;
 
   bool may_throw_away_buffer(size_t const allocation_word_sz, size_t const buffer_size) const;
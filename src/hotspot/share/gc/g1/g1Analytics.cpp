@@ -27,11 +27,13 @@
 #include "gc/g1/g1AnalyticsSequences.inline.hpp"
 #include "gc/g1/g1Predictions.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/numberSeq.hpp"
+#include "utilities/ostream.hpp"
 
 // Different defaults for different number of GC threads
 // They were chosen by running GCOld and SPECjbb on debris with different
@@ -67,7 +69,128 @@ static double non_young_other_cost_per_region_ms_defaults[] = {
   1.0, 0.7, 0.7, 0.5, 0.5, 0.42, 0.42, 0.30
 };
 
+// Initial values for the sequences read from a file written by a previous VM
+// run. The file consists of a header line identifying the configuration the
+// values were recorded with, followed by one "<name> <value>" line per item.
+// Values recorded with a different configuration are ignored.
+class G1PersistedAnalytics : public StackObj {
+public:
+  enum Item {
+    ConcurrentRefineRate,
+    CardScanToMergeRatio,
+    CostPerCardScan,
+    CostPerCardMerge,
+    CostPerCodeRoot,
+    CostPerByteCopied,
+    ConstantOtherTime,
+    YoungOtherCostPerRegion,
+    NonYoungOtherCostPerRegion,
+    RemarkTime,
+    CleanupTime,
+    NumItems
+  };
+
+private:
+  static const char* const _item_names[NumItems];
+  static const int Version = 1;
+
+  double _values[NumItems];
+  bool _has_value[NumItems];
+
+  static bool parse_header(const char* line) {
+    int version;
+    size_t max_heap_size;
+    uint parallel_gc_threads;
+    int processor_count;
+    if (sscanf(line, "G1Analytics %d " SIZE_FORMAT " %u %d",
+               &version, &max_heap_size, &parallel_gc_threads, &processor_count) != 4) {
+      return false;
+    }
+    return version == Version &&
+           max_heap_size == MaxHeapSize &&
+           parallel_gc_threads == ParallelGCThreads &&
+           processor_count == os::active_processor_count();
+  }
+
+  void parse_item(const char* line) {
+    char name[64];
+    double value;
+    if (sscanf(line, "%63s %lf", name, &value) != 2 || !(value >= 0.0 && value < DBL_MAX)) {
+      return;
+    }
+    for (uint i = 0; i < NumItems; i++) {
+      if (strcmp(name, _item_names[i]) == 0) {
+        _values[i] = value;
+        _has_value[i] = true;
+        return;
+      }
+    }
+  }
+
+public:
+  G1PersistedAnalytics() {
+    for (uint i = 0; i < NumItems; i++) {
+      _values[i] = 0.0;
+      _has_value[i] = false;
+    }
+  }
+
+  void load(const char* path) {
+    FILE* fp = os::fopen(path, "r");
+    if (fp == nullptr) {
+      log_info(gc, init)("Could not open analytics file %s, using defaults", path);
+      return;
+    }
+
+    char line[256];
+    if (fgets(line, sizeof(line), fp) == nullptr || !parse_header(line)) {
+      log_info(gc, init)("Analytics file %s was recorded with a different configuration, using defaults", path);
+    } else {
+      while (fgets(line, sizeof(line), fp) != nullptr) {
+        parse_item(line);
+      }
+      log_info(gc, init)("Loaded analytics from %s", path);
+    }
+    fclose(fp);
+  }
+
+  double value_or(Item item, double default_value) const {
+    return _has_value[item] ? _values[item] : default_value;
+  }
+
+  bool has_value(Item item) const { return _has_value[item]; }
+  double value(Item item) const { return _values[item]; }
+
+  static void print_header_on(outputStream* st) {
+    st->print_cr("G1Analytics %d " SIZE_FORMAT " %u %d",
+                 Version, MaxHeapSize, ParallelGCThreads, os::active_processor_count());
+  }
+
+  static void print_item_on(outputStream* st, Item item, const TruncatedSeq* seq) {
+    if (seq->num() > 0) {
+      st->print_cr("%s %.17g", _item_names[item], seq->davg());
+    }
+  }
+};
+
+const char* const G1PersistedAnalytics::_item_names[] = {
+  "concurrent_refine_rate_ms",
+  "card_scan_to_merge_ratio",
+  "cost_per_card_scan_ms",
+  "cost_per_card_merge_ms",
+  "cost_per_code_root_ms",
+  "cost_per_byte_copied_ms",
+  "constant_other_time_ms",
+  "young_other_cost_per_region_ms",
+  "non_young_other_cost_per_region_ms",
+  "concurrent_mark_remark_time_ms",
+  "concurrent_mark_cleanup_time_ms"
+};
+
 G1Analytics::G1Analytics(const G1Predictions* predictor) :
+  G1Analytics(predictor, G1AnalyticsFile) { }
+
+G1Analytics::G1Analytics(const G1Predictions* predictor, const char* persisted_file) :
     _predictor(predictor),
     _recent_gc_times_ms(NumPrevPausesForHeuristics),
     _concurrent_mark_remark_times_ms(NumPrevPausesForHeuristics),
@@ -96,26 +219,61 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
   _recent_prev_end_times_for_all_gcs_sec.add(os::elapsedTime());
   _prev_collection_pause_end_ms = os::elapsedTime() * 1000.0;
 
+  using Item = G1PersistedAnalytics::Item;
+  G1PersistedAnalytics persisted;
+  if (persisted_file != nullptr) {
+    persisted.load(persisted_file);
+  }
+
   uint index = MIN2(ParallelGCThreads - 1, 7u);
 
   // Start with inverse of maximum STW cost.
-  _concurrent_refine_rate_ms_seq.add(1/cost_per_logged_card_ms_defaults[0]);
+  _concurrent_refine_rate_ms_seq.add(persisted.value_or(Item::ConcurrentRefineRate, 1/cost_per_logged_card_ms_defaults[0]));
   // Some applications have very low rates for logging cards.
   _dirtied_cards_rate_ms_seq.add(0.0);
 
-  _card_scan_to_merge_ratio_seq.set_initial(young_card_scan_to_merge_ratio_defaults[index]);
-  _cost_per_card_scan_ms_seq.set_initial(young_only_cost_per_card_scan_ms_defaults[index]);
+  _card_scan_to_merge_ratio_seq.set_initial(persisted.value_or(Item::CardScanToMergeRatio, young_card_scan_to_merge_ratio_defaults[index]));
+  _cost_per_card_scan_ms_seq.set_initial(persisted.value_or(Item::CostPerCardScan, young_only_cost_per_card_scan_ms_defaults[index]));
+  if (persisted.has_value(Item::CostPerCardMerge)) {
+    _cost_per_card_merge_ms_seq.set_initial(persisted.value(Item::CostPerCardMerge));
+  }
+  if (persisted.has_value(Item::CostPerCodeRoot)) {
+    _cost_per_code_root_ms_seq.set_initial(persisted.value(Item::CostPerCodeRoot));
+  }
   _card_rs_length_seq.set_initial(0);
   _code_root_rs_length_seq.set_initial(0);
-  _cost_per_byte_copied_ms_seq.set_initial(cost_per_byte_ms_defaults[index]);
+  _cost_per_byte_copied_ms_seq.set_initial(persisted.value_or(Item::CostPerByteCopied, cost_per_byte_ms_defaults[index]));
 
-  _constant_other_time_ms_seq.add(constant_other_time_ms_defaults[index]);
-  _young_other_cost_per_region_ms_seq.add(young_other_cost_per_region_ms_defaults[index]);
-  _non_young_other_cost_per_region_ms_seq.add(non_young_other_cost_per_region_ms_defaults[index]);
+  _constant_other_time_ms_seq.add(persisted.value_or(Item::ConstantOtherTime, constant_other_time_ms_defaults[index]));
+  _young_other_cost_per_region_ms_seq.add(persisted.value_or(Item::YoungOtherCostPerRegion, young_other_cost_per_region_ms_defaults[index]));
+  _non_young_other_cost_per_region_ms_seq.add(persisted.value_or(Item::NonYoungOtherCostPerRegion, non_young_other_cost_per_region_ms_defaults[index]));
 
   // start conservatively (around 50ms is about right)
-  _concurrent_mark_remark_times_ms.add(0.05);
-  _concurrent_mark_cleanup_times_ms.add(0.20);
+  _concurrent_mark_remark_times_ms.add(persisted.value_or(Item::RemarkTime, 0.05));
+  _concurrent_mark_cleanup_times_ms.add(persisted.value_or(Item::CleanupTime, 0.20));
+}
+
+bool G1Analytics::save_to_file(const char* path) const {
+  using Item = G1PersistedAnalytics::Item;
+
+  fileStream fs(path, "w");
+  if (!fs.is_open()) {
+    log_warning(gc)("Could not write analytics file %s", path);
+    return false;
+  }
+  G1PersistedAnalytics::print_header_on(&fs);
+  G1PersistedAnalytics::print_item_on(&fs, Item::ConcurrentRefineRate, &_concurrent_refine_rate_ms_seq);
+  G1PersistedAnalytics::print_item_on(&fs, Item::CardScanToMergeRatio, _card_scan_to_merge_ratio_seq.young_only_seq());
+  G1PersistedAnalytics::print_item_on(&fs, Item::CostPerCardScan, _cost_per_card_scan_ms_seq.young_only_seq());
+  G1PersistedAnalytics::print_item_on(&fs, Item::CostPerCardMerge, _cost_per_card_merge_ms_seq.young_only_seq());
+  G1PersistedAnalytics::print_item_on(&fs, Item::CostPerCodeRoot, _cost_per_code_root_ms_seq.young_only_seq());
+  G1PersistedAnalytics::print_item_on(&fs, Item::CostPerByteCopied, _cost_per_byte_copied_ms_seq.young_only_seq());
+  G1PersistedAnalytics::print_item_on(&fs, Item::ConstantOtherTime, &_constant_other_time_ms_seq);
+  G1PersistedAnalytics::print_item_on(&fs, Item::YoungOtherCostPerRegion, &_young_other_cost_per_region_ms_seq);
+  G1PersistedAnalytics::print_item_on(&fs, Item::NonYoungOtherCostPerRegion, &_non_young_other_cost_per_region_ms_seq);
+  G1PersistedAnalytics::print_item_on(&fs, Item::RemarkTime, &_concurrent_mark_remark_times_ms);
+  G1PersistedAnalytics::print_item_on(&fs, Item::CleanupTime, &_concurrent_mark_cleanup_times_ms);
+  return true;
 }
 
 bool G1Analytics::enough_samples_available(TruncatedSeq const* seq) {
@@ -93,6 +93,13 @@ class G1Analytics: public CHeapObj<mtGC> {
 
 public:
   G1Analytics(const G1Predictions* predictor);
+  // Seeds the sequences from the values saved in persisted_file by a previous
+  // run with the same configuration if available, otherwise uses defaults.
+  G1Analytics(const G1Predictions* predictor, const char* persisted_file);
+
+  // Save the current values of the sequences used for seeding to the given file.
+  // Returns whether saving succeeded.
+  bool save_to_file(const char* path) const;
 
   // Returns whether the sequence have enough samples to get a "good" prediction.
   // The constant used is random but "small".
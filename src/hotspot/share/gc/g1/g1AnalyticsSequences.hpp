@@ -50,6 +50,8 @@ class G1PhaseDependentSeq {
   void add(double value, bool for_young_only_phase);
 
   double predict(const G1Predictions* predictor, bool use_young_only_phase_seq) const;
+
+  const TruncatedSeq* young_only_seq() const { return &_young_only_seq; }
 };
 
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_HPP */
@@ -33,10 +33,12 @@
 #include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/concurrentHashTableTasks.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
 
 G1CardSet::ContainerPtr G1CardSet::FullCardSet = (G1CardSet::ContainerPtr)-1;
 uint G1CardSet::_split_card_shift = 0;
@@ -334,6 +336,11 @@ class G1CardSetHashTable : public CHeapObj<mtGCCardSet> {
     _table_scanner.do_safepoint_scan(scan_f);
   }
 
+  template <typename SCAN_FUNC>
+  void iterate_serial_safepoint(SCAN_FUNC& scan_f) {
+    _table.do_safepoint_scan(scan_f);
+  }
+
   template <typename SCAN_FUNC>
   void iterate(SCAN_FUNC& scan_f) {
     _table.do_scan(Thread::current(), scan_f);
@@ -1039,6 +1046,39 @@ void G1CardSet::clear() {
   _mm->flush();
 }
 
+size_t G1CardSet::coarsen_to_full() {
+  assert_at_safepoint();
+
+  GrowableArray<uint> card_regions(8, mtGCCardSet);
+  bool all_full = true;
+  auto collect_card_region =
+    [&] (G1CardSetHashTableValue* value) {
+      card_regions.append(value->_region_idx);
+      all_full &= (value->_container == FullCardSet);
+      return true;
+    };
+  _table->iterate_serial_safepoint(collect_card_region);
+
+  if (all_full) {
+    return 0;
+  }
+
+  // Clearing frees all containers and returns the memory to the memory manager
+  // in bulk; afterwards re-add the card regions as Full.
+  clear();
+  for (uint card_region : card_regions) {
+    bool should_grow_table = false;
+    G1CardSetHashTableValue* table_entry = get_or_add_container(card_region, &should_grow_table);
+    table_entry->_container = FullCardSet;
+    table_entry->_num_occupied = _config->max_cards_in_region();
+    _num_occupied += _config->max_cards_in_region();
+    if (should_grow_table) {
+      _table->grow();
+    }
+  }
+  return (size_t)card_regions.length();
+}
+
 void G1CardSet::reset_table_scanner() {
   _table->reset_table_scanner();
 }
@@ -378,6 +378,11 @@ class G1CardSet : public CHeapObj<mtGCCardSet> {
   // Clear the entire contents of this remembered set.
   void clear();
 
+  // Replace all containers by Full containers, giving back the memory used by
+  // the previous containers. Returns the number of containers coarsened. Must
+  // be called at a safepoint.
+  size_t coarsen_to_full();
+
   void reset_table_scanner();
 
   // Iterate over the container, calling a method on every card or card range contained
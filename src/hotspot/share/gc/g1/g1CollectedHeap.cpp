@@ -29,6 +29,7 @@
 #include "code/codeCache.hpp"
 #include "compiler/oopMap.hpp"
 #include "gc/g1/g1Allocator.inline.hpp"
+#include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1Arguments.hpp"
 #include "gc/g1/g1BarrierSet.hpp"
 #include "gc/g1/g1BatchedTask.hpp"
@@ -75,6 +76,7 @@
 #include "gc/g1/g1VMOperations.hpp"
 #include "gc/g1/g1YoungCollector.hpp"
 #include "gc/g1/g1YoungGCAllocationFailureInjector.hpp"
+#include "gc/shared/allocationSiteSurvival.hpp"
 #include "gc/shared/classUnloadingContext.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcBehaviours.hpp"
@@ -838,6 +840,11 @@ bool G1CollectedHeap::do_full_collection(bool clear_all_soft_refs,
   collector.collect();
   collector.complete_collection();
 
+  if (_allocation_site_survival != nullptr) {
+    // All sampled objects are old now, regardless of their actual age.
+    _allocation_site_survival->discard_samples();
+  }
+
   // Full collection was successfully completed.
   return true;
 }
@@ -1155,6 +1162,9 @@ G1CollectedHeap::G1CollectedHeap() :
   _gc_tracer_stw(new G1NewTracer()),
   _policy(new G1Policy(_gc_timer_stw)),
   _heap_sizing_policy(nullptr),
+  _allocation_site_survival(AllocationSiteSurvivalSampleRate > 0 ?
+                            new AllocationSiteSurvival(AllocationSiteSurvivalSampleRate) :
+                            nullptr),
   _collection_set(this, _policy),
   _rem_set(nullptr),
   _card_set_config(),
@@ -1447,6 +1457,10 @@ void G1CollectedHeap::stop() {
   _cr->stop();
   _service_thread->stop();
   _cm_thread->stop();
+
+  if (G1AnalyticsFile != nullptr) {
+    _policy->analytics()->save_to_file(G1AnalyticsFile);
+  }
 }
 
 void G1CollectedHeap::safepoint_synchronize_begin() {
@@ -2515,6 +2529,10 @@ void G1CollectedHeap::unload_classes_and_code(const char* description, BoolObjec
   {
     CodeCache::UnlinkingScope scope(is_alive);
     bool unloading_occurred = SystemDictionary::do_unloading(timer);
+    if (unloading_occurred && _allocation_site_survival != nullptr) {
+      // Sites refer to possibly unloaded classes.
+      _allocation_site_survival->purge();
+    }
     GCTraceTime(Debug, gc, phases) t("G1 Complete Cleaning", timer);
     complete_cleaning(unloading_occurred);
   }
@@ -65,6 +65,7 @@
 // heap subsets that will yield large amounts of garbage.
 
 // Forward declarations
+class AllocationSiteSurvival;
 class G1Allocator;
 class G1BatchedTask;
 class G1CardTableEntryClosure;
@@ -380,6 +381,9 @@ class G1CollectedHeap : public CollectedHeap {
   G1Policy* _policy;
   G1HeapSizingPolicy* _heap_sizing_policy;
 
+  // Allocation site survival statistics, null unless enabled.
+  AllocationSiteSurvival* _allocation_site_survival;
+
   G1CollectionSet _collection_set;
 
   // Try to allocate a single non-humongous G1HeapRegion sufficient for
@@ -1280,6 +1284,8 @@ class G1CollectedHeap : public CollectedHeap {
 
   WorkerThreads* safepoint_workers() override { return _workers; }
 
+  AllocationSiteSurvival* allocation_site_survival() const override { return _allocation_site_survival; }
+
   // The methods below are here for convenience and dispatch the
   // appropriate method depending on value of the given VerifyOption
   // parameter. The values for that parameter, and their meanings,
@@ -50,6 +50,7 @@
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/gcVMOperations.hpp"
+#include "gc/shared/markPrefetchQueue.inline.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
@@ -548,6 +549,8 @@ G1ConcurrentMark::G1ConcurrentMark(G1CollectedHeap* g1h,
   // so that the assertion in MarkingTaskQueue::task_queue doesn't fail
   _num_active_tasks = _max_num_tasks;
 
+  _task_queues->set_steal_policy(UseBatchedTaskQueueSteal, UseNUMA && UseNUMALocalTaskQueueSteal);
+
   for (uint i = 0; i < _max_num_tasks; ++i) {
     G1CMTaskQueue* task_queue = new G1CMTaskQueue();
     _task_queues->register_queue(i, task_queue);
@@ -2377,13 +2380,29 @@ void G1CMTask::drain_local_queue(bool partially) {
     G1TaskQueueEntry entry;
     bool ret = _task_queue->pop_local(entry);
     while (ret) {
-      scan_task_entry(entry);
+      G1TaskQueueEntry ready;
+      const void* addr = entry.is_oop() ? (const void*)cast_from_oop<HeapWord*>(entry.obj()) : entry.slice();
+      if (_prefetch_queue.push(entry, addr, ready)) {
+        scan_task_entry(ready);
+      }
       if (_task_queue->size() <= target_size || has_aborted()) {
         ret = false;
       } else {
         ret = _task_queue->pop_local(entry);
       }
     }
+    drain_prefetch_queue();
+  }
+}
+
+void G1CMTask::drain_prefetch_queue() {
+  G1TaskQueueEntry entry;
+  while (_prefetch_queue.pop(entry)) {
+    if (has_aborted()) {
+      push(entry);
+    } else {
+      scan_task_entry(entry);
+    }
   }
 }
 
@@ -2483,6 +2502,10 @@ bool G1ConcurrentMark::try_stealing(uint worker_id, G1TaskQueueEntry& task_entry
   return _task_queues->steal(worker_id, task_entry);
 }
 
+void G1ConcurrentMark::update_numa_node(uint worker_id) {
+  _task_queues->update_numa_node(worker_id);
+}
+
 /*****************************************************************************
 
     The do_marking_step(time_target_ms, ...) method is the building
@@ -2610,6 +2633,9 @@ void G1CMTask::do_marking_step(double time_target_ms,
   // enable stealing when the termination protocol is enabled
   // and do_marking_step() is not being called serially.
   bool do_stealing = do_termination && !is_serial;
+  if (do_stealing) {
+    _cm->update_numa_node(_worker_id);
+  }
 
   G1Predictions const& predictor = _g1h->policy()->predictor();
   double diff_prediction_ms = predictor.predict_zero_bounded(&_marking_step_diff_ms);
@@ -2913,6 +2939,7 @@ G1CMTask::G1CMTask(uint worker_id,
   _cm(cm),
   _mark_bitmap(nullptr),
   _task_queue(task_queue),
+  _prefetch_queue(MarkingPrefetchDistance),
   _mark_stats_cache(mark_stats, G1RegionMarkStatsCache::RegionMarkStatsCacheSize),
   _calls(0),
   _time_target_ms(0.0),
@@ -31,6 +31,7 @@
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/g1RegionMarkStatsCache.hpp"
 #include "gc/shared/gcCause.hpp"
+#include "gc/shared/markPrefetchQueue.hpp"
 #include "gc/shared/taskTerminator.hpp"
 #include "gc/shared/taskqueue.hpp"
 #include "gc/shared/verifyOption.hpp"
@@ -623,6 +624,8 @@ class G1ConcurrentMark : public CHeapObj<mtGC> {
 
   // Attempts to steal an object from the task queues of other tasks
   bool try_stealing(uint worker_id, G1TaskQueueEntry& task_entry);
+  // Record the NUMA node of the worker for NUMA-local stealing.
+  void update_numa_node(uint worker_id);
 
   G1ConcurrentMark(G1CollectedHeap* g1h,
                    G1RegionToSpaceMapper* bitmap_storage);
@@ -744,6 +747,8 @@ class G1CMTask : public TerminatorTerminator {
   G1CMBitMap*                 _mark_bitmap;
   // the task queue of this task
   G1CMTaskQueue*              _task_queue;
+  // entries popped from the task queue that are being prefetched
+  MarkPrefetchQueue<G1TaskQueueEntry> _prefetch_queue;
 
   G1RegionMarkStatsCache      _mark_stats_cache;
   // Number of calls to this task
@@ -915,6 +920,9 @@ class G1CMTask : public TerminatorTerminator {
   // true, then it stops when the queue size is of a given limit. If
   // partially is false, then it stops when the queue is empty.
   void drain_local_queue(bool partially);
+  // Scans the entries still in the prefetch queue, or pushes them back
+  // to the local queue if the task has aborted.
+  void drain_prefetch_queue();
   // Moves entries from the global stack to the local queue and
   // drains the local queue. If partially is true, then it stops when
   // both the global stack and the local queue reach a given size. If
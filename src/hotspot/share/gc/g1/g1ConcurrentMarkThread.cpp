@@ -97,19 +97,56 @@ void G1ConcurrentMarkThread::delay_to_keep_mmu(bool remark) {
   }
 }
 
+// Sums the CPU time of the concurrent marking threads.
+class G1ConcMarkCPUTimeClosure : public ThreadClosure {
+  jlong _total;
+
+ public:
+  G1ConcMarkCPUTimeClosure() : _total(0) {}
+
+  virtual void do_thread(Thread* thread) {
+    jlong cpu = os::thread_cpu_time(thread);
+    if (cpu > 0) {
+      _total += cpu;
+    }
+  }
+
+  jlong total() const { return _total; }
+};
+
 class G1ConcPhaseTimer : public GCTraceConcTimeImpl<LogLevel::Info, LOG_TAGS(gc, marking)> {
   G1ConcurrentMark* _cm;
+  const char* _title;
+  // CPU time used by the marking threads when the phase started, or -1 if
+  // it is not being tracked.
+  jlong _start_cpu_time;
+
+  jlong threads_cpu_time() const {
+    G1ConcMarkCPUTimeClosure cl;
+    cl.do_thread(Thread::current());
+    _cm->threads_do(&cl);
+    return cl.total();
+  }
 
  public:
   G1ConcPhaseTimer(G1ConcurrentMark* cm, const char* title) :
     GCTraceConcTimeImpl<LogLevel::Info,  LogTag::_gc, LogTag::_marking>(title),
-    _cm(cm)
+    _cm(cm),
+    _title(title),
+    _start_cpu_time(-1)
   {
     _cm->gc_timer_cm()->register_gc_concurrent_start(title);
+    if (log_is_enabled(Debug, gc, cpu) && os::is_thread_cpu_time_supported()) {
+      _start_cpu_time = threads_cpu_time();
+    }
   }
 
   ~G1ConcPhaseTimer() {
     _cm->gc_timer_cm()->register_gc_concurrent_end();
+    if (_start_cpu_time >= 0) {
+      jlong cpu_time = threads_cpu_time() - _start_cpu_time;
+      log_debug(gc, cpu)("%s CPU: %.3fms", _title, (double)cpu_time / NANOSECS_PER_MILLISEC);
+    }
   }
 };
 
@@ -31,7 +31,10 @@
 #include "gc/g1/g1HeapRegion.inline.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "logging/log.hpp"
+#include "memory/allocation.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
 #include "utilities/ticks.hpp"
 
 void G1FullGCCompactTask::G1CompactRegionClosure::clear_in_bitmap(oop obj) {
@@ -85,14 +88,91 @@ void G1FullGCCompactTask::compact_region(G1HeapRegion* hr) {
   hr->reset_compacted_after_full_gc(_collector->compaction_top(hr));
 }
 
+G1FullGCCompactTask::G1FullGCCompactTask(G1FullCollector* collector) :
+  G1FullGCTask("G1 Compact Task", collector),
+  _collector(collector),
+  _claimer(collector->workers()),
+  _g1h(G1CollectedHeap::heap()),
+  _claim_indices(NEW_C_HEAP_ARRAY(uint, collector->workers(), mtGC)),
+  _compacted(NEW_C_HEAP_ARRAY(bool, _g1h->max_reserved_regions(), mtGC)) {
+  for (uint i = 0; i < collector->workers(); i++) {
+    _claim_indices[i] = 0;
+  }
+  for (uint i = 0; i < _g1h->max_reserved_regions(); i++) {
+    _compacted[i] = false;
+  }
+}
+
+G1FullGCCompactTask::~G1FullGCCompactTask() {
+  FREE_C_HEAP_ARRAY(uint, _claim_indices);
+  FREE_C_HEAP_ARRAY(bool, _compacted);
+}
+
+bool G1FullGCCompactTask::can_compact(G1FullGCCompactionPoint* cp, uint index) const {
+  Pair<uint, uint> range = cp->forwarding_range(index);
+  for (uint i = range.first; i <= range.second; i++) {
+    // Objects may always slide within their own region.
+    if (i == index) {
+      continue;
+    }
+    if (!Atomic::load_acquire(&_compacted[cp->regions()->at(i)->hrm_index()])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+G1HeapRegion* G1FullGCCompactTask::claim_region(uint cp_index) {
+  G1FullGCCompactionPoint* cp = collector()->compaction_point(cp_index);
+  assert(!cp->has_regions() || cp->has_forwarding_ranges(), "must be");
+
+  uint const length = (uint)cp->regions()->length();
+  uint cur = Atomic::load(&_claim_indices[cp_index]);
+  while (cur < length) {
+    if (!can_compact(cp, cur)) {
+      return nullptr;
+    }
+    uint prev = Atomic::cmpxchg(&_claim_indices[cp_index], cur, cur + 1);
+    if (prev == cur) {
+      return cp->regions()->at(cur);
+    }
+    cur = prev;
+  }
+  return nullptr;
+}
+
 void G1FullGCCompactTask::work(uint worker_id) {
   Ticks start = Ticks::now();
-  GrowableArray<G1HeapRegion*>* compaction_queue = collector()->compaction_point(worker_id)->regions();
-  for (GrowableArrayIterator<G1HeapRegion*> it = compaction_queue->begin();
-       it != compaction_queue->end();
-       ++it) {
-    compact_region(*it);
+  uint const num_cps = collector()->workers();
+  uint num_stolen = 0;
+
+  while (true) {
+    G1HeapRegion* hr = nullptr;
+    bool has_unclaimed = false;
+    // Prefer the worker's own compaction queue, then try the others.
+    for (uint i = 0; i < num_cps; i++) {
+      uint cp_index = (worker_id + i) % num_cps;
+      hr = claim_region(cp_index);
+      if (hr != nullptr) {
+        num_stolen += (i != 0) ? 1 : 0;
+        break;
+      }
+      uint length = (uint)collector()->compaction_point(cp_index)->regions()->length();
+      has_unclaimed |= Atomic::load(&_claim_indices[cp_index]) < length;
+    }
+
+    if (hr != nullptr) {
+      compact_region(hr);
+      Atomic::release_store(&_compacted[hr->hrm_index()], true);
+    } else if (has_unclaimed) {
+      // All remaining regions wait for regions currently compacted by other workers.
+      SpinPause();
+    } else {
+      break;
+    }
   }
+  log_trace(gc, phases)("Compaction task (%u) compacted %u regions from other queues", worker_id, num_stolen);
+  log_task("Compaction task", worker_id, start);
 }
 
 void G1FullGCCompactTask::serial_compaction() {
@@ -35,23 +35,35 @@ class G1CollectedHeap;
 class G1CMBitMap;
 class G1FullCollector;
 
+// Regions in the compaction queues of the parallel compaction points are
+// compacted in parallel. Workers start with their own queue and steal regions
+// from other queues when they run out of work. A region may only be compacted
+// after all other regions its live objects are forwarded to have been compacted,
+// as otherwise not yet moved live objects might be overwritten.
 class G1FullGCCompactTask : public G1FullGCTask {
   G1FullCollector* _collector;
   HeapRegionClaimer _claimer;
   G1CollectedHeap* _g1h;
 
+  // Next unclaimed position in the compaction queue of each compaction point.
+  uint volatile* _claim_indices;
+  // Whether a region, indexed by hrm index, has been compacted.
+  bool volatile* _compacted;
+
   void compact_region(G1HeapRegion* hr);
   void compact_humongous_obj(G1HeapRegion* hr);
   void free_non_overlapping_regions(uint src_start_idx, uint dest_start_idx, uint num_regions);
 
+  bool can_compact(G1FullGCCompactionPoint* cp, uint index) const;
+  // Claim the next region of the given compaction point's queue if it can be
+  // compacted right away.
+  G1HeapRegion* claim_region(uint cp_index);
+
   static void copy_object_to_new_location(oop obj);
 
 public:
-  G1FullGCCompactTask(G1FullCollector* collector) :
-    G1FullGCTask("G1 Compact Task", collector),
-    _collector(collector),
-    _claimer(collector->workers()),
-    _g1h(G1CollectedHeap::heap()) { }
+  G1FullGCCompactTask(G1FullCollector* collector);
+  ~G1FullGCCompactTask();
 
   void work(uint worker_id);
   void serial_compaction();
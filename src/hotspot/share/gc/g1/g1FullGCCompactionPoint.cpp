@@ -36,11 +36,13 @@ G1FullGCCompactionPoint::G1FullGCCompactionPoint(G1FullCollector* collector, Pre
     _compaction_top(nullptr),
     _preserved_stack(preserved_stack) {
   _compaction_regions = new (mtGC) GrowableArray<G1HeapRegion*>(32, mtGC);
-  _compaction_region_iterator = _compaction_regions->begin();
+  _compaction_region_index = 0;
+  _forwarding_ranges = new (mtGC) GrowableArray<Pair<uint, uint>>(32, mtGC);
 }
 
 G1FullGCCompactionPoint::~G1FullGCCompactionPoint() {
   delete _compaction_regions;
+  delete _forwarding_ranges;
 }
 
 void G1FullGCCompactionPoint::update() {
@@ -67,15 +69,39 @@ void G1FullGCCompactionPoint::initialize(G1HeapRegion* hr) {
 }
 
 G1HeapRegion* G1FullGCCompactionPoint::current_region() {
-  return *_compaction_region_iterator;
+  return _compaction_regions->at(_compaction_region_index);
+}
+
+uint G1FullGCCompactionPoint::current_region_index() const {
+  return (uint)_compaction_region_index;
 }
 
 G1HeapRegion* G1FullGCCompactionPoint::next_region() {
-  G1HeapRegion* next = *(++_compaction_region_iterator);
+  G1HeapRegion* next = _compaction_regions->at(++_compaction_region_index);
   assert(next != nullptr, "Must return valid region");
   return next;
 }
 
+void G1FullGCCompactionPoint::record_forwarding_range(uint first_index) {
+  assert(first_index <= current_region_index(), "must be");
+  assert(current_region_index() <= (uint)_forwarding_ranges->length(),
+         "objects must not be forwarded to later regions");
+  _forwarding_ranges->append(Pair<uint, uint>(first_index, current_region_index()));
+}
+
+void G1FullGCCompactionPoint::record_no_forwarding() {
+  uint index = (uint)_forwarding_ranges->length();
+  _forwarding_ranges->append(Pair<uint, uint>(index, index));
+}
+
+Pair<uint, uint> G1FullGCCompactionPoint::forwarding_range(uint index) const {
+  return _forwarding_ranges->at(index);
+}
+
+bool G1FullGCCompactionPoint::has_forwarding_ranges() const {
+  return _forwarding_ranges->length() == _compaction_regions->length();
+}
+
 GrowableArray<G1HeapRegion*>* G1FullGCCompactionPoint::regions() {
   return _compaction_regions;
 }
@@ -134,6 +160,9 @@ void G1FullGCCompactionPoint::remove_at_or_above(uint bottom) {
 
   assert(start_index >= 0, "Should have at least one region");
   _compaction_regions->trunc_to(start_index);
+  if (_forwarding_ranges->length() > start_index) {
+    _forwarding_ranges->trunc_to(start_index);
+  }
 }
 
 void G1FullGCCompactionPoint::add_humongous(G1HeapRegion* hr) {
@@ -40,7 +40,11 @@ class G1FullGCCompactionPoint : public CHeapObj<mtGC> {
   HeapWord* _compaction_top;
   PreservedMarks* _preserved_stack;
   GrowableArray<G1HeapRegion*>* _compaction_regions;
-  GrowableArrayIterator<G1HeapRegion*> _compaction_region_iterator;
+  int _compaction_region_index;
+  // For every region in _compaction_regions, the range of positions in
+  // _compaction_regions that its live objects are forwarded to. Parallel
+  // compaction uses it to determine when a region may be compacted.
+  GrowableArray<Pair<uint, uint>>* _forwarding_ranges;
 
   bool object_will_fit(size_t size);
   void initialize_values();
@@ -63,6 +67,17 @@ class G1FullGCCompactionPoint : public CHeapObj<mtGC> {
 
   void remove_at_or_above(uint bottom);
   G1HeapRegion* current_region();
+  uint current_region_index() const;
+
+  // Record the range of regions in this compaction point the region at the
+  // next position forwarded its live objects to. The range ends at the
+  // current region.
+  void record_forwarding_range(uint first_index);
+  // Record that the region at the next position does not need to move any
+  // objects.
+  void record_no_forwarding();
+  Pair<uint, uint> forwarding_range(uint index) const;
+  bool has_forwarding_ranges() const;
 
   GrowableArray<G1HeapRegion*>* regions();
 
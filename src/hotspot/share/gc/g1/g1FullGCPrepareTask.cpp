@@ -115,7 +115,11 @@ size_t G1FullGCPrepareTask::G1PrepareCompactLiveClosure::apply(oop object) {
 
 void G1FullGCPrepareTask::G1CalculatePointersClosure::prepare_for_compaction(G1HeapRegion* hr) {
   if (!_collector->is_free(hr->hrm_index())) {
+    uint first_index = _cp->current_region_index();
     G1PrepareCompactLiveClosure prepare_compact(_cp);
     hr->apply_to_marked_objects(_bitmap, &prepare_compact);
+    _cp->record_forwarding_range(first_index);
+  } else {
+    _cp->record_no_forwarding();
   }
 }
@@ -263,6 +263,10 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   double get_time_secs(GCParPhases phase, uint worker_id);
 
+  WorkerDataArray<double>* worker_data(GCParPhases phase) const {
+    return _gc_par_phases[phase];
+  }
+
   void record_thread_work_item(GCParPhases phase, uint worker_id, size_t count, uint index = 0);
 
   void record_or_add_thread_work_item(GCParPhases phase, uint worker_id, size_t count, uint index = 0);
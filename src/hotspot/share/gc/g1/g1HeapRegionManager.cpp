@@ -119,7 +119,8 @@ G1HeapRegion* HeapRegionManager::allocate_free_region(HeapRegionType type, uint
 }
 
 G1HeapRegion* HeapRegionManager::allocate_humongous_from_free_list(uint num_regions) {
-  uint candidate = find_contiguous_in_free_list(num_regions);
+  uint candidate = G1HumongousBestFit ? find_best_fit_in_free_list(num_regions)
+                                      : find_contiguous_in_free_list(num_regions);
   if (candidate == G1_NO_HRM_INDEX) {
     return nullptr;
   }
@@ -136,8 +137,9 @@ G1HeapRegion* HeapRegionManager::allocate_humongous_allow_expand(uint num_region
 }
 
 G1HeapRegion* HeapRegionManager::allocate_humongous(uint num_regions) {
-  // Special case a single region to avoid expensive search.
-  if (num_regions == 1) {
+  // Special case a single region to avoid expensive search, unless best-fit
+  // placement has been requested.
+  if (num_regions == 1 && !G1HumongousBestFit) {
     return allocate_free_region(HeapRegionType::Humongous, G1NUMA::AnyNodeIndex);
   }
   return allocate_humongous_from_free_list(num_regions);
@@ -477,6 +479,41 @@ uint HeapRegionManager::find_contiguous_in_free_list(uint num_regions) {
   return candidate;
 }
 
+uint HeapRegionManager::find_best_fit_in_free_list(uint num_regions) {
+  assert(num_regions >= 1, "precondition");
+  uint best_start = G1_NO_HRM_INDEX;
+  uint best_length = UINT_MAX;
+  HeapRegionRange range(0,0);
+
+  do {
+    range = _committed_map.next_active_range(range.end());
+    // Walk all maximal runs of free regions in the active range and remember
+    // the shortest one that still fits.
+    uint run_start = range.start();
+    for (uint i = range.start(); i <= range.end(); i++) {
+      if (i < range.end() && at(i)->is_free()) {
+        continue;
+      }
+      uint run_length = i - run_start;
+      if (run_length >= num_regions && run_length < best_length) {
+        best_start = run_start;
+        best_length = run_length;
+        if (run_length == num_regions) {
+          // Exact fit, cannot do better.
+          assert_contiguous_range(best_start, num_regions);
+          return best_start;
+        }
+      }
+      run_start = i + 1;
+    }
+  } while (range.end() < reserved_length());
+
+  if (best_start != G1_NO_HRM_INDEX) {
+    assert_contiguous_range(best_start, num_regions);
+  }
+  return best_start;
+}
+
 uint HeapRegionManager::find_contiguous_allow_expand(uint num_regions) {
   // Check if we can actually satisfy the allocation.
   if (num_regions > available()) {
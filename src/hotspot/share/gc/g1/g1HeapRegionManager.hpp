@@ -100,6 +100,10 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Find a contiguous set of empty regions of length num_regions. Returns the start index
   // of that set, or G1_NO_HRM_INDEX.
   uint find_contiguous_in_free_list(uint num_regions);
+  // Find the shortest run of contiguous empty regions of at least num_regions
+  // length and return the index of its first region, or G1_NO_HRM_INDEX. Leaves
+  // longer runs intact for later, larger humongous allocations.
+  uint find_best_fit_in_free_list(uint num_regions);
   // Find a contiguous set of empty or unavailable regions of length num_regions. Returns the
   // start index of that set, or G1_NO_HRM_INDEX.
   uint find_contiguous_allow_expand(uint num_regions);
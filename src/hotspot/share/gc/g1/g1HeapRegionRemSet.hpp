@@ -134,6 +134,18 @@ class HeapRegionRemSet : public CHeapObj<mtGC> {
     return _card_set.unused_mem_size();
   }
 
+  // The number of bytes taken up by the card set alone.
+  size_t card_set_mem_size() const {
+    return _card_set.mem_size();
+  }
+
+  // Coarsen all card set containers to Full, trading scan time during merging
+  // of remembered sets for memory. Returns the number of coarsened containers.
+  // Must be called at a safepoint.
+  size_t coarsen_card_set() {
+    return _card_set.coarsen_to_full();
+  }
+
   // Returns the memory occupancy of all static data structures associated
   // with remembered sets.
   static size_t static_mem_size() {
@@ -25,10 +25,13 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1CollectedHeap.hpp"
+#include "gc/g1/g1HeapRegion.hpp"
 #include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -83,6 +86,12 @@ static void log_expansion(double short_term_pause_time_ratio,
                             resize_bytes);
 }
 
+size_t G1HeapSizingPolicy::soft_max_capacity() {
+  // SoftMaxHeapSize is manageable and may change at any time.
+  size_t soft_max = MIN2(Atomic::load(&SoftMaxHeapSize), MaxHeapSize);
+  return align_up(MAX2(soft_max, MinHeapSize), G1HeapRegion::GrainBytes);
+}
+
 size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   assert(GCTimeRatio > 0, "must be");
 
@@ -177,6 +186,10 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
     // and at most the remaining uncommitted byte size.
     expand_bytes = clamp(expand_bytes, min_expand_bytes, uncommitted_bytes);
 
+    // GC overhead alone does not grow the heap beyond SoftMaxHeapSize.
+    const size_t soft_max = soft_max_capacity();
+    expand_bytes = committed_bytes < soft_max ? MIN2(expand_bytes, soft_max - committed_bytes) : 0;
+
     clear_ratio_check_data();
   } else {
     // An expansion was not triggered. If we've started counting, increment
@@ -240,6 +253,10 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // it with respect to the heap min size as it's a lower bound (i.e.,
   // we'll try to make the capacity larger than it, not smaller).
   minimum_desired_capacity = MIN2(minimum_desired_capacity, MaxHeapSize);
+  // Shrink towards SoftMaxHeapSize as long as that leaves the minimum free
+  // space MinHeapFreeRatio asks for.
+  maximum_desired_capacity = MIN2(maximum_desired_capacity,
+                                  MAX2(soft_max_capacity(), minimum_desired_capacity));
   // Should not be less than the heap min size. No need to adjust it
   // with respect to the heap max size as it's an upper bound (i.e.,
   // we'll try to make the capacity smaller than it, not greater).
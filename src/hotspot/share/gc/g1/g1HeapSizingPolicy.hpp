@@ -62,6 +62,11 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // Clear ratio tracking data used by expansion_amount().
   void clear_ratio_check_data();
 
+  // The heap capacity G1 tries to stay within, derived from the manageable
+  // SoftMaxHeapSize. The heap still expands beyond it if live data or
+  // allocation failures require that.
+  static size_t soft_max_capacity();
+
   static G1HeapSizingPolicy* create(const G1CollectedHeap* g1h, const G1Analytics* analytics);
 };
 
@@ -87,6 +87,8 @@ class G1NUMAStats : public CHeapObj<mtGC> {
     NewRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
+    // Statistics of object processing during copy to old region.
+    LocalObjProcessAtCopyToOld,
     NodeDataItemsSentinel
   };
 
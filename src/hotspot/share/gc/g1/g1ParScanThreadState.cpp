@@ -85,6 +85,7 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _string_dedup_requests(),
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
+    _worker_node_index(_numa->index_of_current_thread()),
     _obj_alloc_stat(nullptr),
     ALLOCATION_FAILURE_INJECTOR_ONLY(_allocation_failure_inject_counter(0) COMMA)
     _preserved_marks(preserved_marks),
@@ -419,7 +420,7 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
     }
   }
   if (obj_ptr != nullptr) {
-    update_numa_stats(node_index);
+    update_numa_stats(*dest_attr, obj_ptr);
     if (_g1h->gc_tracer_stw()->should_report_promotion_events()) {
       // The events are checked individually as part of the actual commit
       report_promotion_event(*dest_attr, old, word_sz, age, obj_ptr, node_index);
@@ -448,6 +449,16 @@ void G1ParScanThreadState::update_bot_after_copying(oop obj, size_t word_sz) {
   region->update_bot_for_block(obj_start, obj_start + word_sz);
 }
 
+uint G1ParScanThreadState::evacuation_node_index(G1HeapRegion* from_region) const {
+  // By default keep objects on the node of the region they are evacuated from:
+  // eden regions are allocated on the node of the mutator that allocated the
+  // object, which is typically also the node accessing it most.
+  if (G1NUMAEvacuateToWorkerNode) {
+    return _worker_node_index;
+  }
+  return from_region->node_index();
+}
+
 // Private inline function, for direct internal use and providing the
 // implementation of the public not-inline function.
 MAYBE_INLINE_EVACUATION
@@ -470,7 +481,7 @@ oop G1ParScanThreadState::do_copy_to_survivor_space(G1HeapRegionAttr const regio
   uint age = 0;
   G1HeapRegionAttr dest_attr = next_region_attr(region_attr, old_mark, age);
   G1HeapRegion* const from_region = _g1h->heap_region_containing(old);
-  uint node_index = from_region->node_index();
+  uint node_index = evacuation_node_index(from_region);
 
   HeapWord* obj_ptr = _plab_allocator->plab_allocate(dest_attr, word_sz, node_index);
 
@@ -681,24 +692,40 @@ void G1ParScanThreadState::initialize_numa_stats() {
     LogTarget(Info, gc, heap, numa) lt;
 
     if (lt.is_enabled()) {
-      uint num_nodes = _numa->num_active_nodes();
+      // One row of per-node counts for each of the survivor and old destinations.
+      size_t const length = G1HeapRegionAttr::Num * _numa->num_active_nodes();
       // Record only if there are multiple active nodes.
-      _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
-      memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, length, mtGC);
+      memset(_obj_alloc_stat, 0, sizeof(size_t) * length);
     }
   }
 }
 
 void G1ParScanThreadState::flush_numa_stats() {
   if (_obj_alloc_stat != nullptr) {
-    uint node_index = _numa->index_of_current_thread();
-    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
+    // Flushing is done by the VM thread, so use the node index the worker
+    // recorded when it started evacuating.
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv,
+                           _worker_node_index,
+                           numa_stats_for(G1HeapRegionAttr::Young));
+    _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToOld,
+                           _worker_node_index,
+                           numa_stats_for(G1HeapRegionAttr::Old));
   }
 }
 
-void G1ParScanThreadState::update_numa_stats(uint node_index) {
+size_t* G1ParScanThreadState::numa_stats_for(G1HeapRegionAttr dest_attr) const {
+  assert(_obj_alloc_stat != nullptr, "must be");
+  assert(dest_attr.is_young() || dest_attr.is_old(), "Unexpected dest: %s", dest_attr.get_type_str());
+  return _obj_alloc_stat + dest_attr.type() * _numa->num_active_nodes();
+}
+
+void G1ParScanThreadState::update_numa_stats(G1HeapRegionAttr dest_attr, HeapWord* obj_ptr) {
   if (_obj_alloc_stat != nullptr) {
-    _obj_alloc_stat[node_index]++;
+    // Record the node the memory actually came from; the destination region may
+    // have been taken from another node if the requested one had no free regions.
+    uint const allocated_node_index = _g1h->heap_region_containing(obj_ptr)->node_index();
+    numa_stats_for(dest_attr)[allocated_node_index]++;
   }
 }
 
@@ -98,7 +98,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   G1OopStarChunkedList* _oops_into_optional_regions;
 
   G1NUMA* _numa;
-  // Records how many object allocations happened at each node during copy to survivor.
+  // Index of the memory node the worker thread executes on.
+  uint _worker_node_index;
+  // Records how many object allocations happened at each node during copy to survivor
+  // and old regions.
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
@@ -218,7 +221,11 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // NUMA statistics related methods.
   void initialize_numa_stats();
   void flush_numa_stats();
-  inline void update_numa_stats(uint node_index);
+  size_t* numa_stats_for(G1HeapRegionAttr dest_attr) const;
+  inline void update_numa_stats(G1HeapRegionAttr dest_attr, HeapWord* obj_ptr);
+
+  // Returns the memory node to copy objects evacuated from the given region to.
+  inline uint evacuation_node_index(G1HeapRegion* from_region) const;
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
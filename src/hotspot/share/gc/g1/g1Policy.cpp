@@ -36,6 +36,7 @@
 #include "gc/g1/g1CollectionSetChooser.hpp"
 #include "gc/g1/g1HeapRegion.inline.hpp"
 #include "gc/g1/g1HeapRegionRemSet.inline.hpp"
+#include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/g1/g1IHOPControl.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
@@ -72,6 +73,7 @@ G1Policy::G1Policy(STWGCTimer* gc_timer) :
   _card_rs_length(0),
   _pending_cards_at_gc_start(0),
   _concurrent_start_to_mixed(),
+  _evacuation_efficiency(),
   _collection_set(nullptr),
   _g1h(nullptr),
   _phase_times_timer(gc_timer),
@@ -171,9 +173,23 @@ void G1Policy::record_new_heap_size(uint new_number_of_regions) {
   // smaller than 1.0) we'll get 1.
   _reserve_regions = (uint) ceil(reserve_regions_d);
 
-  _young_gen_sizer.heap_size_changed(new_number_of_regions);
+  const size_t capacity = (size_t)new_number_of_regions * G1HeapRegion::GrainBytes;
+  const size_t soft_max = MIN2(capacity, G1HeapSizingPolicy::soft_max_capacity());
 
-  _ihop_control->update_target_occupancy(new_number_of_regions * G1HeapRegion::GrainBytes);
+  // Size the young generation relative to SoftMaxHeapSize, so that a heap
+  // that has grown beyond it does not also get a proportionally larger
+  // young generation.
+  _young_gen_sizer.heap_size_changed((uint)(soft_max / G1HeapRegion::GrainBytes));
+
+  // Start marking relative to SoftMaxHeapSize so that old generation
+  // occupancy can be kept within it. If old generation occupancy already
+  // exceeds the soft limit, the target stays at least the reserve above
+  // it: marking then starts at the next opportunity, but the target never
+  // falls below what is live.
+  const size_t reserve = (size_t)_reserve_regions * G1HeapRegion::GrainBytes;
+  const size_t old_occupancy = G1CollectedHeap::heap()->non_young_capacity_bytes();
+  const size_t target_occupancy = MIN2(capacity, MAX2(soft_max, old_occupancy + reserve));
+  _ihop_control->update_target_occupancy(target_occupancy);
 }
 
 uint G1Policy::calculate_desired_eden_length_by_mmu() const {
@@ -1057,6 +1073,11 @@ void G1Policy::report_ihop_statistics() {
 void G1Policy::record_young_gc_pause_end(bool evacuation_failed) {
   phase_times()->record_gc_pause_end();
   phase_times()->print(evacuation_failed);
+
+  // Termination time is spent waiting for work, not doing it.
+  _evacuation_efficiency.record(_g1h->workers()->active_workers(),
+                                phase_times()->worker_data(G1GCPhaseTimes::GCWorkerTotal),
+                                phase_times()->worker_data(G1GCPhaseTimes::Termination));
 }
 
 double G1Policy::predict_base_time_ms(size_t pending_cards,
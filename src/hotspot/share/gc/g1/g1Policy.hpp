@@ -35,6 +35,7 @@
 #include "gc/g1/g1Predictions.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/shared/gcCause.hpp"
+#include "gc/shared/workerPolicy.hpp"
 #include "runtime/atomic.hpp"
 #include "utilities/pair.hpp"
 #include "utilities/ticks.hpp"
@@ -109,6 +110,9 @@ class G1Policy: public CHeapObj<mtGC> {
 
   G1ConcurrentStartToMixedTimeTracker _concurrent_start_to_mixed;
 
+  // Measured scaling of the evacuation phase of young collections.
+  WorkerEfficiencyTracker _evacuation_efficiency;
+
   bool should_update_surv_rate_group_predictors() {
     return collector_state()->in_young_only_phase() && !collector_state()->mark_or_rebuild_in_progress();
   }
@@ -122,6 +126,8 @@ class G1Policy: public CHeapObj<mtGC> {
 
   G1OldGenAllocationTracker* old_gen_alloc_tracker() { return &_old_gen_alloc_tracker; }
 
+  WorkerEfficiencyTracker* evacuation_efficiency() { return &_evacuation_efficiency; }
+
   void set_region_eden(G1HeapRegion* hr) {
     hr->set_eden();
     hr->install_surv_rate_group(_eden_surv_rate_group);
@@ -30,6 +30,8 @@
 #include "gc/g1/g1CardTable.inline.hpp"
 #include "gc/g1/g1CardTableEntryClosure.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1CollectionSetCandidates.inline.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
 #include "gc/g1/g1FromCardCache.hpp"
@@ -54,6 +56,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -559,6 +563,25 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
       return ((uintptr_t)addr) % sizeof(Word) == 0;
     }
 
+    // Number of cards examined at once when skipping over long runs of
+    // (non-)dirty cards.
+    static const size_t CardsPerBlock = 4 * sizeof(Word);
+
+    // Returns the index of the first card in the word with a set bit in mask,
+    // which must only have bits in ExpandedToScanMask set.
+    static uint first_card_in_mask(Word mask) {
+      assert(mask != 0, "must have at least one card");
+#ifdef VM_LITTLE_ENDIAN
+      return count_trailing_zeros(mask) / BitsPerByte;
+#else
+      return count_leading_zeros(mask) / BitsPerByte;
+#endif
+    }
+
+    static Word load_word(const CardValue* card, uint i = 0) {
+      return reinterpret_cast<const Word*>(card)[i];
+    }
+
     CardValue* find_first_dirty_card(CardValue* i_card) const {
       while (!is_word_aligned(i_card)) {
         if (is_card_dirty(i_card)) {
@@ -567,18 +590,20 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
         i_card++;
       }
 
+      // Skip blocks without any dirty card, then locate the dirty card in the
+      // first non-empty word.
+      for (/* empty */; i_card + CardsPerBlock <= _end_card; i_card += CardsPerBlock) {
+        Word all_words = load_word(i_card, 0) & load_word(i_card, 1) &
+                         load_word(i_card, 2) & load_word(i_card, 3);
+        if ((~all_words & ExpandedToScanMask) != 0) {
+          break;
+        }
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word dirty_cards_in_word = ~load_word(i_card) & ExpandedToScanMask;
+        if (dirty_cards_in_word != 0) {
+          return i_card + first_card_in_mask(dirty_cards_in_word);
         }
       }
 
@@ -593,18 +618,18 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
         i_card++;
       }
 
+      for (/* empty */; i_card + CardsPerBlock <= _end_card; i_card += CardsPerBlock) {
+        Word any_words = load_word(i_card, 0) | load_word(i_card, 1) |
+                         load_word(i_card, 2) | load_word(i_card, 3);
+        if ((any_words & ExpandedToScanMask) != 0) {
+          break;
+        }
+      }
+
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word non_dirty_cards_in_word = load_word(i_card) & ExpandedToScanMask;
+        if (non_dirty_cards_in_word != 0) {
+          return i_card + first_card_in_mask(non_dirty_cards_in_word);
         }
       }
 
@@ -1468,6 +1493,116 @@ G1AbstractSubTask* G1RemSet::create_cleanup_after_scan_heap_roots_task() {
   return _scan_state->create_cleanup_after_scan_heap_roots_task();
 }
 
+class G1CollectRemSetMemoryClosure : public HeapRegionClosure {
+public:
+  struct RegionInfo {
+    G1HeapRegion* _r;
+    size_t _mem_size;
+
+    RegionInfo() : _r(nullptr), _mem_size(0) { }
+    RegionInfo(G1HeapRegion* r, size_t mem_size) : _r(r), _mem_size(mem_size) { }
+  };
+
+private:
+  GrowableArray<RegionInfo> _regions;
+  size_t _total_mem_size;
+
+public:
+  G1CollectRemSetMemoryClosure(uint max_regions) :
+    _regions(max_regions, mtGC),
+    _total_mem_size(0) { }
+
+  bool do_heap_region(G1HeapRegion* r) override {
+    HeapRegionRemSet* rem_set = r->rem_set();
+    if ((r->is_old() || r->is_humongous()) && rem_set->is_tracked()) {
+      size_t mem_size = rem_set->card_set_mem_size();
+      _regions.append(RegionInfo(r, mem_size));
+      _total_mem_size += mem_size;
+    }
+    return false;
+  }
+
+  static int compare_mem_size(RegionInfo* ri1, RegionInfo* ri2) {
+    // Larger card sets first.
+    if (ri1->_mem_size > ri2->_mem_size) {
+      return -1;
+    } else if (ri1->_mem_size < ri2->_mem_size) {
+      return 1;
+    }
+    return 0;
+  }
+
+  GrowableArray<RegionInfo>* regions() { return &_regions; }
+  size_t total_mem_size() const { return _total_mem_size; }
+};
+
+void G1RemSet::enforce_memory_budget() {
+  assert_at_safepoint_on_vm_thread();
+
+  if (G1RemSetMemoryBudget == 0) {
+    return;
+  }
+
+  G1CollectRemSetMemoryClosure cl(_g1h->num_regions());
+  _g1h->heap_region_iterate(&cl);
+
+  size_t total = cl.total_mem_size();
+  if (total <= G1RemSetMemoryBudget) {
+    return;
+  }
+  size_t const initial_total = total;
+
+  // Coarsen the card sets taking up the most memory first. This bounds the number
+  // of regions which subsequently need to scan more cards when merging their
+  // remembered sets.
+  GrowableArray<G1CollectRemSetMemoryClosure::RegionInfo>* regions = cl.regions();
+  regions->sort(G1CollectRemSetMemoryClosure::compare_mem_size);
+
+  uint num_coarsened = 0;
+  for (int i = 0; i < regions->length() && total > G1RemSetMemoryBudget; i++) {
+    HeapRegionRemSet* rem_set = regions->at(i)._r->rem_set();
+    if (rem_set->coarsen_card_set() == 0) {
+      continue;
+    }
+    size_t mem_size = rem_set->card_set_mem_size();
+    size_t prev_mem_size = regions->at(i)._mem_size;
+    total -= prev_mem_size - MIN2(prev_mem_size, mem_size);
+    num_coarsened++;
+  }
+
+  // Stop tracking the remembered sets of the marking candidates least likely to
+  // be collected, i.e. the ones with the lowest gc efficiency, while keeping the
+  // minimum number of candidates required for the mixed phase.
+  G1CollectionSetCandidates* candidates = _g1h->collection_set()->candidates();
+  G1CollectionCandidateList& marking_regions = candidates->marking_regions();
+
+  uint num_candidates = marking_regions.length();
+  uint min_candidates = MIN2(_g1p->calc_min_old_cset_length(candidates->last_marking_candidates_length()),
+                             num_candidates);
+  uint first_to_drop = num_candidates;
+  while (total > G1RemSetMemoryBudget && first_to_drop > min_candidates) {
+    G1HeapRegion* r = marking_regions.at(first_to_drop - 1)._r;
+    if (!r->rem_set()->is_complete()) {
+      break;
+    }
+    total -= MIN2(total, r->rem_set()->card_set_mem_size());
+    first_to_drop--;
+  }
+
+  G1CollectionCandidateRegionList to_drop;
+  for (uint i = first_to_drop; i < num_candidates; i++) {
+    to_drop.append(marking_regions.at(i)._r);
+  }
+  candidates->remove(&to_drop);
+  for (G1HeapRegion* r : to_drop) {
+    r->rem_set()->clear(true /* only_cardset */);
+  }
+
+  log_debug(gc, remset)("Remembered set memory budget " SIZE_FORMAT "B exceeded (" SIZE_FORMAT "B): "
+                        "coarsened %u regions, dropped %u candidates, now " SIZE_FORMAT "B",
+                        G1RemSetMemoryBudget, initial_total, num_coarsened, to_drop.length(), total);
+}
+
 void G1RemSet::print_coarsen_stats() {
   LogTarget(Debug, gc, remset) lt;
   if (lt.is_enabled()) {
@@ -101,6 +101,10 @@ class G1RemSet: public CHeapObj<mtGC> {
 
   // Print coarsening stats.
   void print_coarsen_stats();
+  // Bring the memory used by remembered set card sets below G1RemSetMemoryBudget,
+  // first by coarsening the largest card sets, then by no longer tracking the
+  // remembered sets of the least efficient collection set candidates from marking.
+  void enforce_memory_budget();
   // Creates a task for cleaining up temporary data structures and the
   // card table, removing temporary duplicate detection information.
   G1AbstractSubTask* create_cleanup_after_scan_heap_roots_task();
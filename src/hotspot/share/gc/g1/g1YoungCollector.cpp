@@ -49,6 +49,7 @@
 #include "gc/g1/g1YoungGCAllocationFailureInjector.hpp"
 #include "gc/g1/g1YoungGCPostEvacuateTasks.hpp"
 #include "gc/g1/g1YoungGCPreEvacuateTasks.hpp"
+#include "gc/shared/allocationSiteSurvival.hpp"
 #include "gc/shared/concurrentGCBreakpoints.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/gcTimer.hpp"
@@ -471,6 +472,7 @@ void G1YoungCollector::set_young_collection_default_active_worker_threads(){
   uint active_workers = WorkerPolicy::calc_active_workers(workers()->max_workers(),
                                                           workers()->active_workers(),
                                                           Threads::number_of_non_daemon_threads());
+  active_workers = policy()->evacuation_efficiency()->adjust(active_workers, "Evacuation");
   active_workers = workers()->set_active_workers(active_workers);
   log_info(gc,task)("Using %u workers of %u for evacuation", active_workers, workers()->max_workers());
 }
@@ -995,6 +997,8 @@ void G1YoungCollector::post_evacuate_collection_set(G1EvacInfo* evacuation_info,
 
   post_evacuate_cleanup_2(per_thread_states, evacuation_info);
 
+  _g1h->rem_set()->enforce_memory_budget();
+
   // Regions in the collection set candidates are roots for the marking (they are
   // not marked through considering they are very likely to be reclaimed soon.
   // They need to be enqueued explicitly compared to survivor regions.
@@ -1039,6 +1043,13 @@ G1YoungCollector::G1YoungCollector(GCCause::Cause gc_cause) :
 {
 }
 
+class G1IsInYoungClosure : public BoolObjectClosure {
+  G1CollectedHeap* _g1h;
+public:
+  G1IsInYoungClosure(G1CollectedHeap* g1h) : _g1h(g1h) { }
+  bool do_object_b(oop obj) override { return _g1h->is_in_young(obj); }
+};
+
 void G1YoungCollector::collect() {
   // Do timing/tracing/statistics/pre- and post-logging/verification work not
   // directly related to the collection. They should not be accounted for in
@@ -1093,6 +1104,11 @@ void G1YoungCollector::collect() {
     }
     post_evacuate_collection_set(jtm.evacuation_info(), &per_thread_states);
 
+    if (_g1h->allocation_site_survival() != nullptr) {
+      G1IsInYoungClosure is_young(_g1h);
+      _g1h->allocation_site_survival()->update_after_young_gc(&is_young);
+    }
+
     // Refine the type of a concurrent mark operation now that we did the
     // evacuation, eventually aborting it.
     _concurrent_operation_is_full_mark = policy()->concurrent_operation_is_full_mark("Revise IHOP");
@@ -334,6 +334,32 @@
           "scan cost related prediction samples. A sample must involve "    \
           "the same or more than this number of code roots to be used.")    \
                                                                             \
+  product(bool, G1NUMAEvacuateToWorkerNode, false, EXPERIMENTAL,            \
+          "With UseNUMA, copy evacuated objects into survivor and old "     \
+          "regions on the memory node of the evacuating worker thread "     \
+          "instead of the node of the region they are evacuated from.")     \
+                                                                            \
+  product(size_t, G1RemSetMemoryBudget, 0, EXPERIMENTAL,                    \
+          "Upper bound in bytes for the memory used by the card sets of "   \
+          "remembered sets. If exceeded after a young collection, G1 "      \
+          "first coarsens the largest card sets and then stops tracking "   \
+          "remembered sets of the least efficient collection set "          \
+          "candidates. 0 means no limit.")                                  \
+          range(0, max_uintx)                                               \
+                                                                            \
+  product(ccstr, G1AnalyticsFile, nullptr, EXPERIMENTAL,                    \
+          "File to seed pause time prediction statistics from at startup "  \
+          "and to save them to at exit. Statistics saved with a different " \
+          "maximum heap size, number of GC threads or processor count "     \
+          "are ignored.")                                                   \
+                                                                            \
+  product(bool, G1HumongousBestFit, false, EXPERIMENTAL,                    \
+          "Place humongous objects into the shortest run of free regions "  \
+          "that fits instead of the first one. Keeps long runs of free "    \
+          "regions available for large humongous objects and reduces "      \
+          "fragmentation caused by interleaving humongous objects with "    \
+          "old regions.")                                                   \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
@@ -158,6 +158,17 @@ class MutableNUMASpace : public MutableSpace {
 
 public:
   GrowableArray<LGRPSpace*>* lgrp_spaces() const     { return _lgrp_spaces;       }
+
+  // Index of the lgrp space containing p, or -1.
+  int lgrp_space_index_containing(const void* p) const {
+    for (int i = 0; i < lgrp_spaces()->length(); i++) {
+      if (lgrp_spaces()->at(i)->space()->contains(p)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+  uint lgrp_id_at(int index) const                   { return lgrp_spaces()->at(index)->lgrp_id(); }
   MutableNUMASpace(size_t alignment);
   virtual ~MutableNUMASpace();
   // Space initialization.
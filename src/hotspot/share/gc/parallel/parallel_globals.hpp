@@ -41,7 +41,12 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, PSNUMAPromotion, false, EXPERIMENTAL,                       \
+          "With UseNUMA, promote objects from eden into old generation "    \
+          "buffers placed on the NUMA node of the eden chunk the objects "  \
+          "were allocated in")
 
 // end of GC_PARALLEL_FLAGS
 
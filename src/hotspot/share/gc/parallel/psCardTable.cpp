@@ -111,6 +111,7 @@ void PSCardTable::scan_obj_with_limit(PSPromotionManager* pm,
 
 void PSCardTable::pre_scavenge(uint active_workers) {
   _preprocessing_active_workers = active_workers;
+  _next_stripe_to_scavenge = 0;
 }
 
 // The "shadow" table is a copy of the card table entries of the current stripe.
@@ -309,13 +310,21 @@ void PSCardTable::preprocess_card_table_parallel(Func&& object_start,
 //      +===============+        slice 2
 //      ...
 //
-// In this case there are 4 threads, so 4 stripes.  A GC thread first works on
-// its stripe within slice 0 and then moves to its stripe in the next slice
-// until it has exceeded the top of the generation.  The distance to stripe in
-// the next slice is calculated based on the number of stripes. After finishing
-// stripe 0 in slice 0, the thread finds the stripe 0 in slice 1 by adding
-// slice_size_in_words to the start of stripe 0 in slice 0 to get to the start
-// of stripe 0 in slice 1.
+// In this case there are 4 threads, so 4 stripes.  During preprocessing a GC
+// thread first works on its stripe within slice 0 and then moves to its stripe
+// in the next slice until it has exceeded the top of the generation.  The
+// distance to stripe in the next slice is calculated based on the number of
+// stripes. After finishing stripe 0 in slice 0, the thread finds the stripe 0
+// in slice 1 by adding slice_size_in_words to the start of stripe 0 in slice 0
+// to get to the start of stripe 0 in slice 1.
+//
+// The scavenge itself does not use this fixed assignment. Dirty cards are
+// rarely spread evenly, so threads claim the next unprocessed stripe in
+// address order instead. A thread that is done with a sparse part of the
+// generation then continues with stripes that are still unclaimed, instead
+// of idling while another thread works through a densely dirtied region.
+// Each thread still sees increasing addresses, as the object start cache
+// below requires.
 
 // Scavenging and accesses to the card table are strictly limited to the stripe.
 // In particular scavenging of an object crossing stripe boundaries is shared
@@ -364,11 +373,17 @@ void PSCardTable::scavenge_contents_parallel(ObjectStartArray* start_array,
   // Scavenge
   cached_obj = {nullptr, old_gen_bottom};
   const size_t stripe_size_in_words = num_cards_in_stripe * _card_size_in_words;
-  const size_t slice_size_in_words = stripe_size_in_words * n_stripes;
-  HeapWord* cur_addr = old_gen_bottom + stripe_index * stripe_size_in_words;
-  for (/* empty */; cur_addr < old_gen_top; cur_addr += slice_size_in_words) {
-    HeapWord* const stripe_l = cur_addr;
-    HeapWord* const stripe_r = MIN2(cur_addr + stripe_size_in_words,
+  const size_t num_stripes_total = pointer_delta(old_gen_top, old_gen_bottom) / stripe_size_in_words + 1;
+  while (true) {
+    const size_t stripe = Atomic::fetch_then_add(&_next_stripe_to_scavenge, (size_t)1);
+    if (stripe >= num_stripes_total) {
+      break;
+    }
+    HeapWord* const stripe_l = old_gen_bottom + stripe * stripe_size_in_words;
+    if (stripe_l >= old_gen_top) {
+      break;
+    }
+    HeapWord* const stripe_r = MIN2(stripe_l + stripe_size_in_words,
                                     old_gen_top);
 
     process_range(object_start, pm, stripe_l, stripe_r);
@@ -80,6 +80,10 @@ void ParCompactionManager::initialize(ParMarkBitMap* mbm) {
   _objarray_task_queues = new ObjArrayTaskQueueSet(parallel_gc_threads);
   _region_task_queues = new RegionTaskQueueSet(parallel_gc_threads);
 
+  bool const numa_local_steal = UseNUMA && UseNUMALocalTaskQueueSteal;
+  _oop_task_queues->set_steal_policy(UseBatchedTaskQueueSteal, numa_local_steal);
+  _objarray_task_queues->set_steal_policy(UseBatchedTaskQueueSteal, numa_local_steal);
+
   _preserved_marks_set = new PreservedMarksSet(true);
   _preserved_marks_set->init(parallel_gc_threads);
 
@@ -184,6 +184,9 @@ class ParCompactionManager : public CHeapObj<mtGC> {
   static bool steal_objarray(int queue_num, ObjArrayTask& t);
   static bool steal(int queue_num, size_t& region);
 
+  // Record the NUMA node of the worker for NUMA-local stealing of marking tasks.
+  static inline void update_numa_node(uint worker_id);
+
   // Process tasks remaining on any marking stack
   void follow_marking_stacks();
   inline bool marking_stacks_empty() const;
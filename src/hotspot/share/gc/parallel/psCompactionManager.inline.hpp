@@ -77,6 +77,11 @@ inline bool ParCompactionManager::steal(int queue_num, size_t& region) {
   return region_task_queues()->steal(queue_num, region);
 }
 
+inline void ParCompactionManager::update_numa_node(uint worker_id) {
+  oop_task_queues()->update_numa_node(worker_id);
+  _objarray_task_queues->update_numa_node(worker_id);
+}
+
 inline void ParCompactionManager::push(oop obj) {
   _oop_stack.push(obj);
 }
@@ -465,50 +465,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
         return false;
       }
 
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
+      summarize_region(split_info, cur_region, dest_addr, words);
       dest_addr += words;
     }
 
@@ -519,6 +476,71 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+HeapWord* ParallelCompactData::summarize_range(SplitInfo& split_info,
+                                               size_t beg_region, size_t end_region,
+                                               HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    _region_data[cur_region].set_destination(dest_addr);
+
+    size_t words = _region_data[cur_region].data_size();
+    if (words > 0) {
+      summarize_region(split_info, cur_region, dest_addr, words);
+      dest_addr += words;
+    }
+  }
+  return dest_addr;
+}
+
+void ParallelCompactData::summarize_region(SplitInfo& split_info, size_t cur_region,
+                                           HeapWord* dest_addr, size_t words)
+{
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+}
+
 #ifdef ASSERT
 void ParallelCompactData::verify_clear(const PSVirtualSpace* vspace)
 {
@@ -851,18 +873,154 @@ bool PSParallelCompact::reassess_maximum_compaction(bool maximum_compaction,
   return false;
 }
 
+// Summarizes the old space in parallel.  The regions are split into stripes;
+// counting the live words of all stripes first gives the destination of each
+// stripe, after which the stripes are summarized independently.
+class PCOldSpaceSummary : public StackObj {
+  // Number of regions a worker claims at a time.
+  static const size_t StripeRegions = 1024;
+
+  template <typename Function>
+  class StripeTask : public WorkerTask {
+    Function _f;
+    const size_t _num_stripes;
+    volatile size_t _next_stripe;
+
+  public:
+    StripeTask(const char* name, Function f, size_t num_stripes) :
+      WorkerTask(name), _f(f), _num_stripes(num_stripes), _next_stripe(0) {}
+
+    void work(uint worker_id) override {
+      for (size_t i = Atomic::fetch_then_add(&_next_stripe, (size_t)1);
+           i < _num_stripes;
+           i = Atomic::fetch_then_add(&_next_stripe, (size_t)1)) {
+        _f(i);
+      }
+    }
+  };
+
+  ParallelCompactData& _sd;
+  const MutableSpace* const _space;
+  const size_t _beg_region;
+  const size_t _end_region;
+  const size_t _num_stripes;
+  // Live words and first region that is not full of each stripe.
+  size_t* const _live_words;
+  size_t* const _first_not_full;
+  // Destination of the first region of each stripe that is past the dense prefix.
+  HeapWord** const _dest;
+
+  size_t stripe_beg(size_t i) const { return _beg_region + i * StripeRegions; }
+  size_t stripe_end(size_t i) const { return MIN2(stripe_beg(i) + StripeRegions, _end_region); }
+
+  template <typename Function>
+  void run(const char* name, Function f) {
+    StripeTask<Function> task(name, f, _num_stripes);
+    WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+    uint num_workers = (uint)MIN2((size_t)workers.active_workers(), _num_stripes);
+    workers.run_task(&task, MAX2(num_workers, 1u));
+  }
+
+public:
+  PCOldSpaceSummary(ParallelCompactData& sd, const MutableSpace* space) :
+    _sd(sd),
+    _space(space),
+    _beg_region(sd.addr_to_region_idx(space->bottom())),
+    _end_region(sd.addr_to_region_idx(sd.region_align_up(space->top()))),
+    _num_stripes(align_up(_end_region - _beg_region, StripeRegions) / StripeRegions),
+    _live_words(NEW_C_HEAP_ARRAY(size_t, _num_stripes, mtGC)),
+    _first_not_full(NEW_C_HEAP_ARRAY(size_t, _num_stripes, mtGC)),
+    _dest(NEW_C_HEAP_ARRAY(HeapWord*, _num_stripes, mtGC)) {}
+
+  ~PCOldSpaceSummary() {
+    FREE_C_HEAP_ARRAY(size_t, _live_words);
+    FREE_C_HEAP_ARRAY(size_t, _first_not_full);
+    FREE_C_HEAP_ARRAY(HeapWord*, _dest);
+  }
+
+  // Same as ParallelCompactData::live_words_in_space().
+  size_t live_words(HeapWord** full_region_prefix_end) {
+    run("PSSummaryLiveWords", [&](size_t i) {
+      const size_t end = stripe_end(i);
+      size_t stripe_live_words = 0;
+      size_t first_not_full = end;
+      for (size_t cur_region = stripe_beg(i); cur_region < end; ++cur_region) {
+        size_t live_words_in_region = _sd.region(cur_region)->data_size();
+        if (first_not_full == end && live_words_in_region < ParallelCompactData::RegionSize) {
+          first_not_full = cur_region;
+        }
+        stripe_live_words += live_words_in_region;
+      }
+      _live_words[i] = stripe_live_words;
+      _first_not_full[i] = first_not_full;
+    });
+
+    size_t total_live_words = 0;
+    *full_region_prefix_end = nullptr;
+    for (size_t i = 0; i < _num_stripes; ++i) {
+      if (*full_region_prefix_end == nullptr && _first_not_full[i] < stripe_end(i)) {
+        *full_region_prefix_end = _sd.region_to_addr(_first_not_full[i]);
+      }
+      total_live_words += _live_words[i];
+    }
+    if (*full_region_prefix_end == nullptr) {
+      // All regions are full of live objs.
+      assert(_sd.is_region_aligned(_space->top()), "inv");
+      *full_region_prefix_end = _space->top();
+    }
+    return total_live_words;
+  }
+
+  // Summarize the dense prefix ending at dense_prefix_end and the regions
+  // after it, which are compacted into the space itself.  Returns the new top.
+  HeapWord* summarize(SplitInfo& split_info, HeapWord* dense_prefix_end) {
+    const size_t dense_prefix_region = _sd.addr_to_region_idx(dense_prefix_end);
+    HeapWord* dest_addr = dense_prefix_end;
+    for (size_t i = 0; i < _num_stripes; ++i) {
+      _dest[i] = dest_addr;
+      if (stripe_end(i) <= dense_prefix_region) {
+        continue;
+      }
+      if (stripe_beg(i) <= dense_prefix_region) {
+        // Count again, as fill_dense_prefix_end may have changed the first
+        // region past the dense prefix.
+        for (size_t cur_region = dense_prefix_region; cur_region < stripe_end(i); ++cur_region) {
+          dest_addr += _sd.region(cur_region)->data_size();
+        }
+      } else {
+        dest_addr += _live_words[i];
+      }
+    }
+
+    run("PSSummaryDestinations", [&](size_t i) {
+      const size_t beg = stripe_beg(i);
+      const size_t end = stripe_end(i);
+      if (beg < dense_prefix_region) {
+        _sd.summarize_dense_prefix(_sd.region_to_addr(beg),
+                                   _sd.region_to_addr(MIN2(end, dense_prefix_region)));
+      }
+      if (end > dense_prefix_region) {
+        DEBUG_ONLY(HeapWord* stripe_end_addr =)
+          _sd.summarize_range(split_info, MAX2(beg, dense_prefix_region), end, _dest[i]);
+        assert(i + 1 == _num_stripes || stripe_end_addr == _dest[i + 1], "stripes must be contiguous");
+      }
+    });
+    return dest_addr;
+  }
+};
+
 void PSParallelCompact::summary_phase(bool maximum_compaction)
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
 
   MutableSpace* const old_space = _space_info[old_space_id].space();
   {
+    PCOldSpaceSummary old_space_summary(_summary_data, old_space);
     size_t total_live_words = 0;
     HeapWord* full_region_prefix_end = nullptr;
     {
       // old-gen
-      size_t live_words = _summary_data.live_words_in_space(old_space,
-                                                            &full_region_prefix_end);
+      size_t live_words = old_space_summary.live_words(&full_region_prefix_end);
       total_live_words += live_words;
     }
     // young-gen
@@ -887,12 +1045,11 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
 
     if (dense_prefix_end != old_space->bottom()) {
       fill_dense_prefix_end(id);
-      _summary_data.summarize_dense_prefix(old_space->bottom(), dense_prefix_end);
     }
-    _summary_data.summarize(_space_info[id].split_info(),
-                            dense_prefix_end, old_space->top(), nullptr,
-                            dense_prefix_end, old_space->end(),
-                            _space_info[id].new_top_addr());
+    HeapWord* new_top = old_space_summary.summarize(_space_info[id].split_info(),
+                                                    dense_prefix_end);
+    assert(new_top <= old_space->end(), "old space must fit into itself");
+    _space_info[id].set_new_top(new_top);
   }
 
   // Summarize the remaining spaces in the young gen.  The initial target space
@@ -1229,6 +1386,7 @@ class MarkFromRootsTask : public WorkerTask {
 
   virtual void work(uint worker_id) {
     ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+    ParCompactionManager::update_numa_node(worker_id);
     cm->create_marking_stats_cache();
     PCMarkAndPushClosure mark_and_push_closure(cm);
 
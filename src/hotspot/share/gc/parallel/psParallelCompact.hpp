@@ -373,6 +373,14 @@ class ParallelCompactData
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Summarize the regions in [beg_region, end_region), whose data is copied
+  // contiguously starting at dest_addr and must fit without splitting.
+  // Disjoint ranges can be summarized in parallel.  Returns the end of the
+  // copied data.
+  HeapWord* summarize_range(SplitInfo& split_info,
+                            size_t beg_region, size_t end_region,
+                            HeapWord* dest_addr);
+
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
     clear_range(addr_to_region_idx(beg), addr_to_region_idx(end));
@@ -398,6 +406,12 @@ class ParallelCompactData
 #endif  // #ifdef ASSERT
 
 private:
+  // Set the destination_count of cur_region, whose data (words) is copied to
+  // dest_addr, and the source_region of the destination regions it is the
+  // first to be copied to.
+  void summarize_region(SplitInfo& split_info, size_t cur_region,
+                        HeapWord* dest_addr, size_t words);
+
   bool initialize_region_data(size_t heap_size);
   PSVirtualSpace* create_vspace(size_t count, size_t element_size);
 
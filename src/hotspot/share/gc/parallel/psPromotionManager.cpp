@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "classfile/javaClasses.inline.hpp"
+#include "gc/parallel/mutableNUMASpace.hpp"
 #include "gc/parallel/mutableSpace.hpp"
 #include "gc/parallel/parallelScavengeHeap.hpp"
 #include "gc/parallel/psOldGen.hpp"
@@ -48,6 +49,8 @@ PSPromotionManager::PSScannerTasksQueueSet* PSPromotionManager::_stack_array_dep
 PreservedMarksSet*             PSPromotionManager::_preserved_marks_set = nullptr;
 PSOldGen*                      PSPromotionManager::_old_gen = nullptr;
 MutableSpace*                  PSPromotionManager::_young_space = nullptr;
+MutableNUMASpace*              PSPromotionManager::_numa_eden_space = nullptr;
+size_t                         PSPromotionManager::_numa_old_lab_size = 0;
 
 void PSPromotionManager::initialize() {
   ParallelScavengeHeap* heap = ParallelScavengeHeap::heap();
@@ -55,6 +58,14 @@ void PSPromotionManager::initialize() {
   _old_gen = heap->old_gen();
   _young_space = heap->young_gen()->to_space();
 
+  if (UseNUMA && PSNUMAPromotion) {
+    _numa_eden_space = static_cast<MutableNUMASpace*>(heap->young_gen()->eden_space());
+    // The pages of NUMA old LABs are placed on their node when the LAB is
+    // allocated, make the LABs large enough to amortize the cost of that.
+    const size_t page_words = os::vm_page_size() / HeapWordSize;
+    _numa_old_lab_size = align_up(MAX2(OldPLABSize, 16 * page_words), page_words);
+  }
+
   const uint promotion_manager_num = ParallelGCThreads;
 
   // To prevent false sharing, we pad the PSPromotionManagers
@@ -176,6 +187,16 @@ PSPromotionManager::PSPromotionManager() {
   // We set the old lab's start array.
   _old_lab.set_start_array(old_gen()->start_array());
 
+  _numa_old_labs = nullptr;
+  _numa_old_labs_count = 0;
+  if (_numa_eden_space != nullptr) {
+    _numa_old_labs_count = _numa_eden_space->lgrp_spaces()->length();
+    _numa_old_labs = new PSOldPromotionLAB[_numa_old_labs_count];
+    for (int i = 0; i < _numa_old_labs_count; i++) {
+      _numa_old_labs[i].set_start_array(old_gen()->start_array());
+    }
+  }
+
   if (ParallelGCThreads == 1) {
     _target_stack_size = 0;
   } else {
@@ -203,6 +224,9 @@ void PSPromotionManager::reset() {
 
   lab_base = old_gen()->object_space()->top();
   _old_lab.initialize(MemRegion(lab_base, (size_t)0));
+  for (int i = 0; i < _numa_old_labs_count; i++) {
+    _numa_old_labs[i].initialize(MemRegion(lab_base, (size_t)0));
+  }
   _old_gen_is_full = false;
 
   _promotion_failed_info.reset();
@@ -258,12 +282,35 @@ void PSPromotionManager::flush_labs() {
   if (!_old_lab.is_flushed())
     _old_lab.flush();
 
+  for (int i = 0; i < _numa_old_labs_count; i++) {
+    if (!_numa_old_labs[i].is_flushed()) {
+      _numa_old_labs[i].flush();
+    }
+  }
+
   // Let PSScavenge know if we overflowed
   if (_young_gen_is_full) {
     PSScavenge::set_survivor_overflow(true);
   }
 }
 
+void PSPromotionManager::numa_bias_old_lab(MemRegion mr, int index) {
+  // Large pages cannot be placed page by page, the LAB still keeps the
+  // objects promoted from one node together.
+  if (UseLargePages) {
+    return;
+  }
+  const size_t page_size = os::vm_page_size();
+  char* start = align_up((char*)mr.start(), page_size);
+  char* end = align_down((char*)mr.end(), page_size);
+  if (end > start) {
+    // The LAB is above the old gen top and holds no objects, so its pages can be
+    // released and faulted in again on the requested node.
+    os::free_memory(start, end - start, page_size);
+    os::numa_make_local(start, end - start, checked_cast<int>(_numa_eden_space->lgrp_id_at(index)));
+  }
+}
+
 template <class T> void PSPromotionManager::process_array_chunk_work(
                                                  oop obj,
                                                  int start, int end) {
@@ -46,6 +46,7 @@
 // FIX ME FIX ME Add a destructor, and don't rely on the user to drain/flush/deallocate!
 //
 
+class MutableNUMASpace;
 class MutableSpace;
 class PSOldGen;
 class ParCompactionManager;
@@ -63,6 +64,8 @@ class PSPromotionManager {
   static PreservedMarksSet*             _preserved_marks_set;
   static PSOldGen*                      _old_gen;
   static MutableSpace*                  _young_space;
+  static MutableNUMASpace*              _numa_eden_space;
+  static size_t                         _numa_old_lab_size;
 
 #if TASKQUEUE_STATS
   size_t                              _array_chunk_pushes;
@@ -81,6 +84,11 @@ class PSPromotionManager {
   bool                                _young_gen_is_full;
   bool                                _old_gen_is_full;
 
+  // Old LABs for objects promoted from the eden chunk of each NUMA node,
+  // used with PSNUMAPromotion.
+  PSOldPromotionLAB*                  _numa_old_labs;
+  int                                 _numa_old_labs_count;
+
   PSScannerTasksQueue                 _claimed_stack_depth;
 
   uint                                _target_stack_size;
@@ -99,6 +107,11 @@ class PSPromotionManager {
 
   inline static PSPromotionManager* manager_array(uint index);
 
+  // Index of the NUMA old LAB obj should be promoted into, or -1.
+  inline int numa_old_lab_index(oop obj) const;
+  // Place the pages of a newly allocated NUMA old LAB on its node.
+  void numa_bias_old_lab(MemRegion mr, int index);
+
   template <class T> void  process_array_chunk_work(oop obj,
                                                     int start, int end);
   void process_array_chunk(PartialArrayScanTask task);
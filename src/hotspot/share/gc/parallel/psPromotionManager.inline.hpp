@@ -27,6 +27,7 @@
 
 #include "gc/parallel/psPromotionManager.hpp"
 
+#include "gc/parallel/mutableNUMASpace.hpp"
 #include "gc/parallel/parallelScavengeHeap.hpp"
 #include "gc/parallel/parMarkBitMap.inline.hpp"
 #include "gc/parallel/psOldGen.hpp"
@@ -50,6 +51,14 @@ inline PSPromotionManager* PSPromotionManager::manager_array(uint index) {
   return &_manager_array[index];
 }
 
+inline int PSPromotionManager::numa_old_lab_index(oop obj) const {
+  if (_numa_old_labs_count == 0 || !_numa_eden_space->contains(obj)) {
+    return -1;
+  }
+  int index = _numa_eden_space->lgrp_space_index_containing(obj);
+  return index < _numa_old_labs_count ? index : -1;
+}
+
 inline void PSPromotionManager::push_depth(ScannerTask task) {
   claimed_stack_depth()->push(task);
 }
@@ -165,6 +174,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
 
   oop new_obj = nullptr;
   bool new_obj_is_tenured = false;
+  PSOldPromotionLAB* old_lab = &_old_lab;
   size_t new_obj_size = o->size();
 
   // Find the objects age, MT safe.
@@ -207,26 +217,36 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
     }
 #endif  // #ifndef PRODUCT
 
-    new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
+    size_t old_lab_size = OldPLABSize;
+    int numa_index = numa_old_lab_index(o);
+    if (numa_index >= 0) {
+      old_lab = &_numa_old_labs[numa_index];
+      old_lab_size = _numa_old_lab_size;
+    }
+
+    new_obj = cast_to_oop(old_lab->allocate(new_obj_size));
     new_obj_is_tenured = true;
 
     if (new_obj == nullptr) {
       if (!_old_gen_is_full) {
         // Do we allocate directly, or flush and refill?
-        if (new_obj_size > (OldPLABSize / 2)) {
+        if (new_obj_size > (old_lab_size / 2)) {
           // Allocate this object directly
           new_obj = cast_to_oop(old_gen()->allocate(new_obj_size));
           promotion_trace_event(new_obj, o, new_obj_size, age, true, nullptr);
         } else {
           // Flush and fill
-          _old_lab.flush();
+          old_lab->flush();
 
-          HeapWord* lab_base = old_gen()->allocate(OldPLABSize);
+          HeapWord* lab_base = old_gen()->allocate(old_lab_size);
           if(lab_base != nullptr) {
-            _old_lab.initialize(MemRegion(lab_base, OldPLABSize));
+            if (numa_index >= 0) {
+              numa_bias_old_lab(MemRegion(lab_base, old_lab_size), numa_index);
+            }
+            old_lab->initialize(MemRegion(lab_base, old_lab_size));
             // Try the old lab allocation again.
-            new_obj = cast_to_oop(_old_lab.allocate(new_obj_size));
-            promotion_trace_event(new_obj, o, new_obj_size, age, true, &_old_lab);
+            new_obj = cast_to_oop(old_lab->allocate(new_obj_size));
+            promotion_trace_event(new_obj, o, new_obj_size, age, true, old_lab);
           }
         }
       }
@@ -297,7 +317,7 @@ inline oop PSPromotionManager::copy_unmarked_to_survivor_space(oop o,
     assert(o->forwardee() == forwardee, "invariant");
 
     if (new_obj_is_tenured) {
-      _old_lab.unallocate_object(cast_from_oop<HeapWord*>(new_obj), new_obj_size);
+      old_lab->unallocate_object(cast_from_oop<HeapWord*>(new_obj), new_obj_size);
     } else {
       _young_lab.unallocate_object(cast_from_oop<HeapWord*>(new_obj), new_obj_size);
     }
@@ -158,6 +158,47 @@ CardTable::CardValue* CardTableRS::find_first_dirty_card(CardValue* const start_
   return end_card;
 }
 
+// Word-iteration counterpart of find_first_dirty_card, skipping long
+// consecutive dirty cards. Returns the first clean card or end_card.
+CardTable::CardValue* CardTableRS::skip_dirty_cards(CardValue* const start_card,
+                                                    CardValue* const end_card) {
+  using Word = uintptr_t;
+
+  CardValue* current_card = start_card;
+
+  while (!is_aligned(current_card, sizeof(Word))) {
+    if (current_card >= end_card) {
+      return end_card;
+    }
+    if (is_clean(current_card)) {
+      return current_card;
+    }
+    ++current_card;
+  }
+
+  // Word comparison. Clean cards are all-ones bytes, so a word contains a
+  // clean card iff its complement contains a zero byte.
+  const Word low_bits = ~(Word)0 / 0xff;
+  const Word high_bits = low_bits << 7;
+  while (current_card + sizeof(Word) <= end_card) {
+    Word inverted = ~*reinterpret_cast<Word*>(current_card);
+    if (((inverted - low_bits) & ~inverted & high_bits) != 0) {
+      // Found a clean card in this word; fall back to per-CardValue comparison.
+      break;
+    }
+    current_card += sizeof(Word);
+  }
+
+  // Per-CardValue comparison.
+  for (/* empty */; current_card < end_card; ++current_card) {
+    if (is_clean(current_card)) {
+      return current_card;
+    }
+  }
+
+  return end_card;
+}
+
 // Because non-objArray objs can be imprecisely marked (only the obj-start card
 // is dirty instead of the part containing old-to-young pointers), if the
 // obj-start of a non-objArray is dirty, all cards that the obj resides on,
@@ -169,9 +210,9 @@ CardTable::CardValue* CardTableRS::find_first_clean_card(CardValue* const start_
                                                          CardValue* const end_card,
                                                          Func& object_start) {
   for (CardValue* current_card = start_card; current_card < end_card; /* empty */) {
-    if (is_dirty(current_card)) {
-      current_card++;
-      continue;
+    current_card = skip_dirty_cards(current_card, end_card);
+    if (current_card == end_card) {
+      break;
     }
 
     // A potential candidate.
@@ -51,6 +51,9 @@ class CardTableRS : public CardTable {
   static CardValue* find_first_dirty_card(CardValue* start_card,
                                           CardValue* end_card);
 
+  static CardValue* skip_dirty_cards(CardValue* start_card,
+                                     CardValue* end_card);
+
   template<typename Func>
   CardValue* find_first_clean_card(CardValue* start_card,
                                    CardValue* end_card,
@@ -48,6 +48,7 @@
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
 #include "gc/shared/modRefBarrierSet.hpp"
 #include "gc/shared/preservedMarks.inline.hpp"
 #include "gc/shared/referencePolicy.hpp"
@@ -55,6 +56,7 @@
 #include "gc/shared/space.hpp"
 #include "gc/shared/strongRootsScope.hpp"
 #include "gc/shared/weakProcessor.hpp"
+#include "memory/allocation.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
@@ -81,6 +83,11 @@ PreservedMarksSet       SerialFullGC::_preserved_overflow_stack_set(false /* in_
 size_t                  SerialFullGC::_preserved_count = 0;
 size_t                  SerialFullGC::_preserved_count_max = 0;
 PreservedMark*          SerialFullGC::_preserved_marks = nullptr;
+MarkBitMap              SerialFullGC::_mark_bitmap;
+MemRegion               SerialFullGC::_mark_bitmap_storage;
+MemRegion               SerialFullGC::_side_tables_covered;
+HeapWord**              SerialFullGC::_block_destinations = nullptr;
+size_t                  SerialFullGC::_num_blocks = 0;
 STWGCTimer*             SerialFullGC::_gc_timer        = nullptr;
 SerialOldTracer*        SerialFullGC::_gc_tracer       = nullptr;
 
@@ -95,6 +102,52 @@ MarkAndPushClosure SerialFullGC::mark_and_push_closure(ClassLoaderData::_claim_s
 CLDToOopClosure    SerialFullGC::follow_cld_closure(&mark_and_push_closure, ClassLoaderData::_claim_stw_fullgc_mark);
 CLDToOopClosure    SerialFullGC::adjust_cld_closure(&adjust_pointer_closure, ClassLoaderData::_claim_stw_fullgc_adjust);
 
+inline bool SerialFullGC::is_marked(oop obj) {
+  if (SerialFullGCSideTableForwarding) {
+    return _mark_bitmap.is_marked(obj);
+  }
+  return obj->is_gc_marked();
+}
+
+inline size_t SerialFullGC::block_index(const HeapWord* addr) {
+  return pointer_delta(addr, _side_tables_covered.start()) >> LogWordsPerBlock;
+}
+
+inline HeapWord* SerialFullGC::block_destination(size_t index) {
+  assert(index < _num_blocks, "out of bounds");
+  return _block_destinations[index];
+}
+
+inline void SerialFullGC::set_block_destination(size_t index, HeapWord* dest) {
+  assert(index < _num_blocks, "out of bounds");
+  _block_destinations[index] = dest;
+}
+
+inline void SerialFullGC::mark_in_side_table(HeapWord* addr) {
+  _mark_bitmap.mark(addr);
+}
+
+inline HeapWord* SerialFullGC::find_next_marked_addr(HeapWord* start, HeapWord* end) {
+  return _mark_bitmap.get_next_marked_addr(start, end);
+}
+
+HeapWord* SerialFullGC::new_address(oop obj) {
+  assert(SerialFullGCSideTableForwarding, "only with side tables");
+  HeapWord* const addr = cast_from_oop<HeapWord*>(obj);
+  const size_t index = block_index(addr);
+  HeapWord* const block_start = _side_tables_covered.start() + (index << LogWordsPerBlock);
+
+  // Objects starting in the same block before obj are compacted right before it.
+  HeapWord* new_addr = block_destination(index);
+  HeapWord* cur = find_next_marked_addr(block_start, addr);
+  while (cur < addr) {
+    size_t size = cast_to_oop(cur)->size();
+    new_addr += size;
+    cur = find_next_marked_addr(cur + size, addr);
+  }
+  return new_addr;
+}
+
 class DeadSpacer : StackObj {
   size_t _allowed_deadspace_words;
   bool _active;
@@ -173,6 +226,12 @@ class Compacter {
   // Used for BOT update
   TenuredGeneration* _old_gen;
 
+  // With side tables, the block of the last object given a new address, the
+  // space it was compacted into and where the next object of the block goes.
+  size_t _cur_block;
+  uint _cur_block_space;
+  HeapWord* _cur_block_end;
+
   HeapWord* get_compaction_top(uint index) const {
     return _spaces[index]._compaction_top;
   }
@@ -227,6 +286,39 @@ class Compacter {
     }
   }
 
+  // Like alloc(), but keeps the objects starting in one block contiguous, as
+  // required for computing new addresses from the side tables.
+  HeapWord* alloc_in_block(HeapWord* addr, size_t words) {
+    const size_t block = SerialFullGC::block_index(addr);
+    HeapWord* const result = alloc(words);
+    if (block != _cur_block) {
+      _cur_block = block;
+      _cur_block_space = _index;
+      _cur_block_end = result + words;
+      SerialFullGC::set_block_destination(block, result);
+      return result;
+    }
+    if (result == _cur_block_end) {
+      _cur_block_end += words;
+      return result;
+    }
+
+    // The object did not fit into the space the earlier objects of its block
+    // were compacted into.  Move all of them to the current space; they are
+    // the last allocations in the previous space.
+    HeapWord* const block_dest = SerialFullGC::block_destination(block);
+    const size_t block_words = pointer_delta(_cur_block_end, block_dest);
+    assert(_spaces[_cur_block_space]._compaction_top == _cur_block_end, "block must be last");
+    _spaces[_cur_block_space]._compaction_top = block_dest;
+    _spaces[_index]._compaction_top = result;
+
+    HeapWord* const new_block_dest = alloc(block_words + words);
+    SerialFullGC::set_block_destination(block, new_block_dest);
+    _cur_block_space = _index;
+    _cur_block_end = new_block_dest + block_words + words;
+    return new_block_dest + block_words;
+  }
+
   static void forward_obj(oop obj, HeapWord* new_addr) {
     prefetch_write_scan(obj);
     if (cast_from_oop<HeapWord*>(obj) != new_addr) {
@@ -239,6 +331,9 @@ class Compacter {
   }
 
   static HeapWord* find_next_live_addr(HeapWord* start, HeapWord* end) {
+    if (SerialFullGCSideTableForwarding) {
+      return SerialFullGC::find_next_marked_addr(start, end);
+    }
     for (HeapWord* i_addr = start; i_addr < end; /* empty */) {
       prefetch_read_scan(i_addr);
       oop obj = cast_to_oop(i_addr);
@@ -267,6 +362,19 @@ class Compacter {
     return obj_size;
   }
 
+  // Relocate using the side tables.  The mark word was left untouched by
+  // marking and moves along with the object.
+  static size_t relocate_to(HeapWord* addr, HeapWord* new_addr) {
+    prefetch_read_scan(addr);
+    prefetch_write_copy(new_addr);
+
+    size_t obj_size = cast_to_oop(addr)->size();
+    if (addr != new_addr) {
+      Copy::aligned_conjoint_words(addr, new_addr, obj_size);
+    }
+    return obj_size;
+  }
+
 public:
   explicit Compacter(SerialHeap* heap) {
     // In this order so that heap is compacted towards old-gen.
@@ -283,6 +391,9 @@ class Compacter {
     }
     _index = 0;
     _old_gen = heap->old_gen();
+    _cur_block = SIZE_MAX;
+    _cur_block_space = 0;
+    _cur_block_end = nullptr;
   }
 
   void phase2_calculate_new_addr() {
@@ -298,16 +409,28 @@ class Compacter {
       while (cur_addr < top) {
         oop obj = cast_to_oop(cur_addr);
         size_t obj_size = obj->size();
-        if (obj->is_gc_marked()) {
-          HeapWord* new_addr = alloc(obj_size);
-          forward_obj(obj, new_addr);
+        if (SerialFullGC::is_marked(obj)) {
+          if (SerialFullGCSideTableForwarding) {
+            prefetch_write_scan(obj);
+            alloc_in_block(cur_addr, obj_size);
+          } else {
+            HeapWord* new_addr = alloc(obj_size);
+            forward_obj(obj, new_addr);
+          }
           cur_addr += obj_size;
         } else {
           // Skipping the current known-unmarked obj
           HeapWord* next_live_addr = find_next_live_addr(cur_addr + obj_size, top);
           if (dead_spacer.insert_deadspace(cur_addr, next_live_addr)) {
             // Register space for the filler obj
-            alloc(pointer_delta(next_live_addr, cur_addr));
+            if (SerialFullGCSideTableForwarding) {
+              // Mark the filler so that it counts towards the new addresses
+              // of the objects after it in its block.
+              SerialFullGC::mark_in_side_table(cur_addr);
+              alloc_in_block(cur_addr, pointer_delta(next_live_addr, cur_addr));
+            } else {
+              alloc(pointer_delta(next_live_addr, cur_addr));
+            }
           } else {
             if (!record_first_dead_done) {
               record_first_dead(i, cur_addr);
@@ -334,7 +457,7 @@ class Compacter {
 
       while (cur_addr < top) {
         prefetch_write_scan(cur_addr);
-        if (cur_addr < first_dead || cast_to_oop(cur_addr)->is_gc_marked()) {
+        if (cur_addr < first_dead || SerialFullGC::is_marked(cast_to_oop(cur_addr))) {
           size_t size = cast_to_oop(cur_addr)->oop_iterate_size(&SerialFullGC::adjust_pointer_closure);
           cur_addr += size;
         } else {
@@ -345,24 +468,55 @@ class Compacter {
     }
   }
 
+  void compact_with_side_tables(uint index, HeapWord* cur_addr, HeapWord* top) {
+    // Jump over consecutive (in-place) live-objs-chunk
+    oop first = cast_to_oop(cur_addr);
+    if (!SerialFullGC::is_marked(first) || SerialFullGC::new_address(first) == cur_addr) {
+      cur_addr = get_first_dead(index);
+    }
+
+    size_t cur_block = SIZE_MAX;
+    HeapWord* new_addr = nullptr;
+    while (cur_addr < top) {
+      if (!SerialFullGC::is_marked(cast_to_oop(cur_addr))) {
+        cur_addr = *(HeapWord**) cur_addr;
+        continue;
+      }
+      // Objects of a block are moved in address order, so only the first one
+      // visited needs a lookup.
+      size_t block = SerialFullGC::block_index(cur_addr);
+      if (block != cur_block) {
+        cur_block = block;
+        new_addr = SerialFullGC::new_address(cast_to_oop(cur_addr));
+      }
+      size_t obj_size = relocate_to(cur_addr, new_addr);
+      cur_addr += obj_size;
+      new_addr += obj_size;
+    }
+  }
+
   void phase4_compact() {
     for (uint i = 0; i < _num_spaces; ++i) {
       ContiguousSpace* space = get_space(i);
       HeapWord* cur_addr = space->bottom();
       HeapWord* top = space->top();
 
-      // Check if the first obj inside this space is forwarded.
-      if (!cast_to_oop(cur_addr)->is_forwarded()) {
-        // Jump over consecutive (in-place) live-objs-chunk
-        cur_addr = get_first_dead(i);
-      }
-
-      while (cur_addr < top) {
+      if (SerialFullGCSideTableForwarding) {
+        compact_with_side_tables(i, cur_addr, top);
+      } else {
+        // Check if the first obj inside this space is forwarded.
         if (!cast_to_oop(cur_addr)->is_forwarded()) {
-          cur_addr = *(HeapWord**) cur_addr;
-          continue;
+          // Jump over consecutive (in-place) live-objs-chunk
+          cur_addr = get_first_dead(i);
+        }
+
+        while (cur_addr < top) {
+          if (!cast_to_oop(cur_addr)->is_forwarded()) {
+            cur_addr = *(HeapWord**) cur_addr;
+            continue;
+          }
+          cur_addr += relocate(cur_addr);
         }
-        cur_addr += relocate(cur_addr);
       }
 
       // Reset top and unused memory
@@ -394,7 +548,7 @@ void SerialFullGC::follow_array(objArrayOop array) {
 }
 
 void SerialFullGC::follow_object(oop obj) {
-  assert(obj->is_gc_marked(), "should be marked");
+  assert(is_marked(obj), "should be marked");
   if (obj->is_objArray()) {
     // Handle object arrays explicitly to allow them to
     // be split into chunks if needed.
@@ -423,7 +577,7 @@ void SerialFullGC::follow_stack() {
   do {
     while (!_marking_stack.is_empty()) {
       oop obj = _marking_stack.pop();
-      assert (obj->is_gc_marked(), "p must be marked");
+      assert (is_marked(obj), "p must be marked");
       follow_object(obj);
     }
     // Process ObjArrays one at a time to avoid marking stack bloat.
@@ -444,7 +598,7 @@ template <class T> void SerialFullGC::follow_root(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
+    if (!is_marked(obj)) {
       mark_object(obj);
       follow_object(obj);
     }
@@ -583,6 +737,30 @@ void SerialFullGC::deallocate_stacks() {
   _objarray_stack.clear(true);
 }
 
+void SerialFullGC::allocate_side_tables() {
+  // The tables are allocated for each collection and released afterwards, so
+  // they take no memory between full GCs.  Fresh memory is already cleared.
+  SerialHeap* gch = SerialHeap::heap();
+  assert(gch->young_gen()->reserved().end() == gch->old_gen()->reserved().start(), "young gen precedes old gen");
+  MemRegion heap(gch->young_gen()->reserved().start(), gch->old_gen()->reserved().end());
+  _side_tables_covered = heap;
+  size_t bitmap_size = MarkBitMap::compute_size(heap.byte_size());
+  HeapWord* bitmap_base = MmapArrayAllocator<HeapWord>::allocate(bitmap_size / HeapWordSize, mtGC);
+  _mark_bitmap_storage = MemRegion(bitmap_base, bitmap_size / HeapWordSize);
+  _mark_bitmap.initialize(heap, _mark_bitmap_storage);
+
+  _num_blocks = align_up(heap.word_size(), (size_t)1 << LogWordsPerBlock) >> LogWordsPerBlock;
+  _block_destinations = MmapArrayAllocator<HeapWord*>::allocate(_num_blocks, mtGC);
+}
+
+void SerialFullGC::deallocate_side_tables() {
+  MmapArrayAllocator<HeapWord>::free(_mark_bitmap_storage.start(), _mark_bitmap_storage.word_size());
+  _mark_bitmap_storage = MemRegion();
+  MmapArrayAllocator<HeapWord*>::free(_block_destinations, _num_blocks);
+  _block_destinations = nullptr;
+  _num_blocks = 0;
+}
+
 void SerialFullGC::mark_object(oop obj) {
   if (StringDedup::is_enabled() &&
       java_lang_String::is_instance(obj) &&
@@ -590,6 +768,13 @@ void SerialFullGC::mark_object(oop obj) {
     _string_dedup_requests->add(obj);
   }
 
+  if (SerialFullGCSideTableForwarding) {
+    // The mark word is left untouched.
+    _mark_bitmap.mark(obj);
+    ContinuationGCSupport::transform_stack_chunk(obj);
+    return;
+  }
+
   // some marks may contain information we need to preserve so we store them away
   // and overwrite the mark.  We'll restore it at the end of serial full GC.
   markWord mark = obj->mark();
@@ -606,7 +791,7 @@ template <class T> void SerialFullGC::mark_and_push(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
+    if (!is_marked(obj)) {
       mark_object(obj);
       _marking_stack.push(obj);
     }
@@ -624,7 +809,12 @@ template <class T> void SerialFullGC::adjust_pointer(T* p) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
     assert(Universe::heap()->is_in(obj), "should be in heap");
 
-    if (obj->is_forwarded()) {
+    if (SerialFullGCSideTableForwarding) {
+      HeapWord* new_addr = new_address(obj);
+      if (new_addr != cast_from_oop<HeapWord*>(obj)) {
+        RawAccess<IS_NOT_NULL>::oop_store(p, cast_to_oop(new_addr));
+      }
+    } else if (obj->is_forwarded()) {
       oop new_obj = obj->forwardee();
       assert(is_object_aligned(new_obj), "oop must be aligned");
       RawAccess<IS_NOT_NULL>::oop_store(p, new_obj);
@@ -663,7 +853,7 @@ void SerialFullGC::restore_marks() {
 
 SerialFullGC::IsAliveClosure   SerialFullGC::is_alive;
 
-bool SerialFullGC::IsAliveClosure::do_object_b(oop p) { return p->is_gc_marked(); }
+bool SerialFullGC::IsAliveClosure::do_object_b(oop p) { return is_marked(p); }
 
 SerialFullGC::KeepAliveClosure SerialFullGC::keep_alive;
 
@@ -693,6 +883,9 @@ void SerialFullGC::invoke_at_safepoint(bool clear_all_softrefs) {
   gch->old_gen()->save_used_region();
 
   allocate_stacks();
+  if (SerialFullGCSideTableForwarding) {
+    allocate_side_tables();
+  }
 
   phase1_mark(clear_all_softrefs);
 
@@ -740,6 +933,9 @@ void SerialFullGC::invoke_at_safepoint(bool clear_all_softrefs) {
   restore_marks();
 
   deallocate_stacks();
+  if (SerialFullGCSideTableForwarding) {
+    deallocate_side_tables();
+  }
 
   SerialFullGC::_string_dedup_requests->flush();
 
@@ -26,6 +26,7 @@
 #define SHARE_GC_SERIAL_SERIALFULLGC_HPP
 
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/markBitMap.hpp"
 #include "gc/shared/preservedMarks.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
@@ -91,6 +92,14 @@ class SerialFullGC : AllStatic {
   static size_t                          _preserved_count_max;
   static PreservedMark*                  _preserved_marks;
 
+  // Side tables used with SerialFullGCSideTableForwarding: the marks, and
+  // the destination of the first live object of each block.
+  static MarkBitMap                      _mark_bitmap;
+  static MemRegion                       _mark_bitmap_storage;
+  static MemRegion                       _side_tables_covered;
+  static HeapWord**                      _block_destinations;
+  static size_t                          _num_blocks;
+
   static AlwaysTrueClosure               _always_true_closure;
   static ReferenceProcessor*             _ref_processor;
 
@@ -129,6 +138,20 @@ class SerialFullGC : AllStatic {
 
   static void follow_stack();   // Empty marking stack.
 
+  // With SerialFullGCSideTableForwarding, the heap is divided into blocks
+  // of 2^LogWordsPerBlock words. Live objects starting in one block are
+  // compacted contiguously, so the new address of an object follows from the
+  // destination of its block and the sizes of the live objects before it.
+  static const int LogWordsPerBlock = 6;
+
+  static inline bool is_marked(oop obj);
+  static inline size_t block_index(const HeapWord* addr);
+  static inline HeapWord* block_destination(size_t index);
+  static inline void set_block_destination(size_t index, HeapWord* dest);
+  static inline void mark_in_side_table(HeapWord* addr);
+  static inline HeapWord* find_next_marked_addr(HeapWord* start, HeapWord* end);
+  static HeapWord* new_address(oop obj);
+
   template <class T> static void adjust_pointer(T* p);
 
   // Check mark and maybe push on marking stack
@@ -141,6 +164,8 @@ class SerialFullGC : AllStatic {
   // Temporary data structures for traversal and storing/restoring marks
   static void allocate_stacks();
   static void deallocate_stacks();
+  static void allocate_side_tables();
+  static void deallocate_side_tables();
 
   // Call backs for marking
   static void mark_object(oop obj);
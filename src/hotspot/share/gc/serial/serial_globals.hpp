@@ -35,6 +35,11 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(bool, SerialFullGCSideTableForwarding, false, EXPERIMENTAL,       \
+          "Keep marks in a side bitmap and compute new object addresses "   \
+          "from a per-block destination table during serial full GC, so "   \
+          "that mark words never need to be preserved")                     \
 
 // end of GC_SERIAL_FLAGS
 
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/allocationLatency.hpp"
+#include "jvm_io.h"
+#include "runtime/perfData.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+volatile jlong AllocationLatencyHistogram::_buckets[AllocationLatencyHistogram::NumBuckets] = {};
+
+class AllocationLatencyHistogram::BucketSampler : public PerfLongSampleHelper {
+  const uint _bucket;
+
+public:
+  BucketSampler(uint bucket) : _bucket(bucket) {}
+
+  virtual jlong take_sample() {
+    return AllocationLatencyHistogram::count(_bucket);
+  }
+};
+
+uint AllocationLatencyHistogram::bucket_for(jlong nanos) {
+  jlong micros = nanos / (NANOUNITS / MICROUNITS);
+  if (micros <= 0) {
+    return 0;
+  }
+  return MIN2((uint)log2i(micros) + 1, NumBuckets - 1);
+}
+
+void AllocationLatencyHistogram::initialize() {
+  if (!AllocationLatencyStatistics || !UsePerfData) {
+    return;
+  }
+  EXCEPTION_MARK;
+  for (uint i = 0; i < NumBuckets; i++) {
+    char name[64];
+    if (i < NumBuckets - 1) {
+      jio_snprintf(name, sizeof(name), "allocLatency.below" JLONG_FORMAT "us", (jlong)1 << i);
+    } else {
+      jio_snprintf(name, sizeof(name), "allocLatency.atLeast" JLONG_FORMAT "us", (jlong)1 << (i - 1));
+    }
+    PerfDataManager::create_counter(SUN_GC, name, PerfData::U_Events,
+                                    new BucketSampler(i), CHECK);
+  }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#ifndef SHARE_GC_SHARED_ALLOCATIONLATENCY_HPP
+#define SHARE_GC_SHARED_ALLOCATIONLATENCY_HPP
+
+#include "gc/shared/gc_globals.hpp"
+#include "memory/allStatic.hpp"
+#include "runtime/atomic.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
+
+// Histogram of the time allocations spend in the MemAllocator slow path,
+// that is refilling the TLAB or allocating outside of it, including any
+// collection the allocating thread has to wait for.  Bucket 0 counts
+// allocations that took less than a microsecond, bucket i for 0 < i <
+// NumBuckets - 1 those that took [2^(i-1), 2^i) microseconds and the last
+// bucket everything slower.  Enabled with AllocationLatencyStatistics and
+// published as sun.gc.allocLatency.* jvmstat counters.
+class AllocationLatencyHistogram : AllStatic {
+public:
+  static const uint NumBuckets = 24;
+
+private:
+  static volatile jlong _buckets[NumBuckets];
+
+  class BucketSampler;
+
+public:
+  static void initialize();
+
+  static uint bucket_for(jlong nanos);
+
+  static void record(jlong nanos) {
+    Atomic::inc(&_buckets[bucket_for(nanos)]);
+  }
+
+  static jlong count(uint bucket) {
+    assert(bucket < NumBuckets, "bucket %u out of range", bucket);
+    return Atomic::load(&_buckets[bucket]);
+  }
+};
+
+// Records the time from construction to destruction in the histogram.
+class AllocationLatencyTimer : public StackObj {
+  Ticks _start;
+
+public:
+  AllocationLatencyTimer() {
+    if (AllocationLatencyStatistics) {
+      _start = Ticks::now();
+    }
+  }
+
+  ~AllocationLatencyTimer() {
+    if (AllocationLatencyStatistics) {
+      AllocationLatencyHistogram::record((jlong)(Ticks::now() - _start).nanoseconds());
+    }
+  }
+};
+
+#endif // SHARE_GC_SHARED_ALLOCATIONLATENCY_HPP
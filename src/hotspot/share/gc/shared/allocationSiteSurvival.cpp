@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/allocationSiteSurvival.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
+#include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/method.hpp"
+#include "oops/weakHandle.inline.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/vframe.inline.hpp"
+
+// Number of long-lived allocation sites to print after a young collection
+static const int MaxPrintedSites = 10;
+
+AllocationSiteSurvival::AllocationSiteSurvival(size_t sample_rate) :
+  _lock(Mutex::nosafepoint, "AllocationSiteSurvival_lock"),
+  _table(),
+  _pending(),
+  _sample_rate(sample_rate),
+  _allocations(0) {
+  assert(sample_rate > 0, "Sample rate should be positive");
+}
+
+AllocationSiteSurvival::~AllocationSiteSurvival() {
+  release_pending();
+}
+
+void AllocationSiteSurvival::sample(JavaThread* thread, oop obj) {
+  size_t allocation = Atomic::add(&_allocations, (size_t)1);
+  if (allocation % _sample_rate != 0) {
+    return;
+  }
+  if (!thread->has_last_Java_frame() || _pending.length() >= MaxPendingSamples) {
+    return;
+  }
+
+  // Find the allocating Java frame outside of the lock, it is only this
+  // thread that is touching its stack.
+  Site site;
+  {
+    vframeStream vfst(thread, false /* stop_at_java_call_stub */, false /* process_frames */);
+    if (vfst.at_end()) {
+      return;
+    }
+    Method* m = vfst.method();
+    site._holder = m->method_holder();
+    site._idnum = m->orig_method_idnum();
+    site._bci = vfst.bci();
+  }
+
+  WeakHandle handle(Universe::vm_weak(), obj);
+  {
+    MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+    if (_pending.length() < MaxPendingSamples) {
+      bool created = false;
+      Entry* e = _table.put_if_absent(site, &created);
+      if (created) {
+        e->_site = site;
+        e->_sampled = 0;
+        e->_died = 0;
+        e->_tenured = 0;
+      }
+      e->_sampled++;
+      Sample s = { site, handle };
+      _pending.append(s);
+      return;
+    }
+  }
+  // Lost the race for the last pending slot.
+  handle.release(Universe::vm_weak());
+}
+
+void AllocationSiteSurvival::update_after_young_gc(BoolObjectClosure* is_young) {
+  assert_at_safepoint();
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+
+  int i = 0;
+  while (i < _pending.length()) {
+    Sample& s = _pending.at(i);
+    oop obj = s._obj.peek();
+    if (obj != nullptr && is_young->do_object_b(obj)) {
+      // Survived, but not tenured yet; decided by a later collection.
+      i++;
+      continue;
+    }
+    Entry* e = _table.get(s._site);
+    assert(e != nullptr, "sampled site must be recorded");
+    if (obj == nullptr) {
+      e->_died++;
+    } else {
+      e->_tenured++;
+    }
+    s._obj.release(Universe::vm_weak());
+    _pending.delete_at(i);
+  }
+
+  print_statistics();
+}
+
+bool AllocationSiteSurvival::is_long_lived(const Entry& e) const {
+  size_t resolved = e._died + e._tenured;
+  return resolved >= MinResolvedSamples &&
+         e._tenured * 100 >= resolved * AllocationSiteLongLivedPercent;
+}
+
+void AllocationSiteSurvival::release_pending() {
+  for (int i = 0; i < _pending.length(); i++) {
+    _pending.at(i)._obj.release(Universe::vm_weak());
+  }
+  _pending.clear();
+}
+
+void AllocationSiteSurvival::discard_samples() {
+  assert_at_safepoint();
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+  release_pending();
+}
+
+void AllocationSiteSurvival::purge() {
+  assert_at_safepoint();
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+  release_pending();
+
+  struct UnlinkAll {
+    bool do_entry(const Site& site, const Entry& e) { return true; }
+  } unlink_all;
+  _table.unlink(&unlink_all);
+}
+
+int AllocationSiteSurvival::compare_by_tenured(Entry* a, Entry* b) {
+  if (a->_tenured > b->_tenured) return -1;
+  if (a->_tenured < b->_tenured) return 1;
+  return 0;
+}
+
+void AllocationSiteSurvival::print_statistics() {
+  LogTarget(Debug, gc, alloc) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+
+  ResourceMark rm;
+  GrowableArray<Entry> long_lived;
+  _table.iterate_all([&](const Site& site, const Entry& e) {
+    if (is_long_lived(e)) {
+      long_lived.append(e);
+    }
+  });
+
+  LogStream ls(lt);
+  ls.print_cr("Allocation sites: %d tracked, %d long-lived, %d samples pending",
+              _table.number_of_entries(), long_lived.length(), _pending.length());
+
+  LogTarget(Trace, gc, alloc) lt_sites;
+  if (!lt_sites.is_enabled()) {
+    return;
+  }
+  long_lived.sort(compare_by_tenured);
+  LogStream ls_sites(lt_sites);
+  for (int i = 0; i < MIN2(long_lived.length(), MaxPrintedSites); i++) {
+    const Entry& e = long_lived.at(i);
+    size_t resolved = e._died + e._tenured;
+    Method* m = e._site._holder->method_with_idnum(e._site._idnum);
+    ls_sites.print_cr("  %5.1f%% tenured (" SIZE_FORMAT " of " SIZE_FORMAT ")  %s @ bci %d",
+                      percent_of(e._tenured, resolved), e._tenured, resolved,
+                      m != nullptr ? m->external_name() : e._site._holder->external_name(),
+                      e._site._bci);
+  }
+}
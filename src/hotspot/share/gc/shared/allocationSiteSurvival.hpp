@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_GC_SHARED_ALLOCATIONSITESURVIVAL_HPP
+#define SHARE_GC_SHARED_ALLOCATIONSITESURVIVAL_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/weakHandle.hpp"
+#include "runtime/mutex.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/resourceHash.hpp"
+
+class BoolObjectClosure;
+class InstanceKlass;
+class JavaThread;
+
+// Tracks how often objects allocated at a Java allocation site (method and
+// bci) live long enough to be promoted out of the young generation.
+//
+// A sample of the allocations that refill a TLAB or are allocated outside
+// of one is remembered through weak handles.  After each young collection
+// the collector reports which of the sampled objects are no longer young:
+// a cleared handle counts as the object dying young, an object outside of
+// the young generation as the object being tenured.  Sites that are
+// tenured for at least AllocationSiteLongLivedPercent of their resolved
+// samples are considered long-lived, which is the information pretenuring
+// decisions need.
+//
+// Sites refer to their method by holder and method idnum, which stay valid
+// across class redefinition.  The collector must call purge() when classes
+// are unloaded and discard_samples() after a full collection.
+class AllocationSiteSurvival : public CHeapObj<mtGC> {
+  struct Site {
+    InstanceKlass* _holder;
+    u2 _idnum;
+    int _bci;
+
+    static unsigned hash(const Site& s) {
+      return primitive_hash(s._holder) ^ ((unsigned)s._idnum << 16) ^ (unsigned)s._bci;
+    }
+    static bool equals(const Site& a, const Site& b) {
+      return a._holder == b._holder && a._idnum == b._idnum && a._bci == b._bci;
+    }
+  };
+
+  struct Entry {
+    Site _site;
+    size_t _sampled;
+    size_t _died;
+    size_t _tenured;
+  };
+
+  struct Sample {
+    Site _site;
+    WeakHandle _obj;
+  };
+
+  typedef ResourceHashtable<Site, Entry, 1009, AnyObj::C_HEAP, mtGC,
+                            Site::hash, Site::equals> SiteTable;
+
+  // Maximum number of sampled objects that wait for their fate.
+  static const int MaxPendingSamples = 4096;
+  // Minimum number of resolved samples before judging a site.
+  static const size_t MinResolvedSamples = 8;
+
+  Mutex _lock;
+  SiteTable _table;
+  GrowableArrayCHeap<Sample, mtGC> _pending;
+  const size_t _sample_rate;
+  volatile size_t _allocations;
+
+  bool is_long_lived(const Entry& e) const;
+  void release_pending();
+  void print_statistics();
+
+  static int compare_by_tenured(Entry* a, Entry* b);
+
+public:
+  explicit AllocationSiteSurvival(size_t sample_rate);
+  ~AllocationSiteSurvival();
+
+  // Called for allocations that refilled the TLAB or were done outside of
+  // a TLAB; remembers every _sample_rate-th of them.
+  void sample(JavaThread* thread, oop obj);
+
+  // Resolves the pending samples after a young collection.  is_young tells
+  // whether an object is still in the young generation.  Must be called at
+  // a safepoint after weak references have been processed.
+  void update_after_young_gc(BoolObjectClosure* is_young);
+
+  // Forget the pending samples, e.g. after a full collection promoted all
+  // of them regardless of their age.
+  void discard_samples();
+
+  // Forget all sites and samples, required when classes are unloaded.
+  void purge();
+};
+
+#endif // SHARE_GC_SHARED_ALLOCATIONSITESURVIVAL_HPP
@@ -27,6 +27,7 @@
 #include "classfile/classLoaderData.hpp"
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/allocTracer.hpp"
+#include "gc/shared/allocationLatency.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/collectedHeap.inline.hpp"
@@ -278,6 +279,8 @@ CollectedHeap::CollectedHeap() :
                              80, GCCause::to_string(_gc_lastcause), CHECK);
   }
 
+  AllocationLatencyHistogram::initialize();
+
   // Create the ring log
   if (LogEvents) {
     _gc_heap_log = new GCHeapLog();
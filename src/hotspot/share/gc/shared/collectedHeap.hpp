@@ -46,6 +46,7 @@
 // class defines the functions that a heap must implement, and contains
 // infrastructure common to all heaps.
 
+class AllocationSiteSurvival;
 class GCHeapLog;
 class GCHeapSummary;
 class GCTimer;
@@ -491,6 +492,10 @@ class CollectedHeap : public CHeapObj<mtGC> {
   // same thread-pool.
   virtual WorkerThreads* safepoint_workers() { return nullptr; }
 
+  // Allocation site survival statistics, if this collector tracks them.
+  // See AllocationSiteSurvivalSampleRate.
+  virtual AllocationSiteSurvival* allocation_site_survival() const { return nullptr; }
+
   // Support for object pinning. This is used by JNI Get*Critical()
   // and Release*Critical() family of functions. The GC must guarantee
   // that pinned objects never move and don't get reclaimed as garbage.
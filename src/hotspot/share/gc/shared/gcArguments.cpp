@@ -54,6 +54,11 @@ void GCArguments::initialize() {
     // If class unloading is disabled, also disable concurrent class unloading.
     FLAG_SET_CMDLINE(ClassUnloadingWithConcurrentMark, false);
   }
+
+  if (!UseG1GC && AllocationSiteSurvivalSampleRate > 0) {
+    warning("AllocationSiteSurvivalSampleRate is only supported by G1, ignoring");
+    FLAG_SET_DEFAULT(AllocationSiteSurvivalSampleRate, 0);
+  }
 }
 
 void GCArguments::initialize_heap_sizes() {
@@ -135,6 +135,19 @@
           "ParallelGCThreads parallel collectors will use for garbage "     \
           "collection work")                                                \
                                                                             \
+  product(bool, UseAdaptiveGCWorkerSizing, false, EXPERIMENTAL,             \
+          "Limit the number of workers used by parallel GC phases to the "  \
+          "parallelism they achieved in previous runs, as measured from "   \
+          "the per-worker phase times. Only reduces the number of "         \
+          "workers chosen by UseDynamicNumberOfGCThreads and reference "    \
+          "processing ergonomics.")                                         \
+                                                                            \
+  product(uint, GCWorkerEfficiencyTarget, 50, EXPERIMENTAL,                 \
+          "Percentage of a parallel phase that an average worker should "   \
+          "be busy for with UseAdaptiveGCWorkerSizing. Higher values "      \
+          "use fewer workers for phases that scale poorly.")                \
+          range(1, 100)                                                     \
+                                                                            \
   product(bool, InjectGCWorkerCreationFailure, false, DIAGNOSTIC,           \
              "Inject thread creation failures for "                         \
              "UseDynamicNumberOfGCThreads")                                 \
@@ -185,6 +198,15 @@
           "bigger than this")                                               \
           range(1, INT_MAX/3)                                               \
                                                                             \
+  product(bool, UseBatchedTaskQueueSteal, false, EXPERIMENTAL,              \
+          "When a marking worker steals from another worker's task queue, " \
+          "take up to half of the queue instead of a single task. Used by " \
+          "G1 concurrent marking, Parallel full GC marking and Shenandoah " \
+          "marking.")                                                       \
+                                                                            \
+  product(bool, UseNUMALocalTaskQueueSteal, false, EXPERIMENTAL,            \
+          "Prefer stealing from marking workers that run on the same NUMA " \
+          "node. Requires UseNUMA.")                                        \
                                                                             \
   product(bool, AlwaysPreTouch, false,                                      \
           "Force all freshly committed pages to be pre-touched")            \
@@ -212,6 +234,11 @@
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(bool, ParallelRefProcClaimLists, false, EXPERIMENTAL,             \
+          "Let parallel reference processing workers claim discovered "     \
+          "lists from all discovery queues instead of balancing the "       \
+          "lists to the processing degree first")                           \
+                                                                            \
   product(size_t, ReferencesPerThread, 1000, EXPERIMENTAL,                  \
                "Ergonomically start one thread for this amount of "         \
                "references for reference processing if "                    \
@@ -621,6 +648,34 @@
           "during parallel gc")                                             \
           range(0, 8 * 1024)                                                \
                                                                             \
+  product(uint, MarkingPrefetchDistance, 0, EXPERIMENTAL,                   \
+          "Number of marking stack entries that are prefetched ahead of "   \
+          "being processed in the G1, ZGC and Shenandoah marking loops. "   \
+          "0 disables prefetching.")                                        \
+          range(0, 15)                                                      \
+                                                                            \
+  product(uint, OopStorageThreadCacheSize, 0, EXPERIMENTAL,                 \
+          "Number of released JNI global and weak global handles each "     \
+          "Java thread caches for reuse before releasing them to their "    \
+          "OopStorage in bulk. 0 disables the cache.")                      \
+          range(0, 64)                                                      \
+                                                                            \
+  product(uint, AllocationSiteSurvivalSampleRate, 0, EXPERIMENTAL,          \
+          "Track how often objects from sampled allocation sites are "      \
+          "tenured, sampling one in this many TLAB refills and outside "    \
+          "TLAB allocations. 0 disables tracking. Only supported by G1.")   \
+          range(0, max_jint)                                                \
+                                                                            \
+  product(uint, AllocationSiteLongLivedPercent, 80, EXPERIMENTAL,           \
+          "Percentage of sampled objects from an allocation site that "     \
+          "must be tenured for the site to be considered long-lived")       \
+          range(1, 100)                                                     \
+                                                                            \
+  product(bool, AllocationLatencyStatistics, false, EXPERIMENTAL,           \
+          "Keep a histogram of the time allocations spend refilling "       \
+          "TLABs and allocating outside of them, and publish it as "        \
+          "jvmstat counters. Requires UsePerfData.")                        \
+                                                                            \
   product(uint, GCCardSizeInBytes, 512,                                     \
           "Card table entry size (in bytes) for card based collectors")     \
           range(128, NOT_LP64(512) LP64_ONLY(1024))                         \
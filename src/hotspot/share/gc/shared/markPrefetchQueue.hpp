@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_GC_SHARED_MARKPREFETCHQUEUE_HPP
+#define SHARE_GC_SHARED_MARKPREFETCHQUEUE_HPP
+
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+// A small FIFO ring that sits between a marking stack and the code that
+// processes its entries. Entries popped from the stack are pushed into the
+// ring, which prefetches the memory they refer to, and only come out of the
+// ring after distance more entries have been pushed behind them. Processing
+// of those entries then overlaps with the cache misses of the ring entries.
+//
+// Entries in the ring are invisible to work stealing and termination, so
+// users drain the ring before they offer termination, yield or abort.
+//
+// With a distance of 0 the ring is bypassed: push() hands back the entry
+// it was given right away.
+template <typename E, uint Capacity = 16>
+class MarkPrefetchQueue {
+  static_assert(is_power_of_2(Capacity), "Capacity must be a power of 2");
+
+  static const uint Mask = Capacity - 1;
+
+  E _elems[Capacity];
+  uint _head;     // Index of the oldest entry
+  uint _size;
+  const uint _distance;
+
+public:
+  static const uint MaxDistance = Capacity - 1;
+
+  MarkPrefetchQueue(uint distance) :
+    _head(0),
+    _size(0),
+    _distance(distance) {
+    assert(distance <= MaxDistance, "Distance %u is too large", distance);
+  }
+
+  bool is_empty() const { return _size == 0; }
+  uint size() const     { return _size; }
+
+  // Prefetches addr, unless it is null, and queues e. If there are then
+  // more than distance entries queued, takes out the oldest one into ready
+  // and returns true.
+  inline bool push(E e, const void* addr, E& ready);
+
+  // Takes out the oldest entry into e. Returns false if the ring is empty.
+  inline bool pop(E& e);
+};
+
+#endif // SHARE_GC_SHARED_MARKPREFETCHQUEUE_HPP
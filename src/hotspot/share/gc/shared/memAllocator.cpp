@@ -26,6 +26,8 @@
 #include "classfile/javaClasses.hpp"
 #include "classfile/vmClasses.hpp"
 #include "gc/shared/allocTracer.hpp"
+#include "gc/shared/allocationLatency.hpp"
+#include "gc/shared/allocationSiteSurvival.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/memAllocator.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
@@ -62,6 +64,7 @@ class MemAllocator::Allocation: StackObj {
   void notify_allocation_low_memory_detector();
   void notify_allocation_jfr_sampler();
   void notify_allocation_dtrace_sampler();
+  void notify_allocation_site_survival();
 #ifdef ASSERT
   void check_for_valid_allocation_state() const;
 #endif
@@ -235,6 +238,19 @@ void MemAllocator::Allocation::notify_allocation() {
   notify_allocation_jfr_sampler();
   notify_allocation_dtrace_sampler();
   notify_allocation_jvmti_sampler();
+  notify_allocation_site_survival();
+}
+
+void MemAllocator::Allocation::notify_allocation_site_survival() {
+  // Only sample the slow path allocations, the ones that refilled the TLAB
+  // or were allocated outside of it.
+  if (!_allocated_outside_tlab && _allocated_tlab_size == 0) {
+    return;
+  }
+  AllocationSiteSurvival* survival = Universe::heap()->allocation_site_survival();
+  if (survival != nullptr) {
+    survival->sample(_thread, obj());
+  }
 }
 
 HeapWord* MemAllocator::mem_allocate_outside_tlab(Allocation& allocation) const {
@@ -330,6 +346,8 @@ HeapWord* MemAllocator::mem_allocate(Allocation& allocation) const {
   // Allocation of an oop can always invoke a safepoint.
   debug_only(allocation._thread->check_for_valid_safepoint_state());
 
+  AllocationLatencyTimer timer;
+
   if (UseTLAB) {
     // Try refilling the TLAB and allocating the object in it.
     HeapWord* mem = mem_allocate_inside_tlab_slow(allocation);
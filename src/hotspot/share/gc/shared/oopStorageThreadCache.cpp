@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/oopStorage.hpp"
+#include "gc/shared/oopStorageThreadCache.hpp"
+#include "memory/universe.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/quickSort.hpp"
+
+OopStorageThreadCache::OopStorageThreadCache(uint capacity) :
+  _storage(nullptr),
+  _capacity(MIN2(capacity, MaxCapacity)),
+  _count(0),
+  _entries()
+{}
+
+OopStorageThreadCache::~OopStorageThreadCache() {
+  flush();
+}
+
+oop* OopStorageThreadCache::allocate(OopStorage* storage) {
+  if ((_count > 0) && (_storage == storage)) {
+    oop* result = _entries[--_count];
+    assert(Universe::heap()->contains_null(result),
+           "Cached entry not cleared: " PTR_FORMAT, p2i(result));
+    return result;
+  }
+  return storage->allocate();
+}
+
+void OopStorageThreadCache::release(OopStorage* storage, oop* ptr) {
+  if (_capacity == 0) {
+    storage->release(ptr);
+    return;
+  }
+  if ((_storage != storage) || (_count == _capacity)) {
+    flush();
+    _storage = storage;
+  }
+  _entries[_count++] = ptr;
+}
+
+static int compare_entries(oop* a, oop* b) {
+  if (a < b) {
+    return -1;
+  } else if (a > b) {
+    return 1;
+  }
+  return 0;
+}
+
+void OopStorageThreadCache::flush() {
+  if (_count > 0) {
+    assert(_storage != nullptr, "cached entries without storage");
+    // Sorting groups the entries by block for the bulk release.
+    QuickSort::sort(_entries, _count, compare_entries);
+    _storage->release(_entries, _count);
+    _count = 0;
+  }
+  _storage = nullptr;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_GC_SHARED_OOPSTORAGETHREADCACHE_HPP
+#define SHARE_GC_SHARED_OOPSTORAGETHREADCACHE_HPP
+
+#include "gc/shared/gc_globals.hpp"
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class OopStorage;
+
+// A thread-local cache of released entries of one OopStorage.
+//
+// OopStorage::release updates the allocation bitmask of the entry's block
+// with an atomic operation.  When many threads release entries at a high
+// rate they mostly release into the same few blocks, so those bitmasks
+// bounce between cores.  Entries released through the cache stay
+// allocated in their blocks until the cache is full or flushed; the
+// cached entries are then sorted by address and released in bulk, which
+// updates each block's bitmask once for all of its entries.
+//
+// Allocation through the cache first reuses the most recently released
+// entry, so a thread that keeps creating and deleting handles mostly
+// works on entries it already owns instead of contending with other
+// threads for the shared allocation block.
+//
+// The cache must only be used by its owning thread.  Cached entries are
+// null, like any released entry, so they are harmless to iteration.
+class OopStorageThreadCache : public CHeapObj<mtGC> {
+public:
+  static const uint MaxCapacity = 64;
+
+private:
+  OopStorage* _storage;   // Storage of the cached entries, null if empty.
+  const uint _capacity;
+  uint _count;
+  oop* _entries[MaxCapacity];
+
+  NONCOPYABLE(OopStorageThreadCache);
+
+public:
+  explicit OopStorageThreadCache(uint capacity = OopStorageThreadCacheSize);
+  ~OopStorageThreadCache();
+
+  uint capacity() const { return _capacity; }
+  uint count() const { return _count; }
+
+  // Returns a cached entry of storage if available, otherwise allocates a
+  // new entry from storage.  Returns null if allocation failed.
+  // postcondition: result == nullptr or *result == nullptr.
+  oop* allocate(OopStorage* storage);
+
+  // Adds ptr to the cache, first flushing the cache if it is full or
+  // holds entries of another storage.  Releases ptr directly if the
+  // cache has no capacity.
+  // precondition: ptr is a valid allocated entry of storage.
+  // precondition: *ptr == nullptr.
+  void release(OopStorage* storage, oop* ptr);
+
+  // Releases all cached entries to their storage.
+  void flush();
+};
+
+#endif // SHARE_GC_SHARED_OOPSTORAGETHREADCACHE_HPP
@@ -39,6 +39,7 @@
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/java.hpp"
 #include "runtime/nonJavaThread.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -127,6 +128,10 @@ bool ReferenceProcessor::processing_is_mt() const {
   return ParallelRefProcEnabled && _num_queues > 1;
 }
 
+bool ReferenceProcessor::claims_discovered_lists() const {
+  return ParallelRefProcClaimLists && processing_is_mt();
+}
+
 void ReferenceProcessor::weak_oops_do(OopClosure* f) {
   for (uint i = 0; i < _max_num_queues * number_of_subclasses_of_ref(); i++) {
     if (UseCompressedOops) {
@@ -440,6 +445,17 @@ size_t ReferenceProcessor::total_reference_count(ReferenceType type) const {
   return total_count(list);
 }
 
+bool RefProcTask::claim_list(ReferenceProcessor::RefProcSubPhases subphase, uint worker_id, uint& list_idx) {
+  if (!_ref_processor.claims_discovered_lists()) {
+    assert(worker_id < _ref_processor.max_num_queues(), "Worker id %u out of bounds", worker_id);
+    bool first = (list_idx == NoList);
+    list_idx = worker_id;
+    return first;
+  }
+  list_idx = Atomic::fetch_then_add(&_claimed_lists[subphase], 1u);
+  return list_idx < _ref_processor.max_num_queues();
+}
+
 void RefProcTask::process_discovered_list(uint worker_id,
                                           ReferenceType ref_type,
                                           BoolObjectClosure* is_alive,
@@ -473,12 +489,19 @@ void RefProcTask::process_discovered_list(uint worker_id,
 
   {
     RefProcSubPhasesWorkerTimeTracker tt(subphase, _phase_times, tracker_id(worker_id));
-    size_t const removed = _ref_processor.process_discovered_list_work(dl[worker_id],
-                                                                       is_alive,
-                                                                       keep_alive,
-                                                                       enqueue,
-                                                                       do_enqueue_and_clear);
+    size_t processed = 0;
+    size_t removed = 0;
+    uint list_idx = NoList;
+    while (claim_list(subphase, worker_id, list_idx)) {
+      processed += dl[list_idx].length();
+      removed += _ref_processor.process_discovered_list_work(dl[list_idx],
+                                                             is_alive,
+                                                             keep_alive,
+                                                             enqueue,
+                                                             do_enqueue_and_clear);
+    }
     _phase_times->add_ref_dropped(ref_type, removed);
+    _phase_times->add_ref_processed(subphase, tracker_id(worker_id), processed);
   }
 }
 
@@ -520,8 +543,16 @@ class RefProcKeepAliveFinalPhaseTask: public RefProcTask {
                OopClosure* keep_alive,
                EnqueueDiscoveredFieldClosure* enqueue,
                VoidClosure* complete_gc) override {
-    RefProcSubPhasesWorkerTimeTracker tt(ReferenceProcessor::KeepAliveFinalRefsSubPhase, _phase_times, tracker_id(worker_id));
-    _ref_processor.process_final_keep_alive_work(_ref_processor._discoveredFinalRefs[worker_id], keep_alive, enqueue);
+    ReferenceProcessor::RefProcSubPhases const subphase = ReferenceProcessor::KeepAliveFinalRefsSubPhase;
+    RefProcSubPhasesWorkerTimeTracker tt(subphase, _phase_times, tracker_id(worker_id));
+    size_t processed = 0;
+    uint list_idx = NoList;
+    while (claim_list(subphase, worker_id, list_idx)) {
+      DiscoveredList& refs_list = _ref_processor._discoveredFinalRefs[list_idx];
+      processed += refs_list.length();
+      _ref_processor.process_final_keep_alive_work(refs_list, keep_alive, enqueue);
+    }
+    _phase_times->add_ref_processed(subphase, tracker_id(worker_id), processed);
     // Close the reachable set
     complete_gc->do_void();
   }
@@ -736,7 +767,7 @@ void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_ta
 
   RefProcMTDegreeAdjuster a(this, SoftWeakFinalRefsPhase, num_total_refs);
 
-  if (processing_is_mt()) {
+  if (processing_is_mt() && !claims_discovered_lists()) {
     RefProcBalanceQueuesTimeTracker tt(SoftWeakFinalRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredSoftRefs);
     maybe_balance_queues(_discoveredWeakRefs);
@@ -749,6 +780,8 @@ void ReferenceProcessor::process_soft_weak_final_refs(RefProcProxyTask& proxy_ta
 
   RefProcSoftWeakFinalPhaseTask phase_task(*this, &phase_times);
   run_task(phase_task, proxy_task, false);
+  phase_efficiency(SoftWeakFinalRefsPhase)->record(num_queues(),
+                                                   phase_times.soft_weak_final_refs_phase_worker_time_sec());
 
   verify_total_count_zero(_discoveredSoftRefs, "SoftReference");
   verify_total_count_zero(_discoveredWeakRefs, "WeakReference");
@@ -767,7 +800,7 @@ void ReferenceProcessor::process_final_keep_alive(RefProcProxyTask& proxy_task,
 
   RefProcMTDegreeAdjuster a(this, KeepAliveFinalRefsPhase, num_final_refs);
 
-  if (processing_is_mt()) {
+  if (processing_is_mt() && !claims_discovered_lists()) {
     RefProcBalanceQueuesTimeTracker tt(KeepAliveFinalRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredFinalRefs);
   }
@@ -775,6 +808,8 @@ void ReferenceProcessor::process_final_keep_alive(RefProcProxyTask& proxy_task,
   // Traverse referents of final references and keep them and followers alive.
   RefProcKeepAliveFinalPhaseTask phase_task(*this, &phase_times);
   run_task(phase_task, proxy_task, true);
+  phase_efficiency(KeepAliveFinalRefsPhase)->record(num_queues(),
+                                                    phase_times.sub_phase_worker_time_sec(KeepAliveFinalRefsSubPhase));
 
   verify_total_count_zero(_discoveredFinalRefs, "FinalReference");
 }
@@ -791,7 +826,7 @@ void ReferenceProcessor::process_phantom_refs(RefProcProxyTask& proxy_task,
 
   RefProcMTDegreeAdjuster a(this, PhantomRefsPhase, num_phantom_refs);
 
-  if (processing_is_mt()) {
+  if (processing_is_mt() && !claims_discovered_lists()) {
     RefProcBalanceQueuesTimeTracker tt(PhantomRefsPhase, &phase_times);
     maybe_balance_queues(_discoveredPhantomRefs);
   }
@@ -800,6 +835,8 @@ void ReferenceProcessor::process_phantom_refs(RefProcProxyTask& proxy_task,
 
   RefProcPhantomPhaseTask phase_task(*this, &phase_times);
   run_task(phase_task, proxy_task, false);
+  phase_efficiency(PhantomRefsPhase)->record(num_queues(),
+                                             phase_times.sub_phase_worker_time_sec(ProcessPhantomRefsSubPhase));
 
   verify_total_count_zero(_discoveredPhantomRefs, "PhantomReference");
 }
@@ -1131,6 +1168,16 @@ uint RefProcMTDegreeAdjuster::ergo_proc_thread_count(size_t ref_count,
                     (size_t)os::active_processor_count());
 }
 
+const char* RefProcMTDegreeAdjuster::phase_name(RefProcPhases phase) {
+  static const char* names[ReferenceProcessor::RefPhaseMax] = {
+    "SoftWeakFinalRefsPhase",
+    "KeepAliveFinalRefsPhase",
+    "PhantomRefsPhase"
+  };
+  assert(phase < ReferenceProcessor::RefPhaseMax, "must be");
+  return names[phase];
+}
+
 bool RefProcMTDegreeAdjuster::use_max_threads(RefProcPhases phase) const {
   // Even a small number of references in this phase could produce large amounts of work.
   return phase == ReferenceProcessor::KeepAliveFinalRefsPhase;
@@ -1142,6 +1189,7 @@ RefProcMTDegreeAdjuster::RefProcMTDegreeAdjuster(ReferenceProcessor* rp,
     _rp(rp),
     _saved_num_queues(_rp->num_queues()) {
   uint workers = ergo_proc_thread_count(ref_count, _rp->num_queues(), phase);
+  workers = _rp->phase_efficiency(phase)->adjust(workers, phase_name(phase));
   _rp->set_active_mt_degree(workers);
 }
 
@@ -28,6 +28,7 @@
 #include "gc/shared/referenceDiscoverer.hpp"
 #include "gc/shared/referencePolicy.hpp"
 #include "gc/shared/referenceProcessorStats.hpp"
+#include "gc/shared/workerPolicy.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "memory/referenceType.hpp"
 #include "oops/instanceRefKlass.hpp"
@@ -247,6 +248,9 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   // Master array of discovered oops
   DiscoveredList* _discovered_refs;
 
+  // Measured scaling of each of the phases, used to size their workers.
+  WorkerEfficiencyTracker _phase_efficiency[RefPhaseMax];
+
   // Arrays of lists of oops, one per thread (pointers into master array above)
   DiscoveredList* _discoveredSoftRefs;
   DiscoveredList* _discoveredWeakRefs;
@@ -299,6 +303,11 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   uint max_num_queues() const              { return _max_num_queues; }
   void set_active_mt_degree(uint v);
 
+  WorkerEfficiencyTracker* phase_efficiency(RefProcPhases phase) {
+    assert(phase < RefPhaseMax, "must be");
+    return &_phase_efficiency[phase];
+  }
+
   void start_discovery(bool always_clear) {
     enable_discovery();
     setup_policy(always_clear);
@@ -407,6 +416,11 @@ class ReferenceProcessor : public ReferenceDiscoverer {
   // Whether we are in a phase when _processing_ is MT.
   bool processing_is_mt() const;
 
+  // Whether MT processing workers claim whole discovered lists from all
+  // discovery queues instead of balancing them to the processing degree
+  // first.
+  bool claims_discovered_lists() const;
+
   // iterate over oops
   void weak_oops_do(OopClosure* f);       // weak roots
 
@@ -525,6 +539,16 @@ class RefProcTask : StackObj {
     return _ref_processor.processing_is_mt() ? worker_id : 0;
   }
 
+  // Next discovered list to claim per sub phase if lists are claimed.
+  volatile uint _claimed_lists[ReferenceProcessor::RefSubPhaseMax];
+
+  static const uint NoList = UINT_MAX;
+
+  // Sets list_idx to the next discovered list the worker processes in the
+  // given sub phase, starting from NoList. Returns false if there is none.
+  // Without list claiming a worker only processes the list of its own id.
+  bool claim_list(ReferenceProcessor::RefProcSubPhases subphase, uint worker_id, uint& list_idx);
+
   void process_discovered_list(uint worker_id,
                                ReferenceType ref_type,
                                BoolObjectClosure* is_alive,
@@ -534,7 +558,11 @@ class RefProcTask : StackObj {
   RefProcTask(ReferenceProcessor& ref_processor,
               ReferenceProcessorPhaseTimes* phase_times)
     : _ref_processor(ref_processor),
-      _phase_times(phase_times) {}
+      _phase_times(phase_times) {
+    for (uint i = 0; i < ReferenceProcessor::RefSubPhaseMax; i++) {
+      _claimed_lists[i] = 0;
+    }
+  }
 
   virtual void rp_work(uint worker_id,
                        BoolObjectClosure* is_alive,
@@ -586,6 +614,8 @@ class RefProcMTDegreeAdjuster : public StackObj {
 
   bool use_max_threads(RefProcPhases phase) const;
 
+  static const char* phase_name(RefProcPhases phase);
+
 public:
   RefProcMTDegreeAdjuster(ReferenceProcessor* rp,
                           RefProcPhases phase,
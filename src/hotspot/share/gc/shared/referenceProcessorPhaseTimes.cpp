@@ -54,6 +54,8 @@ static const char* SubPhasesParWorkTitle[ReferenceProcessor::RefSubPhaseMax] = {
 
 static const char* SoftWeakFinalRefsPhaseParWorkTitle = "Total (ms):";
 
+static const char* SubPhasesProcessedTitle = "Processed:";
+
 static const char* SubPhasesSerWorkTitle[ReferenceProcessor::RefSubPhaseMax] = {
        "SoftRef:",
        "WeakRef:",
@@ -158,6 +160,7 @@ ReferenceProcessorPhaseTimes::ReferenceProcessorPhaseTimes(GCTimer* gc_timer, ui
   assert(gc_timer != nullptr, "pre-condition");
   for (uint i = 0; i < ReferenceProcessor::RefSubPhaseMax; i++) {
     _sub_phases_worker_time_sec[i] = new WorkerDataArray<double>(nullptr, SubPhasesParWorkTitle[i], max_gc_threads);
+    _sub_phases_worker_time_sec[i]->create_thread_work_items(SubPhasesProcessedTitle);
   }
   _soft_weak_final_refs_phase_worker_time_sec = new WorkerDataArray<double>(nullptr, SoftWeakFinalRefsPhaseParWorkTitle, max_gc_threads);
 
@@ -218,6 +221,12 @@ void ReferenceProcessorPhaseTimes::add_ref_dropped(ReferenceType ref_type, size_
   Atomic::add(&_ref_dropped[ref_type_2_index(ref_type)], count, memory_order_relaxed);
 }
 
+void ReferenceProcessorPhaseTimes::add_ref_processed(ReferenceProcessor::RefProcSubPhases sub_phase, uint worker_id, size_t count) {
+  ASSERT_SUB_PHASE(sub_phase);
+  // The serial path runs all work units with the same tracker id.
+  _sub_phases_worker_time_sec[sub_phase]->set_or_add_thread_work_item(worker_id, count);
+}
+
 void ReferenceProcessorPhaseTimes::set_ref_discovered(ReferenceType ref_type, size_t count) {
   ASSERT_REF_TYPE(ref_type);
   _ref_discovered[ref_type_2_index(ref_type)] = count;
@@ -348,6 +357,13 @@ void ReferenceProcessorPhaseTimes::print_worker_time(LogStream* ls, WorkerDataAr
       LogStream ls2(lt);
       ls2.print("%s", Indents[indent]);
       worker_time->print_details_on(&ls2);
+      WorkerDataArray<size_t>* processed = worker_time->thread_work_items();
+      if (processed != nullptr) {
+        ls2.print("%s", Indents[indent + 1]);
+        processed->print_summary_on(&ls2, true);
+        ls2.print("%s", Indents[indent + 1]);
+        processed->print_details_on(&ls2);
+      }
     }
   } else {
     if (worker_time->get(0) != uninitialized()) {
@@ -84,6 +84,8 @@ class ReferenceProcessorPhaseTimes : public CHeapObj<mtGC> {
   void set_total_time_ms(double total_time_ms) { _total_time_ms = total_time_ms; }
 
   void add_ref_dropped(ReferenceType ref_type, size_t count);
+  // Number of references in the discovered lists the worker processed in the sub phase.
+  void add_ref_processed(ReferenceProcessor::RefProcSubPhases sub_phase, uint worker_id, size_t count);
   void set_ref_discovered(ReferenceType ref_type, size_t count);
   size_t ref_discovered(ReferenceType ref_type);
 
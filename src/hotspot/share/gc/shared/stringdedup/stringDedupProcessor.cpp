@@ -41,6 +41,7 @@
 #include "runtime/cpuTimeCounters.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalCounter.hpp"
 #include "utilities/globalDefinitions.hpp"
@@ -105,7 +106,11 @@ StringDedup::StorageUse* StringDedup::Processor::storage_for_requests() {
 
 void StringDedup::Processor::yield() const {
   assert(Thread::current() == _thread, "precondition");
-  ThreadBlockInVM tbivm(_thread);
+  // Only pay for the thread state transitions when a safepoint or handshake
+  // is actually waiting for this thread.  Yield is called for every request.
+  if (SafepointMechanism::should_process(_thread)) {
+    ThreadBlockInVM tbivm(_thread);
+  }
 }
 
 void StringDedup::Processor::cleanup_table(bool grow_only, bool force) const {
@@ -396,7 +396,11 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
   // Element array.
   E* _elems;
 
-  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_PADDING_SIZE, sizeof(E*));
+  // The NUMA node the queue owner was last seen running on. Read by thieves,
+  // and only written by the owner when it changes.
+  volatile uint _numa_node;
+
+  DEFINE_PAD_MINUS_SIZE(1, DEFAULT_PADDING_SIZE, sizeof(E*) + sizeof(uint));
   // Queue owner local variables. Not to be accessed by other threads.
 
   static const uint InvalidQueueId = uint(-1);
@@ -406,6 +410,15 @@ class GenericTaskQueue: public TaskQueueSuper<N, F> {
 
   DEFINE_PAD_MINUS_SIZE(2, DEFAULT_PADDING_SIZE, sizeof(uint) + sizeof(int));
 public:
+  static const uint UnknownNumaNode = uint(-1);
+
+  uint numa_node() const { return Atomic::load(&_numa_node); }
+  void set_numa_node(uint node) {
+    if (numa_node() != node) {
+      Atomic::store(&_numa_node, node);
+    }
+  }
+
   int next_random_queue_id();
 
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
@@ -480,11 +493,27 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
   uint _n;
   T** _queues;
 
+  // Steal policy, see set_steal_policy().
+  bool _batched_steal;
+  bool _numa_local_steal;
+
+  // Number of random victims looked at to find one on the local NUMA node.
+  static const uint NUMAVictimAttempts = 4;
+
   // Attempts to steal an element from a foreign queue (!= queue_num), setting
   // the result in t. Validity of this value and the return value is the same
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // Returns a random queue other than queue_num and exclude, preferring
+  // queues on the NUMA node of queue_num if NUMA-local stealing is enabled.
+  uint random_victim(uint queue_num, uint exclude);
+
+  // After a successful steal of one element from the victim that had
+  // victim_size elements, moves more of them to the local queue, up to half
+  // of victim_size in total.
+  void steal_batch(T* local_queue, T* victim, uint victim_size);
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
@@ -495,6 +524,19 @@ class GenericTaskQueueSet: public TaskQueueSetSuperImpl<F> {
 
   T* queue(uint n);
 
+  // Select how the queues are stolen from. With batched stealing, a
+  // successful steal takes up to half of the victim's elements, moving all
+  // but the returned one to the thief's queue. With NUMA-local stealing,
+  // victims on the thief's NUMA node are preferred; this relies on queue
+  // owners calling update_numa_node().
+  void set_steal_policy(bool batched, bool numa_local) {
+    _batched_steal = batched;
+    _numa_local_steal = numa_local;
+  }
+
+  // Record the NUMA node the current thread, the owner of queue_num, runs on.
+  inline void update_numa_node(uint queue_num);
+
   // Try to steal a task from some other queue than queue_num. It may perform several attempts at doing so.
   // Returns if stealing succeeds, and sets "t" to the stolen task.
   bool steal(uint queue_num, E& t);
@@ -34,12 +34,16 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
 
 template <class T, MEMFLAGS F>
-inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) : _n(n) {
+inline GenericTaskQueueSet<T, F>::GenericTaskQueueSet(uint n) :
+  _n(n),
+  _batched_steal(false),
+  _numa_local_steal(false) {
   typedef T* GenericTaskQueuePtr;
   _queues = NEW_C_HEAP_ARRAY(GenericTaskQueuePtr, n, F);
   for (uint i = 0; i < n; i++) {
@@ -100,6 +104,7 @@ inline void GenericTaskQueueSet<T, F>::print_and_reset_taskqueue_stats(const cha
 template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::GenericTaskQueue() :
   _elems(MallocArrayAllocator<E>::allocate(N, F)),
+  _numa_node(UnknownNumaNode),
   _last_stolen_queue_id(InvalidQueueId),
   _seed(17 /* random number */) {}
 
@@ -326,15 +331,10 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
       k1 = local_queue->last_stolen_queue_id();
       assert(k1 != queue_num, "Should not be the same");
     } else {
-      while (k1 == queue_num) {
-        k1 = local_queue->next_random_queue_id() % _n;
-      }
+      k1 = random_victim(queue_num, queue_num);
     }
 
-    uint k2 = queue_num;
-    while (k2 == queue_num || k2 == k1) {
-      k2 = local_queue->next_random_queue_id() % _n;
-    }
+    uint k2 = random_victim(queue_num, k1);
     // Sample both and try the larger.
     uint sz1 = queue(k1)->size();
     uint sz2 = queue(k2)->size();
@@ -354,6 +354,9 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
 
     if (suc == PopResult::Success) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      if (_batched_steal) {
+        steal_batch(local_queue, queue(sel_k), MAX2(sz1, sz2));
+      }
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -362,8 +365,12 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
   } else if (_n == 2) {
     // Just try the other one.
     uint k = (queue_num + 1) % 2;
+    uint sz = queue(k)->size();
     PopResult res = queue(k)->pop_global(t);
     TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res == PopResult::Success && _batched_steal) {
+      steal_batch(local_queue, queue(k), sz);
+    }
     return res;
   } else {
     assert(_n == 1, "can't be zero.");
@@ -372,6 +379,53 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
   }
 }
 
+template<class T, MEMFLAGS F>
+uint GenericTaskQueueSet<T, F>::random_victim(uint queue_num, uint exclude) {
+  assert(_n > 2, "must be");
+  T* const local_queue = queue(queue_num);
+  uint const local_node = local_queue->numa_node();
+  bool const prefer_local = _numa_local_steal && local_node != T::UnknownNumaNode;
+
+  uint attempts = 0;
+  while (true) {
+    uint k = local_queue->next_random_queue_id() % _n;
+    if (k == queue_num || k == exclude) {
+      continue;
+    }
+    // Settle for a remote victim after a few tries, there may be no other
+    // queue on this node that has been used.
+    if (!prefer_local ||
+        ++attempts >= NUMAVictimAttempts ||
+        queue(k)->numa_node() == local_node) {
+      return k;
+    }
+  }
+}
+
+template<class T, MEMFLAGS F>
+void GenericTaskQueueSet<T, F>::steal_batch(T* local_queue, T* victim, uint victim_size) {
+  // Every element is still claimed by its own pop_global(), so a batched steal
+  // races with the victim's owner exactly like a series of single steals.
+  // The thief is the owner of local_queue, so it may push to it.
+  uint const space = local_queue->max_elems() - local_queue->size();
+  uint const batch = MIN2(victim_size / 2, space);
+  for (uint i = 1; i < batch; i++) {
+    E e;
+    if (victim->pop_global(e) != PopResult::Success) {
+      break;
+    }
+    bool pushed = local_queue->push(e);
+    assert(pushed, "Checked for space before");
+  }
+}
+
+template<class T, MEMFLAGS F>
+inline void GenericTaskQueueSet<T, F>::update_numa_node(uint queue_num) {
+  if (_numa_local_steal) {
+    queue(queue_num)->set_numa_node((uint)os::numa_get_group_id());
+  }
+}
+
 template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
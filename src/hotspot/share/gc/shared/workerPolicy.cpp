@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
 #include "gc/shared/workerPolicy.hpp"
 #include "logging/log.hpp"
 #include "memory/universe.hpp"
@@ -31,6 +32,8 @@
 #include "runtime/os.hpp"
 #include "runtime/vm_version.hpp"
 
+#include <math.h>
+
 uint WorkerPolicy::_parallel_worker_threads = 0;
 bool WorkerPolicy::_parallel_worker_threads_initialized = false;
 
@@ -175,3 +178,49 @@ uint WorkerPolicy::calc_active_conc_workers(uintx total_workers,
     return no_of_gc_threads;
   }
 }
+
+WorkerEfficiencyTracker::WorkerEfficiencyTracker() :
+  _parallelism(AdaptiveSizePolicyWeight) { }
+
+void WorkerEfficiencyTracker::record(uint active_workers,
+                                     WorkerDataArray<double>* worker_times,
+                                     WorkerDataArray<double>* idle_times) {
+  // A single worker tells nothing about how the phase scales.
+  if (!UseAdaptiveGCWorkerSizing || active_workers < 2) {
+    return;
+  }
+
+  const double uninitialized = WorkerDataArray<double>::uninitialized();
+  double work = 0.0;
+  double max_time = 0.0;
+  for (uint i = 0; i < active_workers; i++) {
+    double time = worker_times->get(i);
+    if (time == uninitialized) {
+      continue;
+    }
+    double idle = (idle_times != nullptr) ? idle_times->get(i) : uninitialized;
+    work += (idle == uninitialized) ? time : MAX2(time - idle, 0.0);
+    max_time = MAX2(max_time, time);
+  }
+
+  if (max_time > 0.0) {
+    _parallelism.sample((float)(work / max_time));
+  }
+}
+
+uint WorkerEfficiencyTracker::adjust(uint proposed_workers, const char* phase) const {
+  if (!UseAdaptiveGCWorkerSizing || _parallelism.count() == 0) {
+    return proposed_workers;
+  }
+
+  // Use as many workers as the phase can keep busy for GCWorkerEfficiencyTarget
+  // percent of its time. If the phase scaled well, this is more than it ran
+  // with last time, and the number of workers grows back.
+  double parallelism = _parallelism.average();
+  uint workers = (uint)ceil(parallelism * 100.0 / GCWorkerEfficiencyTarget);
+  workers = clamp(workers, 1u, proposed_workers);
+
+  log_debug(gc, task)("%s: effective parallelism %.1f, using %u of %u workers",
+                      phase, parallelism, workers, proposed_workers);
+  return workers;
+}
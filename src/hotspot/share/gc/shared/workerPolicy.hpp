@@ -25,9 +25,12 @@
 #ifndef SHARE_GC_SHARED_WORKERPOLICY_HPP
 #define SHARE_GC_SHARED_WORKERPOLICY_HPP
 
+#include "gc/shared/gcUtil.hpp"
 #include "memory/allStatic.hpp"
 #include "utilities/globalDefinitions.hpp"
 
+template <class T> class WorkerDataArray;
+
 class WorkerPolicy : public AllStatic {
   static const uint GCWorkersPerJavaThread = 2;
 
@@ -74,4 +77,25 @@ class WorkerPolicy : public AllStatic {
 
 };
 
+// Tracks how well a parallel phase scaled with the workers it ran with, and
+// suggests fewer workers for the next run of the phase if the extra workers
+// did not pay off. The measure is the effective parallelism of the phase:
+// the work done by all workers divided by the time of the slowest one.
+class WorkerEfficiencyTracker : public CHeapObj<mtGC> {
+  AdaptiveWeightedAverage _parallelism;
+
+public:
+  WorkerEfficiencyTracker();
+
+  // Record the per-worker times of a run of the phase with active_workers.
+  // If given, idle_times (e.g. termination) are not counted as work.
+  void record(uint active_workers,
+              WorkerDataArray<double>* worker_times,
+              WorkerDataArray<double>* idle_times = nullptr);
+
+  // Return the number of workers, not larger than proposed_workers, to use
+  // for the next run of the phase.
+  uint adjust(uint proposed_workers, const char* phase) const;
+};
+
 #endif // SHARE_GC_SHARED_WORKERPOLICY_HPP
@@ -987,6 +987,10 @@ void ShenandoahConcurrentGC::op_final_updaterefs() {
     heap->clear_cancelled_gc();
   }
 
+  if (ShenandoahPacing) {
+    heap->pacer()->record_updaterefs_done();
+  }
+
   // Has to be done before cset is clear
   if (ShenandoahVerify) {
     heap->verifier()->verify_roots_in_to_space();
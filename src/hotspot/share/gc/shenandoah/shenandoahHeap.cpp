@@ -73,6 +73,7 @@
 #include "gc/shenandoah/shenandoahJfrSupport.hpp"
 #endif
 
+#include "cds/archiveHeapWriter.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
 #include "memory/classLoaderMetaspace.hpp"
@@ -502,7 +503,7 @@ ShenandoahHeap::ShenandoahHeap(ShenandoahCollectorPolicy* policy) :
   _heap_region_special(false),
   _num_regions(0),
   _regions(nullptr),
-  _update_refs_iterator(this),
+  _update_refs_iterator(this, ShenandoahUpdateRefsChunkSize),
   _gc_state_changed(false),
   _gc_no_progress_count(0),
   _control_thread(nullptr),
@@ -1015,6 +1016,85 @@ HeapWord* ShenandoahHeap::mem_allocate(size_t size,
   return allocate_memory(req);
 }
 
+HeapWord* ShenandoahHeap::allocate_loaded_archive_space(size_t size) {
+#if INCLUDE_CDS_JAVA_HEAP
+  // CDS wants a contiguous memory range to load a bunch of objects.
+  // This effectively bypasses normal allocation paths, and requires
+  // a bit of massaging to unbreak GC invariants.
+
+  ShenandoahAllocRequest req = ShenandoahAllocRequest::for_shared(size);
+
+  // Easy case: a single regular region, no further adjustments needed.
+  if (size <= ShenandoahHeapRegion::humongous_threshold_words()) {
+    return allocate_memory(req);
+  }
+
+  // Hard case: the requested size would cause a humongous allocation.
+  // We need to make sure it looks like regular allocation to the rest of GC.
+
+  // CDS guarantees that no object straddles a MIN_GC_REGION_ALIGNMENT
+  // boundary, so objects do not cross regions as long as regions are at
+  // least that large. Fall back to not loading the archive otherwise.
+  if (ShenandoahHeapRegion::region_size_bytes() < ArchiveHeapWriter::MIN_GC_REGION_ALIGNMENT) {
+    return nullptr;
+  }
+
+  HeapWord* mem = allocate_memory(req);
+  if (mem == nullptr) {
+    return nullptr;
+  }
+  size_t start_idx = heap_region_index_containing(mem);
+  size_t num_regions = ShenandoahHeapRegion::required_regions(size * HeapWordSize);
+
+  // Flip humongous -> regular.
+  {
+    ShenandoahHeapLocker locker(lock());
+    for (size_t c = start_idx; c < start_idx + num_regions; c++) {
+      get_region(c)->make_regular_bypass();
+    }
+  }
+
+  return mem;
+#else
+  assert(false, "Archive heap loader should not be available, should not be here");
+  return nullptr;
+#endif // INCLUDE_CDS_JAVA_HEAP
+}
+
+void ShenandoahHeap::complete_loaded_archive_space(MemRegion archive_space) {
+  // Nothing to do here, except checking that heap looks fine.
+#ifdef ASSERT
+  HeapWord* start = archive_space.start();
+  HeapWord* end = archive_space.end();
+
+  // No unclaimed space between the objects.
+  // Objects are properly allocated in correct regions.
+  HeapWord* cur = start;
+  while (cur < end) {
+    oop obj = cast_to_oop(cur);
+    shenandoah_assert_in_correct_region(nullptr, obj);
+    cur += obj->size();
+  }
+
+  // No unclaimed tail at the end of archive space.
+  assert(cur == end,
+         "Archive space should be fully used: " PTR_FORMAT " " PTR_FORMAT,
+         p2i(cur), p2i(end));
+
+  // Region bounds are good.
+  ShenandoahHeapRegion* begin_reg = heap_region_containing(start);
+  ShenandoahHeapRegion* end_reg = heap_region_containing(end - 1);
+  assert(begin_reg->is_regular(), "Must be");
+  assert(end_reg->is_regular(), "Must be");
+  assert(begin_reg->bottom() == start,
+         "Must agree: archive-space-start: " PTR_FORMAT ", begin-region-bottom: " PTR_FORMAT,
+         p2i(start), p2i(begin_reg->bottom()));
+  assert(end_reg->top() == end,
+         "Must agree: archive-space-end: " PTR_FORMAT ", end-region-top: " PTR_FORMAT,
+         p2i(end), p2i(end_reg->top()));
+#endif
+}
+
 MetaWord* ShenandoahHeap::satisfy_failed_metadata_allocation(ClassLoaderData* loader_data,
                                                              size_t size,
                                                              Metaspace::MetadataType mdtype) {
@@ -2168,12 +2248,12 @@ template<bool CONCURRENT>
 class ShenandoahUpdateHeapRefsTask : public WorkerTask {
 private:
   ShenandoahHeap* _heap;
-  ShenandoahRegionIterator* _regions;
+  ShenandoahRegionChunkIterator* _chunks;
 public:
-  ShenandoahUpdateHeapRefsTask(ShenandoahRegionIterator* regions) :
+  ShenandoahUpdateHeapRefsTask(ShenandoahRegionChunkIterator* chunks) :
     WorkerTask("Shenandoah Update References"),
     _heap(ShenandoahHeap::heap()),
-    _regions(regions) {
+    _chunks(chunks) {
   }
 
   void work(uint worker_id) {
@@ -2201,21 +2281,20 @@ class ShenandoahUpdateHeapRefsTask : public WorkerTask {
     }
     // If !CONCURRENT, there's no value in expanding Mutator free set
 
-    ShenandoahHeapRegion* r = _regions->next();
-    ShenandoahMarkingContext* const ctx = _heap->complete_marking_context();
-    while (r != nullptr) {
+    ShenandoahRegionChunk chunk;
+    while (_chunks->next(&chunk)) {
+      ShenandoahHeapRegion* r = chunk._r;
       HeapWord* update_watermark = r->get_update_watermark();
       assert (update_watermark >= r->bottom(), "sanity");
       if (r->is_active() && !r->is_cset()) {
-        _heap->marked_object_oop_iterate(r, &cl, update_watermark);
+        _heap->marked_object_oop_iterate(r, &cl, chunk._start, chunk._end, update_watermark);
       }
-      if (ShenandoahPacing) {
-        _heap->pacer()->report_updaterefs(pointer_delta(update_watermark, r->bottom()));
+      if (ShenandoahPacing && update_watermark > chunk._start) {
+        _heap->pacer()->report_updaterefs(pointer_delta(MIN2(update_watermark, chunk._end), chunk._start));
       }
       if (_heap->check_cancelled_gc_and_yield(CONCURRENT)) {
         return;
       }
-      r = _regions->next();
     }
   }
 };
@@ -2432,6 +2511,25 @@ bool ShenandoahRegionIterator::has_next() const {
   return _index < _heap->num_regions();
 }
 
+ShenandoahRegionChunkIterator::ShenandoahRegionChunkIterator(ShenandoahHeap* heap, size_t chunk_size_bytes) :
+  _heap(heap),
+  _chunk_words(ShenandoahHeapRegion::region_size_words()),
+  _chunks_per_region(1),
+  _index(0) {
+  if (chunk_size_bytes > 0) {
+    _chunk_words = clamp<size_t>(chunk_size_bytes / HeapWordSize, 1, _chunk_words);
+    _chunks_per_region = (ShenandoahHeapRegion::region_size_words() + _chunk_words - 1) / _chunk_words;
+  }
+}
+
+void ShenandoahRegionChunkIterator::reset() {
+  _index = 0;
+}
+
+bool ShenandoahRegionChunkIterator::has_next() const {
+  return _index < _heap->num_regions() * _chunks_per_region;
+}
+
 char ShenandoahHeap::gc_state() const {
   return _gc_state.raw_value();
 }
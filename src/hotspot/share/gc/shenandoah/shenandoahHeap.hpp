@@ -103,6 +103,44 @@ class ShenandoahRegionIterator : public StackObj {
   bool has_next() const;
 };
 
+// Part of a heap region handed out by ShenandoahRegionChunkIterator.
+struct ShenandoahRegionChunk {
+  ShenandoahHeapRegion* _r;
+  HeapWord*             _start;
+  HeapWord*             _end;
+};
+
+// Hands out fixed-size chunks of heap regions to parallel workers, so that
+// large regions do not end up being processed by a single worker.
+class ShenandoahRegionChunkIterator : public StackObj {
+private:
+  ShenandoahHeap* _heap;
+  size_t _chunk_words;
+  size_t _chunks_per_region;
+
+  shenandoah_padding(0);
+  volatile size_t _index;
+  shenandoah_padding(1);
+
+  // No implicit copying: iterators should be passed by reference to capture the state
+  NONCOPYABLE(ShenandoahRegionChunkIterator);
+
+public:
+  // Chunk size of 0 hands out whole regions.
+  ShenandoahRegionChunkIterator(ShenandoahHeap* heap, size_t chunk_size_bytes);
+
+  // Reset iterator to default state
+  void reset();
+
+  // Fills in the next chunk, or returns false if there are no more chunks.
+  // This is multi-thread-safe.
+  inline bool next(ShenandoahRegionChunk* chunk);
+
+  // This is *not* MT safe. However, in the absence of multithreaded access, it
+  // can be used to determine if there is more work to do.
+  bool has_next() const;
+};
+
 class ShenandoahHeapRegionClosure : public StackObj {
 public:
   virtual void heap_region_do(ShenandoahHeapRegion* r) = 0;
@@ -239,7 +277,7 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   bool      _heap_region_special;
   size_t    _num_regions;
   ShenandoahHeapRegion** _regions;
-  ShenandoahRegionIterator _update_refs_iterator;
+  ShenandoahRegionChunkIterator _update_refs_iterator;
 
 public:
 
@@ -568,6 +606,13 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   void tlabs_retire(bool resize);
   void gclabs_retire(bool resize);
 
+// ---------- CDS archive support
+//
+public:
+  bool can_load_archived_objects() const override { return UseCompressedOops; }
+  HeapWord* allocate_loaded_archive_space(size_t size) override;
+  void complete_loaded_archive_space(MemRegion archive_space) override;
+
 // ---------- Marking support
 //
 private:
@@ -601,9 +646,19 @@ class ShenandoahHeap : public CollectedHeap, public ShenandoahSpaceInfo {
   template<class T>
   inline void marked_object_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* limit);
 
+  // Visits marked objects below limit that start in [from, to). Objects past the TAMS
+  // can only be found by walking from the TAMS, so they are all visited by the range
+  // that contains the TAMS.
+  template<class T>
+  inline void marked_object_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* from, HeapWord* to, HeapWord* limit);
+
   template<class T>
   inline void marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* limit);
 
+  // Same as above, restricted to the part of the region in [from, to).
+  template<class T>
+  inline void marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* from, HeapWord* to, HeapWord* limit);
+
   void reset_mark_bitmap();
 
   // SATB barriers hooks
@@ -61,6 +61,19 @@ inline ShenandoahHeapRegion* ShenandoahRegionIterator::next() {
   return _heap->get_region(new_index - 1);
 }
 
+inline bool ShenandoahRegionChunkIterator::next(ShenandoahRegionChunk* chunk) {
+  size_t index = Atomic::add(&_index, (size_t) 1, memory_order_relaxed) - 1;
+  ShenandoahHeapRegion* r = _heap->get_region(index / _chunks_per_region);
+  if (r == nullptr) {
+    return false;
+  }
+  HeapWord* start = r->bottom() + (index % _chunks_per_region) * _chunk_words;
+  chunk->_r = r;
+  chunk->_start = start;
+  chunk->_end = MIN2(start + _chunk_words, r->end());
+  return true;
+}
+
 inline bool ShenandoahHeap::has_forwarded_objects() const {
   return _gc_state.is_set(HAS_FORWARDED);
 }
@@ -353,7 +366,13 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
 
 template<class T>
 inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* limit) {
+  marked_object_iterate(region, cl, region->bottom(), region->end(), limit);
+}
+
+template<class T>
+inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* from, HeapWord* to, HeapWord* limit) {
   assert(! region->is_humongous_continuation(), "no humongous continuation regions here");
+  assert(region->bottom() <= from && from <= to && to <= region->end(), "range should be in region");
 
   ShenandoahMarkingContext* const ctx = complete_marking_context();
   assert(ctx->is_complete(), "sanity");
@@ -361,15 +380,15 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
   HeapWord* tams = ctx->top_at_mark_start(region);
 
   size_t skip_bitmap_delta = 1;
-  HeapWord* start = region->bottom();
-  HeapWord* end = MIN2(tams, region->end());
+  HeapWord* start = from;
+  HeapWord* end = MIN2(tams, to);
 
   // Step 1. Scan below the TAMS based on bitmap data.
-  HeapWord* limit_bitmap = MIN2(limit, tams);
+  HeapWord* limit_bitmap = MIN2(limit, end);
 
   // Try to scan the initial candidate. If the candidate is above the TAMS, it would
   // fail the subsequent "< limit_bitmap" checks, and fall through to Step 2.
-  HeapWord* cb = ctx->get_next_marked_addr(start, end);
+  HeapWord* cb = (start < end) ? ctx->get_next_marked_addr(start, end) : end;
 
   intx dist = ShenandoahMarkScanPrefetch;
   if (dist > 0) {
@@ -426,7 +445,12 @@ inline void ShenandoahHeap::marked_object_iterate(ShenandoahHeapRegion* region,
 
   // Step 2. Accurate size-based traversal, happens past the TAMS.
   // This restarts the scan at TAMS, which makes sure we traverse all objects,
-  // regardless of what happened at Step 1.
+  // regardless of what happened at Step 1. Only the range that contains the
+  // TAMS does this, as there is no way to find object starts past the TAMS
+  // other than walking from it.
+  if (tams < from || tams >= to) {
+    return;
+  }
   HeapWord* cs = tams;
   while (cs < limit) {
     assert (cs >= tams, "only objects past TAMS here: "   PTR_FORMAT " (" PTR_FORMAT ")", p2i(cs), p2i(tams));
@@ -466,8 +490,15 @@ class ShenandoahObjectToOopBoundedClosure : public ObjectClosure {
 
 template<class T>
 inline void ShenandoahHeap::marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* top) {
+  marked_object_oop_iterate(region, cl, region->bottom(), region->end(), top);
+}
+
+template<class T>
+inline void ShenandoahHeap::marked_object_oop_iterate(ShenandoahHeapRegion* region, T* cl, HeapWord* from, HeapWord* to, HeapWord* top) {
   if (region->is_humongous()) {
-    HeapWord* bottom = region->bottom();
+    // Humongous object is split between ranges by bounding the iteration.
+    HeapWord* bottom = from;
+    top = MIN2(top, to);
     if (top > bottom) {
       region = region->humongous_start_region();
       ShenandoahObjectToOopBoundedClosure<T> objs(cl, bottom, top);
@@ -475,7 +506,7 @@ inline void ShenandoahHeap::marked_object_oop_iterate(ShenandoahHeapRegion* regi
     }
   } else {
     ShenandoahObjectToOopClosure<T> objs(cl);
-    marked_object_iterate(region, &objs, top);
+    marked_object_iterate(region, &objs, from, to, top);
   }
 }
 
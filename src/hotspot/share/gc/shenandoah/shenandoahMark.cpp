@@ -25,6 +25,7 @@
 
 #include "precompiled.hpp"
 
+#include "gc/shared/markPrefetchQueue.inline.hpp"
 #include "gc/shenandoah/shenandoahBarrierSet.hpp"
 #include "gc/shenandoah/shenandoahClosures.inline.hpp"
 #include "gc/shenandoah/shenandoahMark.inline.hpp"
@@ -162,6 +163,9 @@ void ShenandoahMark::mark_loop_work(T* cl, ShenandoahLiveData* live_data, uint w
     }
   }
   q = get_queue(worker_id);
+  queues->update_numa_node(worker_id);
+
+  MarkPrefetchQueue<ShenandoahMarkTask> prefetch_queue(MarkingPrefetchDistance);
 
   ShenandoahSATBBufferClosure<GENERATION> drain_satb(q);
   SATBMarkQueueSet& satb_mq_set = ShenandoahBarrierSet::satb_mark_queue_set();
@@ -182,13 +186,23 @@ void ShenandoahMark::mark_loop_work(T* cl, ShenandoahLiveData* live_data, uint w
     for (uint i = 0; i < stride; i++) {
       if (q->pop(t) ||
           queues->steal(worker_id, t)) {
-        do_task<T, GENERATION, STRING_DEDUP>(q, cl, live_data, req, &t);
+        ShenandoahMarkTask ready;
+        if (prefetch_queue.push(t, cast_from_oop<void*>(t.obj()), ready)) {
+          do_task<T, GENERATION, STRING_DEDUP>(q, cl, live_data, req, &ready);
+        }
         work++;
       } else {
         break;
       }
     }
 
+    // Process the entries still being prefetched before yielding or
+    // offering termination.
+    while (prefetch_queue.pop(t)) {
+      do_task<T, GENERATION, STRING_DEDUP>(q, cl, live_data, req, &t);
+      work++;
+    }
+
     if (work == 0) {
       // No work encountered in current stride, try to terminate.
       // Need to leave the STS here otherwise it might block safepoints.
@@ -38,6 +38,7 @@ ShenandoahMarkingContext::ShenandoahMarkingContext(MemRegion heap_region, MemReg
                       ((uintx) heap_region.start() >> ShenandoahHeapRegion::region_size_bytes_shift())),
   _task_queues(new ShenandoahObjToScanQueueSet(max_queues)) {
   assert(max_queues > 0, "At least one queue");
+  _task_queues->set_steal_policy(UseBatchedTaskQueueSteal, UseNUMA && UseNUMALocalTaskQueueSteal);
   for (uint i = 0; i < max_queues; ++i) {
     ShenandoahObjToScanQueue* task_queue = new ShenandoahObjToScanQueue();
     _task_queues->register_queue(i, task_queue);
@@ -24,6 +24,7 @@
 
 #include "precompiled.hpp"
 
+#include "gc/shenandoah/shenandoahCollectionSet.hpp"
 #include "gc/shenandoah/shenandoahFreeSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
@@ -55,6 +56,12 @@
  *
  * The allocatable space when GC is running is "free" at the start of phase, but the
  * accounted budget is based on "used". So, we need to adjust the tax knowing that.
+ *
+ * By default, evac claims 1/2 of the free space, and leaves the rest to update-refs.
+ * The cost of evacuation depends on the live data in the collection set, and can
+ * vary a lot between cycles. With ShenandoahPacingByCost, we measure the throughput
+ * of both phases, and give evac the share of the free space that matches its expected
+ * share of the remaining cycle time.
  */
 
 void ShenandoahPacer::setup_for_mark() {
@@ -83,30 +90,49 @@ void ShenandoahPacer::setup_for_mark() {
 void ShenandoahPacer::setup_for_evac() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
-  size_t used = _heap->collection_set()->used();
+  ShenandoahCollectionSet* cset = _heap->collection_set();
+  size_t used = cset->used();
+  size_t live = used - cset->garbage();
   size_t free = _heap->free_set()->available();
 
   size_t non_taxable = free * ShenandoahPacingCycleSlack / 100;
   size_t taxable = free - non_taxable;
 
+  // Evac is followed by update-refs, claim 1/2 of remaining free, unless
+  // we know better from the cost of recent cycles.
+  double share = 0.5;
+  if (ShenandoahPacingByCost) {
+    double evac_time = expected_time(_evac_rate, live);
+    double updaterefs_time = expected_time(_updaterefs_rate, _heap->used());
+    if (evac_time > 0 && updaterefs_time > 0) {
+      share = clamp(evac_time / (evac_time + updaterefs_time), 0.1, 0.9);
+    }
+  }
+
   double tax = 1.0 * used / taxable; // base tax for available free space
-  tax *= 2;                          // evac is followed by update-refs, claim 1/2 of remaining free
+  tax /= share;                      // claim evac share of remaining free
   tax = MAX2<double>(1, tax);        // never allocate more than GC processes during the phase
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
   restart_with(non_taxable, tax);
+  start_phase(live);
 
-  log_info(gc, ergo)("Pacer for Evacuation. Used CSet: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
-                     "Non-Taxable: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
+  log_info(gc, ergo)("Pacer for Evacuation. Used CSet: " SIZE_FORMAT "%s, Live CSet: " SIZE_FORMAT "%s, "
+                     "Free: " SIZE_FORMAT "%s, Non-Taxable: " SIZE_FORMAT "%s, Evac Share: %.0f%%, "
+                     "Alloc Tax Rate: %.1fx",
                      byte_size_in_proper_unit(used),        proper_unit_for_byte_size(used),
+                     byte_size_in_proper_unit(live),        proper_unit_for_byte_size(live),
                      byte_size_in_proper_unit(free),        proper_unit_for_byte_size(free),
                      byte_size_in_proper_unit(non_taxable), proper_unit_for_byte_size(non_taxable),
-                     tax);
+                     share * 100, tax);
 }
 
 void ShenandoahPacer::setup_for_updaterefs() {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
+  // Evacuation is over, record how fast it was
+  record_phase_rate(_evac_rate);
+
   size_t used = _heap->used();
   size_t free = _heap->free_set()->available();
 
@@ -119,6 +145,7 @@ void ShenandoahPacer::setup_for_updaterefs() {
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
   restart_with(non_taxable, tax);
+  start_phase(used);
 
   log_info(gc, ergo)("Pacer for Update Refs. Used: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
                      "Non-Taxable: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
@@ -165,6 +192,32 @@ void ShenandoahPacer::setup_for_reset() {
                      byte_size_in_proper_unit(initial), proper_unit_for_byte_size(initial));
 }
 
+void ShenandoahPacer::record_updaterefs_done() {
+  assert(ShenandoahPacing, "Only be here when pacing is enabled");
+  record_phase_rate(_updaterefs_rate);
+}
+
+void ShenandoahPacer::start_phase(size_t work_bytes) {
+  _phase_start = os::elapsedTime();
+  _phase_work = work_bytes;
+}
+
+void ShenandoahPacer::record_phase_rate(TruncatedSeq* rate) {
+  double duration = os::elapsedTime() - _phase_start;
+  if (_phase_work > 0 && duration > 0) {
+    rate->add(_phase_work / duration);
+  }
+  _phase_work = 0;
+}
+
+double ShenandoahPacer::expected_time(const TruncatedSeq* rate, size_t work_bytes) {
+  if (rate->num() == 0 || rate->avg() <= 0) {
+    // No history yet
+    return -1;
+  }
+  return work_bytes / rate->avg();
+}
+
 size_t ShenandoahPacer::update_and_get_progress_history() {
   if (_progress == -1) {
     // First initialization, report some prior
@@ -56,6 +56,8 @@ class ShenandoahPeriodicPacerNotifyTask : public PeriodicTask {
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ * With ShenandoahPacingByCost, the free space is split between evacuation and
+ * update-refs according to their measured throughput in recent cycles.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -66,6 +68,12 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
   ShenandoahSharedFlag _need_notify_waiters;
   ShenandoahPeriodicPacerNotifyTask _notify_waiters_task;
 
+  // Measured throughput of recent cycles, in bytes per second
+  TruncatedSeq* _evac_rate;
+  TruncatedSeq* _updaterefs_rate;
+  double _phase_start;
+  size_t _phase_work;
+
   // Set once per phase
   volatile intptr_t _epoch;
   volatile double _tax_rate;
@@ -87,6 +95,10 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
           _progress_history(new TruncatedSeq(5)),
           _wait_monitor(new Monitor(Mutex::safepoint-1, "ShenandoahWaitMonitor_lock", true)),
           _notify_waiters_task(this),
+          _evac_rate(new TruncatedSeq(5)),
+          _updaterefs_rate(new TruncatedSeq(5)),
+          _phase_start(0),
+          _phase_work(0),
           _epoch(0),
           _tax_rate(1),
           _budget(0),
@@ -101,6 +113,8 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 
   void setup_for_reset();
 
+  void record_updaterefs_done();
+
   inline void report_mark(size_t words);
   inline void report_evac(size_t words);
   inline void report_updaterefs(size_t words);
@@ -127,6 +141,10 @@ class ShenandoahPacer : public CHeapObj<mtGC> {
 
   size_t update_and_get_progress_history();
 
+  void start_phase(size_t work_bytes);
+  void record_phase_rate(TruncatedSeq* rate);
+  static double expected_time(const TruncatedSeq* rate, size_t work_bytes);
+
   void wait(size_t time_ms);
 };
 
@@ -268,6 +268,17 @@
           "the beginning of it.")                                           \
           range(1.0, 100.0)                                                 \
                                                                             \
+  product(bool, ShenandoahPacingByCost, false, EXPERIMENTAL,                \
+          "Split the free space between evacuation and update-refs pacing " \
+          "by the expected cost of these phases, based on the live data "   \
+          "in collection set and the throughput measured in recent "        \
+          "cycles, instead of splitting it evenly.")                        \
+                                                                            \
+  product(size_t, ShenandoahUpdateRefsChunkSize, 0, EXPERIMENTAL,           \
+          "Size of the chunks, in bytes, regions are split into when "      \
+          "updating references, so that several workers can share the "     \
+          "work on a single region. 0 processes whole regions.")            \
+                                                                            \
   product(uintx, ShenandoahCriticalFreeThreshold, 1, EXPERIMENTAL,          \
           "How much of the heap needs to be free after recovery cycles, "   \
           "either Degenerated or Full GC to be claimed successful. If this "\
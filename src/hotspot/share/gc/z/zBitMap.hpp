@@ -30,6 +30,9 @@ class ZMovableBitMap : public CHeapBitMap {
 public:
   ZMovableBitMap();
   ZMovableBitMap(ZMovableBitMap&& bitmap);
+
+  // Atomically set the bits in mask, in the word containing bit
+  void par_set_word_bits(idx_t bit, bm_word_t mask);
 };
 
 class ZBitMap : public CHeapBitMap {
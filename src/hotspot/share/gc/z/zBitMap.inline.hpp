@@ -39,6 +39,17 @@ inline ZMovableBitMap::ZMovableBitMap(ZMovableBitMap&& bitmap)
   bitmap.update(nullptr, 0);
 }
 
+inline void ZMovableBitMap::par_set_word_bits(idx_t bit, bm_word_t mask) {
+  verify_index(bit);
+  volatile bm_word_t* const addr = word_addr(bit);
+  if ((Atomic::load(addr) & mask) == mask) {
+    // Already set
+    return;
+  }
+
+  Atomic::fetch_then_or(addr, mask, memory_order_relaxed);
+}
+
 inline ZBitMap::ZBitMap(idx_t size_in_bits)
   : CHeapBitMap(size_in_bits, mtGC, false /* clear */) {}
 
@@ -246,6 +246,7 @@ class ZGenerationYoung : public ZGeneration {
 
   // Add remembered set entries
   void remember(volatile zpointer* p);
+  void remember(volatile zpointer** fields, size_t count);
   void remember_fields(zaddress addr);
 
   // Scan a remembered set entry
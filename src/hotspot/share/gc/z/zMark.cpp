@@ -28,6 +28,7 @@
 #include "code/nmethod.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/markPrefetchQueue.inline.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
 #include "gc/shared/workerThread.hpp"
@@ -494,19 +495,41 @@ bool ZMark::rebalance_work(ZMarkContext* context) {
   return ZAbort::should_abort() || _generation->should_worker_resize();
 }
 
+static const void* prefetch_address(ZMarkStackEntry entry) {
+  if (entry.partial_array()) {
+    return nullptr;
+  }
+  return (const void*)untype(ZOffset::address(to_zoffset(entry.object_address())));
+}
+
 bool ZMark::drain(ZMarkContext* context) {
   ZMarkThreadLocalStacks* const stacks = context->stacks();
+  MarkPrefetchQueue<ZMarkStackEntry> prefetch_queue(MarkingPrefetchDistance);
   ZMarkStackEntry entry;
   size_t processed = 0;
 
   context->set_stripe(_stripes.stripe_for_worker(_nworkers, WorkerThread::worker_id()));
   context->set_nstripes(_stripes.nstripes());
 
-  // Drain stripe stacks
-  while (stacks->pop(&_allocator, &_stripes, context->stripe(), entry)) {
+  // Drain stripe stacks, and then the entries still being prefetched
+  for (;;) {
+    if (stacks->pop(&_allocator, &_stripes, context->stripe(), entry)) {
+      ZMarkStackEntry ready;
+      if (!prefetch_queue.push(entry, prefetch_address(entry), ready)) {
+        continue;
+      }
+      entry = ready;
+    } else if (!prefetch_queue.pop(entry)) {
+      break;
+    }
+
     mark_and_follow(context, entry);
 
     if ((processed++ & 31) == 0 && rebalance_work(context)) {
+      // Give back the entries in flight, the work must not be lost
+      while (prefetch_queue.pop(entry)) {
+        stacks->push(&_allocator, &_stripes, context->stripe(), &_terminate, entry, false /* publish */);
+      }
       return false;
     }
   }
@@ -166,6 +166,7 @@ class ZPage : public CHeapObj<mtGC> {
   void object_iterate(Function function);
 
   void remember(volatile zpointer* p);
+  void remember(volatile zpointer* const* fields, size_t count);
 
   // In-place relocation support
   void clear_remset_bit_non_par_current(uintptr_t l_offset);
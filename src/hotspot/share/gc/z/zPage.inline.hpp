@@ -361,6 +361,15 @@ inline void ZPage::remember(volatile zpointer* p) {
   _remembered_set.set_current(l_offset);
 }
 
+inline void ZPage::remember(volatile zpointer* const* fields, size_t count) {
+  // Fields must be sorted and on this page
+  _remembered_set.set_current(count, [&](size_t i) {
+    const zaddress addr = to_zaddress((uintptr_t)fields[i]);
+    assert(is_in(addr), "Field not on page");
+    return local_offset(addr);
+  });
+}
+
 inline void ZPage::clear_remset_bit_non_par_current(uintptr_t l_offset) {
   _remembered_set.unset_non_par_current(l_offset);
 }
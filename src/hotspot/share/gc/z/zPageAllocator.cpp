@@ -31,10 +31,12 @@
 #include "gc/z/zGenerationId.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zPageCache.hpp"
+#include "gc/z/zPageCachePrepopulator.hpp"
 #include "gc/z/zSafeDelete.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zTask.hpp"
@@ -103,6 +105,7 @@ class ZPageAllocation : public StackObj {
   const ZPageType            _type;
   const size_t               _size;
   const ZAllocationFlags     _flags;
+  const uint32_t             _numa_id;
   const uint32_t             _young_seqnum;
   const uint32_t             _old_seqnum;
   size_t                     _flushed;
@@ -112,10 +115,11 @@ class ZPageAllocation : public StackObj {
   ZFuture<bool>              _stall_result;
 
 public:
-  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags)
+  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t numa_id)
     : _type(type),
       _size(size),
       _flags(flags),
+      _numa_id(numa_id),
       _young_seqnum(ZGeneration::young()->seqnum()),
       _old_seqnum(ZGeneration::old()->seqnum()),
       _flushed(0),
@@ -136,6 +140,10 @@ class ZPageAllocation : public StackObj {
     return _flags;
   }
 
+  uint32_t numa_id() const {
+    return _numa_id;
+  }
+
   uint32_t young_seqnum() const {
     return _young_seqnum;
   }
@@ -197,6 +205,8 @@ ZPageAllocator::ZPageAllocator(size_t min_capacity,
     _stalled(),
     _unmapper(new ZUnmapper(this)),
     _uncommitter(new ZUncommitter(this)),
+    _prepopulator(ZPageCachePrepopulate ? new ZPageCachePrepopulator(this) : nullptr),
+    _prepopulate_target(0),
     _safe_destroy(),
     _safe_recycle(this),
     _initialized(false) {
@@ -264,7 +274,7 @@ bool ZPageAllocator::prime_cache(ZWorkers* workers, size_t size) {
   flags.set_non_blocking();
   flags.set_low_address();
 
-  ZPage* const page = alloc_page(ZPageType::large, size, flags, ZPageAge::eden);
+  ZPage* const page = alloc_page(ZPageType::large, size, flags, ZPageAge::eden, ZNUMA::id());
   if (page == nullptr) {
     return false;
   }
@@ -467,14 +477,14 @@ bool ZPageAllocator::is_alloc_allowed(size_t size) const {
   return available >= size;
 }
 
-bool ZPageAllocator::alloc_page_common_inner(ZPageType type, size_t size, ZList<ZPage>* pages) {
+bool ZPageAllocator::alloc_page_common_inner(ZPageType type, size_t size, uint32_t numa_id, ZList<ZPage>* pages) {
   if (!is_alloc_allowed(size)) {
     // Out of memory
     return false;
   }
 
   // Try allocate from the page cache
-  ZPage* const page = _cache.alloc_page(type, size);
+  ZPage* const page = _cache.alloc_page(type, size, numa_id);
   if (page != nullptr) {
     // Success
     pages->insert_last(page);
@@ -500,7 +510,7 @@ bool ZPageAllocator::alloc_page_common(ZPageAllocation* allocation) {
   const ZAllocationFlags flags = allocation->flags();
   ZList<ZPage>* const pages = allocation->pages();
 
-  if (!alloc_page_common_inner(type, size, pages)) {
+  if (!alloc_page_common_inner(type, size, allocation->numa_id(), pages)) {
     // Out of memory
     return false;
   }
@@ -696,11 +706,11 @@ ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
   return nullptr;
 }
 
-ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age) {
+ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t numa_id) {
   EventZPageAllocation event;
 
 retry:
-  ZPageAllocation allocation(type, size, flags);
+  ZPageAllocation allocation(type, size, flags, numa_id);
 
   // Allocate one or more pages from the page cache. If the allocation
   // succeeds but the returned pages don't cover the complete allocation,
@@ -868,11 +878,12 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     SuspendibleThreadSetJoiner sts_joiner;
     ZLocker<ZLock> locker(&_lock);
 
-    // Never uncommit below min capacity. We flush out and uncommit chunks at
-    // a time (~0.8% of the max capacity, but at least one granule and at most
-    // 256M), in case demand for memory increases while we are uncommitting.
-    const size_t retain = MAX2(_used, _min_capacity);
-    const size_t release = _capacity - retain;
+    // Never uncommit below min capacity, or memory the page cache is being
+    // pre-populated with. We flush out and uncommit chunks at a time (~0.8%
+    // of the max capacity, but at least one granule and at most 256M), in
+    // case demand for memory increases while we are uncommitting.
+    const size_t retain = MAX2(_used + Atomic::load(&_prepopulate_target), _min_capacity);
+    const size_t release = _capacity > retain ? _capacity - retain : 0;
     const size_t limit = MIN2(align_up(_current_max_capacity >> 7, ZGranuleSize), 256 * M);
     const size_t flush = MIN2(release, limit);
 
@@ -907,6 +918,90 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
   return flushed;
 }
 
+bool ZPageAllocator::prepopulate_page(size_t target) {
+  const size_t size = ZPageSizeSmall;
+
+  {
+    // We need to join the suspendible thread set while manipulating capacity,
+    // to make sure GC safepoints will have a consistent view.
+    SuspendibleThreadSetJoiner sts_joiner;
+    ZLocker<ZLock> locker(&_lock);
+
+    if (unused() >= target) {
+      // Enough memory already cached
+      return false;
+    }
+
+    if (_stalled.first() != nullptr || _capacity + size > soft_max_capacity()) {
+      // Memory is needed elsewhere, don't grow
+      return false;
+    }
+
+    const size_t increased = increase_capacity(size);
+    if (increased < size) {
+      // Could not increase capacity
+      decrease_capacity(increased, false /* set_max_capacity */);
+      return false;
+    }
+
+    // Record new memory as claimed until it has been cached
+    Atomic::add(&_claimed, size);
+  }
+
+  ZPage* page = nullptr;
+  const ZVirtualMemory vmem = _virtual.alloc(size, true /* force_low_address */);
+  if (!vmem.is_null()) {
+    ZPhysicalMemory pmem;
+    _physical.alloc(pmem, size);
+    page = new ZPage(ZPageType::small, vmem, pmem);
+  }
+
+  ZPage* committed_page = page;
+  if (page != nullptr && !commit_page(page)) {
+    // Failed or partially failed. Cache any successfully committed part.
+    committed_page = page->split_committed();
+    destroy_page(page);
+  }
+
+  if (committed_page != nullptr) {
+    map_page(committed_page);
+
+    // Pre-touch page
+    _physical.pretouch(committed_page->start(), committed_page->size());
+  }
+
+  SuspendibleThreadSetJoiner sts_joiner;
+  ZLocker<ZLock> locker(&_lock);
+
+  Atomic::sub(&_claimed, size);
+
+  if (committed_page == nullptr || committed_page->size() < size) {
+    // Adjust capacity to reflect the failed capacity increase
+    const size_t committed = committed_page != nullptr ? committed_page->size() : 0;
+    decrease_capacity(size - committed, !vmem.is_null() /* set_max_capacity */);
+  }
+
+  if (committed_page != nullptr) {
+    recycle_page(committed_page);
+
+    // Try satisfy stalled allocations
+    satisfy_stalled();
+  }
+
+  return committed_page == page && page != nullptr;
+}
+
+size_t ZPageAllocator::prepopulate_cache(size_t target) {
+  Atomic::store(&_prepopulate_target, target);
+
+  size_t prepopulated = 0;
+  while (prepopulate_page(target)) {
+    prepopulated += ZPageSizeSmall;
+  }
+
+  return prepopulated;
+}
+
 void ZPageAllocator::enable_safe_destroy() const {
   _safe_destroy.enable_deferred_delete();
 }
@@ -996,4 +1091,7 @@ void ZPageAllocator::handle_alloc_stalling_for_old(bool cleared_soft_refs) {
 void ZPageAllocator::threads_do(ThreadClosure* tc) const {
   tc->do_thread(_unmapper);
   tc->do_thread(_uncommitter);
+  if (_prepopulator != nullptr) {
+    tc->do_thread(_prepopulator);
+  }
 }
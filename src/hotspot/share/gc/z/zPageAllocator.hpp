@@ -40,6 +40,7 @@ class ZGeneration;
 class ZPageAllocation;
 class ZPageAllocator;
 class ZPageAllocatorStats;
+class ZPageCachePrepopulator;
 class ZWorkers;
 class ZUncommitter;
 class ZUnmapper;
@@ -62,6 +63,7 @@ class ZPageAllocator {
   friend class VMStructs;
   friend class ZUnmapper;
   friend class ZUncommitter;
+  friend class ZPageCachePrepopulator;
 
 private:
   mutable ZLock              _lock;
@@ -83,6 +85,8 @@ class ZPageAllocator {
   ZList<ZPageAllocation>     _stalled;
   ZUnmapper*                 _unmapper;
   ZUncommitter*              _uncommitter;
+  ZPageCachePrepopulator*    _prepopulator;
+  volatile size_t            _prepopulate_target;
   mutable ZSafeDelete<ZPage> _safe_destroy;
   mutable ZSafePageRecycle   _safe_recycle;
   bool                       _initialized;
@@ -106,7 +110,7 @@ class ZPageAllocator {
 
   bool is_alloc_allowed(size_t size) const;
 
-  bool alloc_page_common_inner(ZPageType type, size_t size, ZList<ZPage>* pages);
+  bool alloc_page_common_inner(ZPageType type, size_t size, uint32_t numa_id, ZList<ZPage>* pages);
   bool alloc_page_common(ZPageAllocation* allocation);
   bool alloc_page_stall(ZPageAllocation* allocation);
   bool alloc_page_or_stall(ZPageAllocation* allocation);
@@ -120,6 +124,9 @@ class ZPageAllocator {
 
   size_t uncommit(uint64_t* timeout);
 
+  bool prepopulate_page(size_t target);
+  size_t prepopulate_cache(size_t target);
+
   void notify_out_of_memory();
   void restart_gc() const;
 
@@ -148,7 +155,7 @@ class ZPageAllocator {
 
   void reset_statistics(ZGenerationId id);
 
-  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age);
+  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t numa_id);
   void recycle_page(ZPage* page);
   void safe_destroy_page(ZPage* page);
   void free_page(ZPage* page);
@@ -60,8 +60,7 @@ ZPageCache::ZPageCache()
     _large(),
     _last_commit(0) {}
 
-ZPage* ZPageCache::alloc_small_page() {
-  const uint32_t numa_id = ZNUMA::id();
+ZPage* ZPageCache::alloc_small_page(uint32_t numa_id) {
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
@@ -151,12 +150,12 @@ ZPage* ZPageCache::alloc_oversized_page(size_t size) {
   return page;
 }
 
-ZPage* ZPageCache::alloc_page(ZPageType type, size_t size) {
+ZPage* ZPageCache::alloc_page(ZPageType type, size_t size, uint32_t numa_id) {
   ZPage* page;
 
   // Try allocate exact page
   if (type == ZPageType::small) {
-    page = alloc_small_page();
+    page = alloc_small_page(numa_id);
   } else if (type == ZPageType::medium) {
     page = alloc_medium_page();
   } else {
@@ -38,7 +38,7 @@ class ZPageCache {
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
 
-  ZPage* alloc_small_page();
+  ZPage* alloc_small_page(uint32_t numa_id);
   ZPage* alloc_medium_page();
   ZPage* alloc_large_page(size_t size);
 
@@ -54,7 +54,7 @@ class ZPageCache {
 public:
   ZPageCache();
 
-  ZPage* alloc_page(ZPageType type, size_t size);
+  ZPage* alloc_page(ZPageType type, size_t size, uint32_t numa_id);
   void free_page(ZPage* page);
 
   void flush_for_allocation(size_t requested, ZList<ZPage>* to);
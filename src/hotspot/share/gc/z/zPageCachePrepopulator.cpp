@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/z/zGlobals.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zLock.inline.hpp"
+#include "gc/z/zPageAllocator.hpp"
+#include "gc/z/zPageCachePrepopulator.hpp"
+#include "gc/z/zStat.hpp"
+#include "logging/log.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/init.hpp"
+#include "utilities/align.hpp"
+
+static const ZStatCounter ZCounterPageCachePrepopulate("Memory", "Page Cache Prepopulate", ZStatUnitBytesPerSecond);
+
+ZPageCachePrepopulator::ZPageCachePrepopulator(ZPageAllocator* page_allocator)
+  : _page_allocator(page_allocator),
+    _lock(),
+    _stop(false) {
+  set_name("ZPageCachePrepopulator");
+  create_and_start();
+}
+
+bool ZPageCachePrepopulator::wait() const {
+  ZLocker<ZConditionLock> locker(&_lock);
+  if (!_stop) {
+    _lock.wait(ZPageCachePrepopulateInterval);
+  }
+
+  return !_stop;
+}
+
+size_t ZPageCachePrepopulator::prepopulate_target() const {
+  // Cover the predicted allocation until the next round, using the same
+  // allocation rate prediction as the director's GC heuristics.
+  const ZStatMutatorAllocRateStats alloc_rate = ZStatMutatorAllocRate::stats();
+  const double rate = MAX2(alloc_rate._predict, alloc_rate._avg) + alloc_rate._sd;
+  const double bytes = rate * ZPageCachePrepopulateInterval / MILLIUNITS;
+  const double max_bytes = (double)_page_allocator->soft_max_capacity();
+  return align_up((size_t)MIN2(bytes, max_bytes), ZPageSizeSmall);
+}
+
+void ZPageCachePrepopulator::run_thread() {
+  while (wait()) {
+    if (!is_init_completed()) {
+      // Allocation rate not yet sampled
+      continue;
+    }
+
+    const size_t target = prepopulate_target();
+    const size_t prepopulated = _page_allocator->prepopulate_cache(target);
+    if (prepopulated > 0) {
+      // Update statistics
+      ZStatInc(ZCounterPageCachePrepopulate, prepopulated);
+      log_debug(gc, heap)("Page Cache Prepopulated: " SIZE_FORMAT "M, Target: " SIZE_FORMAT "M",
+                          prepopulated / M, target / M);
+    }
+  }
+}
+
+void ZPageCachePrepopulator::terminate() {
+  ZLocker<ZConditionLock> locker(&_lock);
+  _stop = true;
+  _lock.notify_all();
+}
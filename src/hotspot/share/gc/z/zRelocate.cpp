@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -385,7 +386,7 @@ zaddress ZRelocate::forward_object(ZForwarding* forwarding, zaddress_unsafe from
   return to_addr;
 }
 
-static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, size_t size) {
+static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, size_t size, uint32_t numa_id) {
   if (ZStressRelocateInPlace) {
     // Simulate failure to allocate a new page. This will
     // cause the page being relocated to be relocated in-place.
@@ -396,7 +397,7 @@ static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, siz
   flags.set_non_blocking();
   flags.set_gc_relocation();
 
-  return allocator->alloc_page_for_relocation(type, size, flags);
+  return allocator->alloc_page_for_relocation(type, size, flags, numa_id);
 }
 
 static void retire_target_page(ZGeneration* generation, ZPage* page) {
@@ -426,8 +427,10 @@ class ZRelocateSmallAllocator {
       _in_place_count(0) {}
 
   ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
+    // Prefer a target page on the same NUMA node as the page being relocated
     ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size());
+    const uint32_t numa_id = forwarding->page()->numa_id();
+    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size(), numa_id);
     if (page == nullptr) {
       Atomic::inc(&_in_place_count);
     }
@@ -510,7 +513,7 @@ class ZRelocateMediumAllocator {
     const ZPageAge to_age = forwarding->to_age();
     if (shared(to_age) == target) {
       ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-      ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size());
+      ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size(), ZNUMA::id());
       set_shared(to_age, to_page);
       if (to_page == nullptr) {
         Atomic::inc(&_in_place_count);
@@ -563,6 +566,7 @@ class ZRelocateWork : public StackObj {
   Allocator* const   _allocator;
   ZForwarding*       _forwarding;
   ZPage*             _target[ZAllocator::_relocation_allocators];
+  ZPage**            _numa_targets;
   ZGeneration* const _generation;
   size_t             _other_promoted;
   size_t             _other_compacted;
@@ -575,6 +579,41 @@ class ZRelocateWork : public StackObj {
     _target[static_cast<uint>(age) - 1] = page;
   }
 
+  ZPage** numa_target_addr(ZPageAge age, uint32_t numa_id) {
+    return &_numa_targets[(static_cast<uint>(age) - 1) * ZNUMA::count() + numa_id];
+  }
+
+  void select_numa_target() {
+    if (_numa_targets == nullptr || _forwarding->type() != ZPageType::small) {
+      // Not NUMA aware
+      return;
+    }
+
+    const ZPageAge to_age = _forwarding->to_age();
+    ZPage* const current = target(to_age);
+    const uint32_t numa_id = _forwarding->page()->numa_id();
+    if (current != nullptr && current->numa_id() == numa_id) {
+      // Current target page is already local
+      return;
+    }
+
+    // Park the current target page on its node, and continue with the
+    // parked target page of the source page's node, if any. Pages are
+    // parked rather than retired, to avoid leaving partially filled
+    // target pages behind when source pages alternate between nodes.
+    if (current != nullptr) {
+      ZPage** const parked = numa_target_addr(to_age, current->numa_id());
+      if (*parked != nullptr) {
+        _allocator->free_target_page(*parked);
+      }
+      *parked = current;
+    }
+
+    ZPage** const local = numa_target_addr(to_age, numa_id);
+    set_target(to_age, *local);
+    *local = nullptr;
+  }
+
   size_t object_alignment() const {
     return (size_t)1 << _forwarding->object_alignment_shift();
   }
@@ -886,14 +925,30 @@ class ZRelocateWork : public StackObj {
     : _allocator(allocator),
       _forwarding(nullptr),
       _target(),
+      _numa_targets(nullptr),
       _generation(generation),
       _other_promoted(0),
-      _other_compacted(0) {}
+      _other_compacted(0) {
+    if (ZNUMA::count() > 1) {
+      const size_t count = ZAllocator::_relocation_allocators * ZNUMA::count();
+      _numa_targets = NEW_C_HEAP_ARRAY(ZPage*, count, mtGC);
+      for (size_t i = 0; i < count; i++) {
+        _numa_targets[i] = nullptr;
+      }
+    }
+  }
 
   ~ZRelocateWork() {
     for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
       _allocator->free_target_page(_target[i]);
     }
+    if (_numa_targets != nullptr) {
+      const size_t count = ZAllocator::_relocation_allocators * ZNUMA::count();
+      for (size_t i = 0; i < count; i++) {
+        _allocator->free_target_page(_numa_targets[i]);
+      }
+      FREE_C_HEAP_ARRAY(ZPage*, _numa_targets);
+    }
     // Report statistics on-behalf of non-worker threads
     _generation->increase_promoted(_other_promoted);
     _generation->increase_compacted(_other_compacted);
@@ -968,6 +1023,8 @@ class ZRelocateWork : public StackObj {
 
     _forwarding->page()->log_msg(" (relocate page)");
 
+    select_numa_target();
+
     ZVerify::before_relocation(_forwarding);
 
     // Relocate objects
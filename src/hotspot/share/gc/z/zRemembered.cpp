@@ -47,6 +47,35 @@ ZRemembered::ZRemembered(ZPageTable* page_table,
     _page_allocator(page_allocator),
     _found_old() {}
 
+void ZRemembered::remember(volatile zpointer** fields, size_t count) const {
+  // Sort by address, so that fields on the same page and in the same
+  // remembered set bitmap word end up next to each other. Duplicates
+  // end up next to each other too, and are merged by the page.
+  for (size_t i = 1; i < count; i++) {
+    volatile zpointer* const p = fields[i];
+    size_t j = i;
+    for (; j > 0 && fields[j - 1] > p; j--) {
+      fields[j] = fields[j - 1];
+    }
+    fields[j] = p;
+  }
+
+  // Update the remembered set of each page once
+  size_t start = 0;
+  while (start < count) {
+    ZPage* const page = _page_table->get(fields[start]);
+    assert(page != nullptr, "Page missing in page table");
+
+    size_t end = start + 1;
+    while (end < count && page->is_in(to_zaddress((uintptr_t)fields[end]))) {
+      end++;
+    }
+
+    page->remember(fields + start, end - start);
+    start = end;
+  }
+}
+
 template <typename Function>
 void ZRemembered::oops_do_forwarded_via_containing(GrowableArrayView<ZRememberedSetContaining>* array, Function function) const {
   // The array contains duplicated from_addr values. Cache expensive operations.
@@ -84,6 +84,10 @@ class ZRemembered {
   // Add to remembered set
   void remember(volatile zpointer* p) const;
 
+  // Add a batch of fields to the remembered set. The
+  // fields array is sorted in place.
+  void remember(volatile zpointer** fields, size_t count) const;
+
   // Scan all remembered sets and follow
   void scan_and_follow(ZMark* mark);
 
@@ -26,6 +26,8 @@
 
 #include "gc/z/zRememberedSet.hpp"
 
+#include "gc/z/zBitMap.inline.hpp"
+#include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
 
 inline CHeapBitMap* ZRememberedSet::current() {
@@ -73,6 +75,30 @@ inline bool ZRememberedSet::set_current(uintptr_t offset) {
   return current()->par_set_bit(index, memory_order_relaxed);
 }
 
+template <typename Function>
+inline void ZRememberedSet::set_current(size_t count, Function offset_at) {
+  ZMovableBitMap* const bitmap = &_bitmap[_current];
+  BitMap::idx_t word_start = 0;
+  BitMap::bm_word_t mask = 0;
+
+  for (size_t i = 0; i < count; i++) {
+    const BitMap::idx_t index = to_index(offset_at(i));
+    const BitMap::idx_t index_word_start = align_down(index, (BitMap::idx_t)BitsPerWord);
+    if (mask != 0 && index_word_start != word_start) {
+      // Moved on to the next word, flush the collected bits
+      bitmap->par_set_word_bits(word_start, mask);
+      mask = 0;
+    }
+
+    word_start = index_word_start;
+    mask |= (BitMap::bm_word_t)1 << (index - index_word_start);
+  }
+
+  if (mask != 0) {
+    bitmap->par_set_word_bits(word_start, mask);
+  }
+}
+
 inline void ZRememberedSet::unset_non_par_current(uintptr_t offset) {
   const BitMap::idx_t index = to_index(offset);
   current()->clear_bit(index);
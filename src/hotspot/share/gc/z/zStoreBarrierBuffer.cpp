@@ -276,12 +276,24 @@ void ZStoreBarrierBuffer::flush() {
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
+  // Collect fields in old pages, and remember them in one batch
+  volatile zpointer* remembered[_buffer_length];
+  size_t nremembered = 0;
+
   for (int i = current(); i < (int)_buffer_length; ++i) {
     const ZStoreBarrierEntry& entry = _buffer[i];
     const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+    if (!is_null(addr)) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
+
+    if (ZHeap::heap()->is_old(entry._p)) {
+      remembered[nremembered++] = entry._p;
+    }
   }
 
+  ZGeneration::young()->remember(remembered, nremembered);
+
   clear();
 }
 
@@ -71,6 +71,16 @@
           "Young generation tenuring threshold, -1 for dynamic computation")\
           range(-1, static_cast<int>(ZPageAgeMax))                          \
                                                                             \
+  product(bool, ZPageCachePrepopulate, false, EXPERIMENTAL,                 \
+          "Keep enough committed and pre-touched memory in the page cache " \
+          "to cover the predicted allocation rate")                         \
+                                                                            \
+  product(uint, ZPageCachePrepopulateInterval, 100, EXPERIMENTAL,           \
+          "Interval (in milliseconds) between page cache pre-population "   \
+          "rounds. Each round caches enough memory to cover the predicted " \
+          "allocation during one interval")                                 \
+          range(1, 10000)                                                   \
+                                                                            \
   develop(size_t, ZForceDiscontiguousHeapReservations, 0,                   \
           "The gc will attempt to split the heap reservation into this "    \
           "many reservations, subject to available virtual address space "  \
@@ -444,26 +444,29 @@ inline unsigned int OopMapCache::hash_value_for(const methodHandle& method, int
 
 OopMapCacheEntry* volatile OopMapCache::_old_entries = nullptr;
 
-OopMapCache::OopMapCache() {
-  for(int i = 0; i < size; i++) _array[i] = nullptr;
+OopMapCache::OopMapCache() :
+  _size(InterpreterOopMapCacheSize),
+  _array(NEW_C_HEAP_ARRAY(OopMapCacheEntry* volatile, _size, mtClass)) {
+  for(int i = 0; i < _size; i++) _array[i] = nullptr;
 }
 
 
 OopMapCache::~OopMapCache() {
   // Deallocate oop maps that are allocated out-of-line
   flush();
+  FREE_C_HEAP_ARRAY(OopMapCacheEntry* volatile, _array);
 }
 
 OopMapCacheEntry* OopMapCache::entry_at(int i) const {
-  return Atomic::load_acquire(&(_array[i % size]));
+  return Atomic::load_acquire(&(_array[i % _size]));
 }
 
 bool OopMapCache::put_at(int i, OopMapCacheEntry* entry, OopMapCacheEntry* old) {
-  return Atomic::cmpxchg(&_array[i % size], old, entry) == old;
+  return Atomic::cmpxchg(&_array[i % _size], old, entry) == old;
 }
 
 void OopMapCache::flush() {
-  for (int i = 0; i < size; i++) {
+  for (int i = 0; i < _size; i++) {
     OopMapCacheEntry* entry = _array[i];
     if (entry != nullptr) {
       _array[i] = nullptr;  // no barrier, only called in OopMapCache destructor
@@ -474,7 +477,7 @@ void OopMapCache::flush() {
 
 void OopMapCache::flush_obsolete_entries() {
   assert(SafepointSynchronize::is_at_safepoint(), "called by RedefineClasses in a safepoint");
-  for (int i = 0; i < size; i++) {
+  for (int i = 0; i < _size; i++) {
     OopMapCacheEntry* entry = _array[i];
     if (entry != nullptr && !entry->is_empty() && entry->method()->is_old()) {
       // Cache entry is occupied by an old redefined method and we don't want
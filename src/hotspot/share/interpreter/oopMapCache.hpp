@@ -152,10 +152,10 @@ class InterpreterOopMap: ResourceObj {
 class OopMapCache : public CHeapObj<mtClass> {
  static OopMapCacheEntry* volatile _old_entries;
  private:
-  static constexpr int size = 32;        // Use fixed size for now
   static constexpr int probe_depth = 3;  // probe depth in case of collisions
 
-  OopMapCacheEntry* volatile _array[size];
+  const int _size;                       // InterpreterOopMapCacheSize at creation
+  OopMapCacheEntry* volatile* _array;
 
   unsigned int hash_value_for(const methodHandle& method, int bci) const;
   OopMapCacheEntry* entry_at(int i) const;
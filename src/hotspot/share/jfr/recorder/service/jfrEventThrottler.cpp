@@ -35,43 +35,78 @@ constexpr static const JfrSamplerParams _disabled_params = {
                                                              false // reconfigure
                                                            };
 
-static JfrEventThrottler* _throttler = nullptr;
+// The event types declared with throttle="true" in metadata.xml.
+// Throttlers for event types other than jdk.ObjectAllocationSample accept
+// every event until the recording configures a throttle for them.
+struct JfrThrottledEvent {
+  JfrEventId _id;
+  const char* _name;
+  bool _accept_until_configured;
+};
 
-JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
+static const JfrThrottledEvent _throttled_events[] = {
+  { JfrObjectAllocationSampleEvent, "jdk.ObjectAllocationSample", false },
+  { JfrJavaMonitorEnterEvent,       "jdk.JavaMonitorEnter",       true  },
+  { JfrThreadParkEvent,             "jdk.ThreadPark",             true  }
+};
+
+static const size_t _num_throttled_events = ARRAY_SIZE(_throttled_events);
+
+static JfrEventThrottler* _throttlers[_num_throttled_events] = {};
+
+static int throttled_event_index(JfrEventId event_id) {
+  for (size_t i = 0; i < _num_throttled_events; ++i) {
+    if (_throttled_events[i]._id == event_id) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+JfrEventThrottler::JfrEventThrottler(JfrEventId event_id, bool disabled) :
   JfrAdaptiveSampler(),
   _last_params(),
   _sample_size(0),
   _period_ms(0),
   _sample_size_ewma(0),
   _event_id(event_id),
-  _disabled(false),
+  _disabled(disabled),
   _update(false) {}
 
 bool JfrEventThrottler::create() {
-  assert(_throttler == nullptr, "invariant");
-  _throttler = new JfrEventThrottler(JfrObjectAllocationSampleEvent);
-  return _throttler != nullptr && _throttler->initialize();
+  for (size_t i = 0; i < _num_throttled_events; ++i) {
+    assert(_throttlers[i] == nullptr, "invariant");
+    const JfrThrottledEvent& event = _throttled_events[i];
+    _throttlers[i] = new JfrEventThrottler(event._id, event._accept_until_configured);
+    if (_throttlers[i] == nullptr || !_throttlers[i]->initialize()) {
+      return false;
+    }
+  }
+  return true;
 }
 
 void JfrEventThrottler::destroy() {
-  delete _throttler;
-  _throttler = nullptr;
+  for (size_t i = 0; i < _num_throttled_events; ++i) {
+    delete _throttlers[i];
+    _throttlers[i] = nullptr;
+  }
 }
 
-// There is currently only one throttler instance, for the jdk.ObjectAllocationSample event.
-// When introducing additional throttlers, also add a lookup map keyed by event id.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent, "Event type has an unconfigured throttler");
-  return event_id == JfrObjectAllocationSampleEvent ? _throttler : nullptr;
+  const int index = throttled_event_index(event_id);
+  assert(index >= 0, "Event type has an unconfigured throttler");
+  if (index < 0) {
+    return nullptr;
+  }
+  assert(_throttlers[index] != nullptr, "JfrEventThrottler has not been properly initialized");
+  return _throttlers[index];
 }
 
 void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int64_t period_ms) {
-  if (event_id != JfrObjectAllocationSampleEvent) {
+  if (throttled_event_index(event_id) < 0) {
     return;
   }
-  assert(_throttler != nullptr, "JfrEventThrottler has not been properly initialized");
-  _throttler->configure(sample_size, period_ms);
+  for_event(event_id)->configure(sample_size, period_ms);
 }
 
 /*
@@ -94,7 +129,7 @@ void JfrEventThrottler::configure(int64_t sample_size, int64_t period_ms) {
 bool JfrEventThrottler::accept(JfrEventId event_id, int64_t timestamp /* 0 */) {
   JfrEventThrottler* const throttler = for_event(event_id);
   if (throttler == nullptr) return true;
-  return _throttler->_disabled ? true : _throttler->sample(timestamp);
+  return throttler->_disabled ? true : throttler->sample(timestamp);
 }
 
 /*
@@ -241,14 +276,13 @@ inline double compute_ewma_alpha_coefficient(size_t lookback_count) {
  * Monitoring the relation of average sample size to the window set point, i.e the target,
  * is a good indicator of how the throttler is performing over time.
  *
- * Note: there is currently only one throttler instance, for the ObjectAllocationSample event.
- * When introducing additional throttlers, also provide a map from the event id to the event name.
  */
-static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
+static void log(JfrEventId event_id, const JfrSamplerWindow* expired, double* sample_size_ewma) {
   assert(sample_size_ewma != nullptr, "invariant");
   if (log_is_enabled(Debug, jfr, system, throttle)) {
     *sample_size_ewma = exponentially_weighted_moving_average(static_cast<double>(expired->sample_size()), compute_ewma_alpha_coefficient(expired->params().window_lookback_count), *sample_size_ewma);
-    log_debug(jfr, system, throttle)("jdk.ObjectAllocationSample: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+    log_debug(jfr, system, throttle)("%s: avg.sample size: %0.4f, window set point: %zu, sample size: %zu, population size: %zu, ratio: %.4f, window duration: %zu ms\n",
+      _throttled_events[throttled_event_index(event_id)]._name,
       *sample_size_ewma, expired->params().sample_points_per_window, expired->sample_size(), expired->population_size(),
       expired->population_size() == 0 ? 0 : static_cast<double>(expired->sample_size()) / static_cast<double>(expired->population_size()),
       expired->params().window_duration_ms);
@@ -268,7 +302,7 @@ static void log(const JfrSamplerWindow* expired, double* sample_size_ewma) {
 const JfrSamplerParams& JfrEventThrottler::next_window_params(const JfrSamplerWindow* expired) {
   assert(expired != nullptr, "invariant");
   assert(_lock, "invariant");
-  log(expired, &_sample_size_ewma);
+  log(_event_id, expired, &_sample_size_ewma);
   if (_update) {
     return update_params(expired); // Updates _last_params in-place.
   }
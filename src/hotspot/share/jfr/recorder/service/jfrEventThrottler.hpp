@@ -42,7 +42,7 @@ class JfrEventThrottler : public JfrAdaptiveSampler {
 
   static bool create();
   static void destroy();
-  JfrEventThrottler(JfrEventId event_id);
+  JfrEventThrottler(JfrEventId event_id, bool disabled);
   void configure(int64_t event_sample_size, int64_t period_ms);
 
   const JfrSamplerParams& update_params(const JfrSamplerWindow* expired);
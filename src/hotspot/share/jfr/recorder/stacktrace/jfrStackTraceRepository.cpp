@@ -28,13 +28,19 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Lookups of existing traces are lock-free. New traces are only pushed at the head
+ * of a bucket while holding JfrStacktrace_lock, and traces are only deleted after a
+ * GlobalCounter synchronization, so readers always walk well-formed chains.
  */
 
 static JfrStackTraceRepository* _instance = nullptr;
@@ -97,51 +103,86 @@ bool JfrStackTraceRepository::is_modified() const {
   return _last_entries != _entries;
 }
 
-size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (_entries == 0) {
-    return 0;
+// Chains all buckets into a single list and empties the table.
+// Lock-free readers may still be walking the old chains, so the
+// list must be passed to delete_all() after the lock is released.
+JfrStackTrace* JfrStackTraceRepository::unlink_all() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace* list = nullptr;
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    JfrStackTrace* const head = _table[i];
+    if (head == nullptr) {
+      continue;
+    }
+    JfrStackTrace* tail = head;
+    while (tail->next() != nullptr) {
+      tail = const_cast<JfrStackTrace*>(tail->next());
+    }
+    Atomic::release_store(&tail->_next, const_cast<const JfrStackTrace*>(list));
+    Atomic::release_store(&_table[i], (JfrStackTrace*)nullptr);
+    list = head;
+  }
+  return list;
+}
+
+// Waits for lock-free readers of the unlinked chains before deleting them.
+// Called without JfrStacktrace_lock, so that the synchronization neither
+// stalls the samplers nor waits on readers while holding an event rank lock.
+void JfrStackTraceRepository::delete_all(JfrStackTrace* list) {
+  assert(!JfrStacktrace_lock->owned_by_self(), "invariant");
+  if (list == nullptr) {
+    return;
   }
+  GlobalCounter::write_synchronize();
+  while (list != nullptr) {
+    JfrStackTrace* next = const_cast<JfrStackTrace*>(list->next());
+    delete list;
+    list = next;
+  }
+}
+
+size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
+  JfrStackTrace* unlinked = nullptr;
   int count = 0;
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
-    while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
-      }
-      if (clear) {
-        delete stacktrace;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (_entries == 0) {
+      return 0;
+    }
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      JfrStackTrace* stacktrace = _table[i];
+      while (stacktrace != nullptr) {
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
+        stacktrace = const_cast<JfrStackTrace*>(stacktrace->next());
       }
-      stacktrace = next;
     }
+    if (clear) {
+      unlinked = unlink_all();
+      _entries = 0;
+    }
+    _last_entries = _entries;
   }
-  if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
-  }
-  _last_entries = _entries;
+  delete_all(unlinked);
   return count;
 }
 
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
-  }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
+  JfrStackTrace* unlinked;
+  size_t processed;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (repo._entries == 0) {
+      return 0;
     }
+    unlinked = repo.unlink_all();
+    processed = repo._entries;
+    repo._entries = 0;
+    repo._last_entries = 0;
   }
-  memset(repo._table, 0, sizeof(repo._table));
-  const size_t processed = repo._entries;
-  repo._entries = 0;
-  repo._last_entries = 0;
+  delete_all(unlinked);
   return processed;
 }
 
@@ -198,25 +239,41 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(stacktrace._nr_of_frames > 0, "invariant");
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
+const JfrStackTrace* JfrStackTraceRepository::lookup(const JfrStackTrace& stacktrace) const {
+  const JfrStackTrace* table_entry = Atomic::load_acquire(&_table[stacktrace._hash % TABLE_SIZE]);
   while (table_entry != nullptr) {
     if (table_entry->equals(stacktrace)) {
-      return table_entry->id();
+      return table_entry;
+    }
+    table_entry = Atomic::load_acquire(&table_entry->_next);
+  }
+  return nullptr;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  assert(stacktrace._nr_of_frames > 0, "invariant");
+  {
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const JfrStackTrace* const existing = lookup(stacktrace);
+    if (existing != nullptr) {
+      return existing->id();
     }
-    table_entry = table_entry->next();
   }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  // Another thread may have added the same trace since the lock-free lookup.
+  const JfrStackTrace* const existing = lookup(stacktrace);
+  if (existing != nullptr) {
+    return existing->id();
+  }
+
+  const size_t index = stacktrace._hash % TABLE_SIZE;
   traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
@@ -57,6 +57,9 @@ class JfrStackTraceRepository : public JfrCHeapObj {
   bool initialize();
 
   bool is_modified() const;
+  const JfrStackTrace* lookup(const JfrStackTrace& stacktrace) const;
+  JfrStackTrace* unlink_all();
+  static void delete_all(JfrStackTrace* list);
   static size_t clear();
   static size_t clear(JfrStackTraceRepository& repo);
   size_t write(JfrChunkWriter& cw, bool clear);
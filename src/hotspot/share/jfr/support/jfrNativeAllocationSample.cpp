@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrNativeAllocationSample.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
+#include "nmt/nmtCommon.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/mutex.hpp"
+#include "runtime/mutexLocker.hpp"
+
+// Committing a sample records the stack trace under JfrStacktrace_lock and
+// may take JfrBuffer_lock, both of rank Mutex::event. A thread that already
+// holds a lock of that rank can not take them, so it is not sampled.
+static bool owns_event_ranked_lock(Thread* thread) {
+  if (JfrStacktrace_lock->owned_by_self() || JfrBuffer_lock->owned_by_self()) {
+    return true;
+  }
+#ifdef ASSERT
+  for (Mutex* m = thread->owned_locks(); m != nullptr; m = m->next()) {
+    if (m->rank() <= Mutex::event) {
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
+void JfrNativeAllocationSample::on_malloc(size_t size, MEMFLAGS flag) {
+  if (!EventNativeMemoryAllocationSample::is_enabled()) {
+    return;
+  }
+  // Allocations made by JFR itself, including the ones
+  // made while committing a sample, are not sampled.
+  if (flag == mtTracing) {
+    return;
+  }
+  Thread* const thread = Thread::current_or_null();
+  if (thread == nullptr || !thread->is_Java_thread()) {
+    return;
+  }
+  // Only sample where the thread can safely walk its own stack.
+  if (JavaThread::cast(thread)->thread_state() != _thread_in_vm) {
+    return;
+  }
+  if (owns_event_ranked_lock(thread)) {
+    return;
+  }
+  JfrThreadLocal* const tl = thread->jfr_thread_local();
+  assert(tl != nullptr, "invariant");
+  if (tl->is_dead() || tl->is_sampling_native_allocation()) {
+    return;
+  }
+  const size_t weight = tl->native_allocated_bytes() + size;
+  if (weight < JfrNativeAllocationSampleInterval) {
+    tl->set_native_allocated_bytes(weight);
+    return;
+  }
+  tl->set_native_allocated_bytes(0);
+  tl->set_sampling_native_allocation(true);
+  EventNativeMemoryAllocationSample event;
+  if (event.should_commit()) {
+    event.set_type(NMTUtil::flag_to_index(flag));
+    event.set_size(size);
+    event.set_weight(weight);
+    event.commit();
+  }
+  tl->set_sampling_native_allocation(false);
+}
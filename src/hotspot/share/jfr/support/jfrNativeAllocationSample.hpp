@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#ifndef SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
+#define SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
+
+#include "memory/allStatic.hpp"
+#include "nmt/memflags.hpp"
+
+// Emits NativeMemoryAllocationSample events for os::malloc calls made by
+// Java threads, once for every JfrNativeAllocationSampleInterval bytes.
+//
+// on_malloc may be called with any VM lock held. A sample is only taken
+// when the calling thread is a JavaThread in _thread_in_vm and holds no
+// lock of rank Mutex::event; in every other context the call returns
+// without touching the thread's counter.
+class JfrNativeAllocationSample : AllStatic {
+ public:
+  static void on_malloc(size_t size, MEMFLAGS flag);
+};
+
+#endif // SHARE_JFR_SUPPORT_JFRNATIVEALLOCATIONSAMPLE_HPP
@@ -66,6 +66,7 @@ JfrThreadLocal::JfrThreadLocal() :
   _stack_trace_hash(0),
   _parent_trace_id(0),
   _last_allocated_bytes(0),
+  _native_allocated_bytes(0),
   _user_time(0),
   _cpu_time(0),
   _wallclock_time(os::javaTimeNanos()),
@@ -77,7 +78,8 @@ JfrThreadLocal::JfrThreadLocal() :
   _jvm_thread_excluded(false),
   _vthread(false),
   _notified(false),
-  _dead(false) {
+  _dead(false),
+  _sampling_native_allocation(false) {
   Thread* thread = Thread::current_or_null();
   _parent_trace_id = thread != nullptr ? jvm_thread_id(thread) : (traceid)0;
 }
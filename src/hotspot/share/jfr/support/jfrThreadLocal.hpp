@@ -60,6 +60,7 @@ class JfrThreadLocal {
   traceid _stack_trace_hash;
   traceid _parent_trace_id;
   int64_t _last_allocated_bytes;
+  size_t _native_allocated_bytes;
   jlong _user_time;
   jlong _cpu_time;
   jlong _wallclock_time;
@@ -72,6 +73,7 @@ class JfrThreadLocal {
   bool _vthread;
   bool _notified;
   bool _dead;
+  bool _sampling_native_allocation;
 
   JfrBuffer* install_native_buffer() const;
   JfrBuffer* install_java_buffer() const;
@@ -163,6 +165,22 @@ class JfrThreadLocal {
     set_last_allocated_bytes(0);
   }
 
+  size_t native_allocated_bytes() const {
+    return _native_allocated_bytes;
+  }
+
+  void set_native_allocated_bytes(size_t allocated_bytes) {
+    _native_allocated_bytes = allocated_bytes;
+  }
+
+  bool is_sampling_native_allocation() const {
+    return _sampling_native_allocation;
+  }
+
+  void set_sampling_native_allocation(bool value) {
+    _sampling_native_allocation = value;
+  }
+
   // Contextually defined thread id that is volatile,
   // a function of Java carrier thread mounts / unmounts.
   static traceid thread_id(const Thread* t);
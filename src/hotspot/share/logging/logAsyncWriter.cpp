@@ -64,25 +64,45 @@ bool AsyncLogWriter::Buffer::push_back(LogFileStreamOutput* output, const LogDec
   return false;
 }
 
+bool AsyncLogWriter::Buffer::can_fit(size_t msglen) const {
+  const size_t start = align_up(_buf, alignof(Message)) - _buf;
+  return start + Message::calc_size(msglen) <= _capacity - Message::calc_size(0);
+}
+
 void AsyncLogWriter::Buffer::push_flush_token() {
   bool result = push_back(nullptr, AsyncLogWriter::None, "");
   assert(result, "fail to enqueue the flush token.");
 }
 
+// Messages that can never fit are dropped even with -Xlog:async:stall, and so are
+// messages of the AsyncLog Thread itself, which must not wait for its own progress.
+bool AsyncLogWriter::can_stall(size_t msglen) const {
+  return LogConfiguration::async_mode() == LogConfiguration::AsyncMode::Stall &&
+         _buffer->can_fit(msglen) &&
+         Thread::current_or_null() != this;
+}
+
 void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg) {
   // To save space and streamline execution, we just ignore null message.
   // client should use "" instead.
   assert(msg != nullptr, "enqueuing a null message!");
 
-  if (!_buffer->push_back(output, decorations, msg)) {
-    bool p_created;
-    uint32_t* counter = _stats.put_if_absent(output, 0, &p_created);
-    *counter = *counter + 1;
-    return;
+  while (!_buffer->push_back(output, decorations, msg)) {
+    if (!can_stall(strlen(msg))) {
+      bool p_created;
+      uint32_t* counter = _stats.put_if_absent(output, 0, &p_created);
+      *counter = *counter + 1;
+      return;
+    }
+    // Stall until the AsyncLog Thread has swapped in the empty buffer.
+    // The buffer is not empty, so _data_available is already set.
+    _lock.notify_all();
+    _lock.wait(0/* no timeout */);
   }
 
   _data_available = true;
-  _lock.notify();
+  // Stalled logsites wait on the same monitor as the AsyncLog Thread.
+  _lock.notify_all();
 }
 
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations& decorations, const char* msg) {
@@ -91,7 +111,8 @@ void AsyncLogWriter::enqueue(LogFileStreamOutput& output, const LogDecorations&
 }
 
 // LogMessageBuffer consists of a multiple-part/multiple-line message.
-// The lock here guarantees its integrity.
+// The lock here guarantees its integrity, except with -Xlog:async:stall,
+// where other logsites may be interleaved while this one is stalled.
 void AsyncLogWriter::enqueue(LogFileStreamOutput& output, LogMessageBuffer::Iterator msg_iterator) {
   AsyncLogLocker locker;
 
@@ -162,6 +183,8 @@ void AsyncLogWriter::run() {
       // guarantee that I/O jobs don't block logsites.
       _buffer_staging->reset();
       swap(_buffer, _buffer_staging);
+      // Wake up logsites stalled on the full buffer.
+      _lock.notify_all();
 
       // move counters to snapshot and reset them.
       _stats.iterate([&] (LogFileStreamOutput* output, uint32_t& counter) {
@@ -216,7 +239,7 @@ void AsyncLogWriter::flush() {
       // Push directly in-case we are at logical max capacity, as this must not get dropped.
       _instance->_buffer->push_flush_token();
       _instance->_data_available = true;
-      _instance->_lock.notify();
+      _instance->_lock.notify_all();
     }
 
     _instance->_flush_sem.wait();
@@ -50,8 +50,9 @@ class LogFileStreamOutput;
 // successfully initialized. Clients can use its return value to determine async logging is established or not.
 //
 // enqueue() is the basic operation of AsyncLogWriter. Two overloading versions of it are provided to match LogOutput::write().
-// They are both MT-safe and non-blocking. Derived classes of LogOutput can invoke the corresponding enqueue() in write() and
-// return 0. AsyncLogWriter is responsible of copying necessary data.
+// They are both MT-safe. Derived classes of LogOutput can invoke the corresponding enqueue() in write() and return 0.
+// AsyncLogWriter is responsible of copying necessary data. When the buffer is full, enqueue() drops the message with
+// -Xlog:async:drop (the default), and blocks until the AsyncLog Thread has swapped buffers with -Xlog:async:stall.
 //
 // flush() ensures that all pending messages have been written out before it returns. It is not MT-safe in itself. When users
 // change the logging configuration via jcmd, LogConfiguration::configure_output() calls flush() under the protection of the
@@ -126,6 +127,8 @@ class AsyncLogWriter : public NonJavaThread {
 
     void push_flush_token();
     bool push_back(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg);
+    // Whether a message of msglen bytes fits into this buffer once it is empty.
+    bool can_fit(size_t msglen) const;
 
     void reset() {
       // Ensure _pos is Message-aligned
@@ -172,6 +175,7 @@ class AsyncLogWriter : public NonJavaThread {
 
   AsyncLogWriter();
   void enqueue_locked(LogFileStreamOutput* output, const LogDecorations& decorations, const char* msg);
+  bool can_stall(size_t msglen) const;
   void write(AsyncLogMap<AnyObj::RESOURCE_AREA>& snapshot);
   void run() override;
   void pre_run() override {
@@ -637,10 +637,12 @@ void LogConfiguration::print_command_line_help(outputStream* out) {
   out->cr();
 
   out->print_cr("Asynchronous logging (off by default):");
-  out->print_cr(" -Xlog:async");
+  out->print_cr(" -Xlog:async[:[drop|stall]]");
   out->print_cr("  All log messages are written to an intermediate buffer first and will then be flushed"
-                " to the corresponding log outputs by a standalone thread. Write operations at logsites are"
-                " guaranteed non-blocking.");
+                " to the corresponding log outputs by a standalone thread. With 'drop' (the default),"
+                " write operations at logsites are guaranteed non-blocking and messages are dropped when"
+                " the buffer is full. With 'stall', logsites block until there is room in the buffer"
+                " instead, so that no messages are lost.");
   out->cr();
 
   out->print_cr("Some examples:");
@@ -716,4 +718,18 @@ void LogConfiguration::notify_update_listeners() {
   }
 }
 
-bool LogConfiguration::_async_mode = false;
+LogConfiguration::AsyncMode LogConfiguration::_async_mode = AsyncMode::Off;
+
+bool LogConfiguration::parse_async_argument(const char* async_tail) {
+  if (*async_tail == '\0') {
+    // Dropping messages is the default policy.
+    set_async_mode(AsyncMode::Drop);
+  } else if (strcmp(async_tail, ":drop") == 0) {
+    set_async_mode(AsyncMode::Drop);
+  } else if (strcmp(async_tail, ":stall") == 0) {
+    set_async_mode(AsyncMode::Stall);
+  } else {
+    return false;
+  }
+  return true;
+}
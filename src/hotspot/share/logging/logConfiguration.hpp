@@ -47,6 +47,14 @@ class LogConfiguration : public AllStatic {
   // Function for listeners
   typedef void (*UpdateListenerFunction)(void);
 
+  // What async logging does when its buffer is full:
+  // Drop discards the message, Stall blocks the logsite until there is room.
+  enum class AsyncMode {
+    Off,
+    Stall,
+    Drop
+  };
+
   // Register callback for config change.
   // The callback is always called with ConfigurationLock held,
   // hence doing log reconfiguration from the callback will deadlock.
@@ -62,7 +70,7 @@ class LogConfiguration : public AllStatic {
 
   static UpdateListenerFunction*    _listener_callbacks;
   static size_t                     _n_listener_callbacks;
-  static bool                       _async_mode;
+  static AsyncMode                  _async_mode;
 
   // Create a new output. Returns null if failed.
   static LogOutput* new_output(const char* name, const char* options, outputStream* errstream);
@@ -129,10 +137,15 @@ class LogConfiguration : public AllStatic {
   // Rotates all LogOutput
   static void rotate_all_outputs();
 
-  static bool is_async_mode() { return _async_mode; }
-  static void set_async_mode(bool value) {
+  static bool is_async_mode() { return _async_mode != AsyncMode::Off; }
+  static AsyncMode async_mode() { return _async_mode; }
+  static void set_async_mode(AsyncMode value) {
     _async_mode = value;
   }
+
+  // Parses the optional overflow policy following "-Xlog:async".
+  // Returns false if async_tail is not a valid policy.
+  static bool parse_async_argument(const char* async_tail);
 };
 
 #endif // SHARE_LOGGING_LOGCONFIGURATION_HPP
@@ -214,7 +214,11 @@ bool CodeHeap::reserve(ReservedSpace rs, size_t committed_size, size_t segment_s
   assert(c_size <= rs.size(), "alignment made committed size to large");
 
   os::trace_page_sizes(_name, c_size, rs.size(), rs.base(), rs.size(), page_size);
-  if (!_memory.initialize(rs, c_size)) {
+  // A heap reserved with small pages is committed with small pages, even if
+  // its size would allow large ones.
+  const bool initialized = (page_size == os::vm_page_size()) ? _memory.initialize_with_granularity(rs, c_size, page_size)
+                                                             : _memory.initialize(rs, c_size);
+  if (!initialized) {
     return false;
   }
 
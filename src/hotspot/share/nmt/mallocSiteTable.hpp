@@ -52,6 +52,8 @@ class MallocSite : public AllocationSite {
   size_t count() const { return _c.count(); }
 
   const MemoryCounter* counter() const { return &_c; }
+
+  void scale(size_t factor)       { _c.scale(factor); }
 };
 
 // Malloc site hashtable entry
@@ -123,6 +125,9 @@ class MallocSiteTable : AllStatic {
   static uint16_t pos_idx_from_marker(uint32_t marker) { return marker & 0xFFFF; }
 
  public:
+  // Marker for blocks whose call stack was not sampled. It can never be
+  // built from a valid bucket and position index.
+  static const uint32_t unsampled_marker = UINT32_MAX;
 
   static bool initialize();
 
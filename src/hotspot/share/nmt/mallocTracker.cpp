@@ -166,6 +166,19 @@ bool MallocTracker::initialize(NMT_TrackingLevel level) {
   return true;
 }
 
+static volatile uint _malloc_sample_counter = 0;
+
+bool MallocTracker::sample_call_stack() {
+  const uint interval = NMTMallocSiteSampleInterval;
+  if (interval == 1) {
+    return true;
+  }
+  // The counter is shared by all threads, so that exactly one in interval
+  // allocations is sampled. The per-site numbers are scaled by interval
+  // when reported, which is only right if no update is lost.
+  return Atomic::fetch_then_add(&_malloc_sample_counter, 1u) % interval == 0;
+}
+
 // Record a malloc memory allocation
 void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flags,
   const NativeCallStack& stack)
@@ -176,7 +189,12 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MEMFLAGS flag
   MallocMemorySummary::record_malloc(size, flags);
   uint32_t mst_marker = 0;
   if (MemTracker::tracking_level() == NMT_detail) {
-    MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    if (NMTMallocSiteSampleInterval > 1 && stack.is_empty()) {
+      // Call stack not sampled, only the summary accounts for this block.
+      mst_marker = MallocSiteTable::unsampled_marker;
+    } else {
+      MallocSiteTable::allocation_at(stack, size, &mst_marker, flags);
+    }
   }
 
   // Uses placement global new operator to initialize malloc header
@@ -26,6 +26,7 @@
 #ifndef SHARE_NMT_MALLOCTRACKER_HPP
 #define SHARE_NMT_MALLOCTRACKER_HPP
 
+#include "memory/padded.hpp"
 #include "nmt/mallocHeader.hpp"
 #include "nmt/memflags.hpp"
 #include "nmt/nmtCommon.hpp"
@@ -96,6 +97,14 @@ class MemoryCounter {
   inline size_t peak_size() const {
     return Atomic::load(&_peak_size);
   }
+
+  // Only used on copies taken for reporting.
+  inline void scale(size_t factor) {
+    _count      *= factor;
+    _size       *= factor;
+    _peak_count *= factor;
+    _peak_size  *= factor;
+  }
 };
 
 /*
@@ -149,9 +158,16 @@ class MallocMemorySummary;
 class MallocMemorySnapshot {
   friend class MallocMemorySummary;
 
+  // The live counters are updated by every malloc and free. Keep the total
+  // and each per-type counter on cache lines of their own, so that
+  // allocations of different types do not contend through false sharing.
+  // The padding is twice the cache line size because the snapshot itself
+  // is not cache line aligned.
+  static const size_t counter_padding = 2 * DEFAULT_CACHE_LINE_SIZE;
+
  private:
-  MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _all_mallocs;
+  PaddedEnd<MemoryCounter, counter_padding> _all_mallocs;
+  PaddedEnd<MallocMemory, counter_padding>  _malloc[mt_number_of_types];
 
 
  public:
@@ -279,6 +295,10 @@ class MallocTracker : AllStatic {
   // memblock = (char*)malloc_base + sizeof(nmt header)
   //
 
+  // Returns true if the call stack of the next malloc should be recorded,
+  // according to NMTMallocSiteSampleInterval. Only used in detail mode.
+  static bool sample_call_stack();
+
   // Record  malloc on specified memory block
   static void* record_malloc(void* malloc_base, size_t size, MEMFLAGS flags,
     const NativeCallStack& stack);
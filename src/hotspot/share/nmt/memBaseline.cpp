@@ -93,7 +93,12 @@ class MallocAllocationSiteWalker : public MallocSiteWalker {
 
   bool do_malloc_site(const MallocSite* site) {
     if (site->size() > 0) {
-      if (_malloc_sites.add(*site) != nullptr) {
+      MallocSite copy(*site);
+      if (NMTMallocSiteSampleInterval > 1) {
+        // Extrapolate from the sampled allocations.
+        copy.scale(NMTMallocSiteSampleInterval);
+      }
+      if (_malloc_sites.add(copy) != nullptr) {
         return true;
       } else {
         return false;  // OOM
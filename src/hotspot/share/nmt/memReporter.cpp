@@ -310,6 +310,10 @@ void MemDetailReporter::report_detail() {
   // Start detail report
   outputStream* out = output();
   out->print_cr("Details:\n");
+  if (NMTMallocSiteSampleInterval > 1) {
+    out->print_cr("(Malloc call sites sampled once every %u allocations, numbers are estimates.)\n",
+                  NMTMallocSiteSampleInterval);
+  }
 
   int num_omitted =
       report_malloc_sites() +
@@ -40,6 +40,18 @@
 #define CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ?  \
                     NativeCallStack(1) : FAKE_CALLSTACK)
 
+// Variants for malloc call paths, subject to NMTMallocSiteSampleInterval.
+// Allocations whose call stack is not sampled get an empty stack; they
+// are only accounted in the summary.
+#define MALLOC_CURRENT_PC ((MemTracker::tracking_level() == NMT_detail) ? \
+                           (MallocTracker::sample_call_stack() ? \
+                            NativeCallStack(0) : NativeCallStack()) : \
+                           FAKE_CALLSTACK)
+#define MALLOC_CALLER_PC  ((MemTracker::tracking_level() == NMT_detail) ? \
+                           (MallocTracker::sample_call_stack() ? \
+                            NativeCallStack(1) : NativeCallStack()) : \
+                           FAKE_CALLSTACK)
+
 class MemBaseline;
 
 class MemTracker : AllStatic {
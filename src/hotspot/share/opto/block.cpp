@@ -1753,7 +1753,9 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
     } else if (e->state() == CFGEdge::open) {
       // Append traces, even without a fall-thru connection.
       // But leave root entry at the beginning of the block list.
-      if (targ_trace != trace(_cfg.get_root_block())) {
+      // Keep cold traces apart, they are placed after the hot code.
+      if (targ_trace != trace(_cfg.get_root_block()) &&
+          !(BlockLayoutColdTracesLast && is_cold(targ_trace) && !is_cold(src_trace))) {
         e->set_state(CFGEdge::connected);
         src_trace->append(targ_trace);
         union_traces(src_trace, targ_trace);
@@ -1783,6 +1785,31 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  // Move the cold traces behind all others, but in front of the connector
+  // blocks, keeping the frequency order within both groups.
+  if (BlockLayoutColdTracesLast) {
+    Trace** ordered = NEW_RESOURCE_ARRAY(Trace*, new_count);
+    int n = 0;
+    ordered[n++] = new_traces[0];
+    for (int i = 1; i < new_count; i++) {
+      if (!new_traces[i]->first_block()->is_connector() && !is_cold(new_traces[i])) {
+        ordered[n++] = new_traces[i];
+      }
+    }
+    for (int i = 1; i < new_count; i++) {
+      if (is_cold(new_traces[i])) {
+        ordered[n++] = new_traces[i];
+      }
+    }
+    for (int i = 1; i < new_count; i++) {
+      if (new_traces[i]->first_block()->is_connector()) {
+        ordered[n++] = new_traces[i];
+      }
+    }
+    assert(n == new_count, "all traces placed");
+    new_traces = ordered;
+  }
+
   // Collect all blocks from existing Traces
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
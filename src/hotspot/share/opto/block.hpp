@@ -902,6 +902,12 @@ class PhaseBlockLayout : public Phase {
   Trace * trace(Block *b) {
     return traces[uf->Find_compress(b->_pre_order)];
   }
+
+  // Is the trace only expected to run rarely, see BlockLayoutColdTracesLast?
+  bool is_cold(Trace* tr) const {
+    Block* b = tr->first_block();
+    return !b->is_connector() && _cfg.is_uncommon(b);
+  }
  public:
   PhaseBlockLayout(PhaseCFG &cfg);
 
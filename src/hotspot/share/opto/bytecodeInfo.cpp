@@ -392,6 +392,12 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
   // suppress a few checks for accessors and trivial methods
   if (callee_method->code_size() > MaxTrivialSize) {
 
+    // retrying after running out of nodes
+    if (C->reduced_optimizations() && !callee_method->force_inline()) {
+      set_msg("reduced optimizations");
+      return false;
+    }
+
     // don't inline into giant methods
     if (C->over_inlining_cutoff()) {
       if ((!callee_method->force_inline() && !caller_method->is_compiled_lambda_form())
@@ -344,6 +344,19 @@
   product(bool, SuperWordReductions, true,                                  \
           "Enable reductions support in superword.")                        \
                                                                             \
+  product(uint, SuperWordReductionAccumulators, 1, EXPERIMENTAL,            \
+          "Number of independent vector accumulators an unordered "         \
+          "reduction is split into inside the loop. The accumulators "      \
+          "are combined pairwise after the loop.")                          \
+          range(1, 8)                                                       \
+                                                                            \
+  product(uint, SuperWordAlignMinTripCount, 0, EXPERIMENTAL,                \
+          "Do not spend pre-loop iterations on aligning the vectors of a "  \
+          "main loop whose profiled trip count is below this value, when "  \
+          "the platform does not require aligned vectors. 0 means always "  \
+          "align.")                                                         \
+          range(0, max_juint)                                               \
+                                                                            \
   product(bool, UseCMoveUnconditionally, false,                             \
           "Use CMove (scalar and vector) ignoring profitability test.")     \
                                                                             \
@@ -396,10 +409,23 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(uint, PolymorphicInliningLimit, 0, EXPERIMENTAL,                  \
+          "Inline up to this many profiled receivers behind type checks "   \
+          "at a polymorphic call site, with a virtual call for all other "  \
+          "receivers. Needs TypeProfileWidth of at least that much. "       \
+          "Values below 3 disable it")                                      \
+          range(0, 8)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
                                                                             \
+  product(bool, RetryCompilationOnNodeLimit, false, EXPERIMENTAL,           \
+          "When a compilation runs out of nodes, retry it once without "    \
+          "loop unrolling, SuperWord and escape analysis and inlining "     \
+          "only trivial methods, instead of making the method not "         \
+          "compilable by C2")                                               \
+                                                                            \
   develop(bool, StressRecompilation, false,                                 \
           "Recompile each compiled method without subsuming loads "         \
           "or escape analysis.")                                            \
@@ -430,6 +456,12 @@
           "Fudge Factor for certain optimizations")                         \
           constraint(NodeLimitFudgeFactorConstraintFunc, AfterErgo)         \
                                                                             \
+  product(uint, MaxLiveRangesForRegisterAllocation, 0, EXPERIMENTAL,        \
+          "Bail out of the compilation if register allocation would have "  \
+          "to handle more live ranges than this, leaving the method to the "\
+          "C1 linear scan allocator when tiered compilation is enabled. "   \
+          "0 means no limit")                                               \
+                                                                            \
   product(bool, UseJumpTables, true,                                        \
           "Use JumpTables instead of a binary search tree for switches")    \
                                                                             \
@@ -547,6 +579,11 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(bool, BlockLayoutColdTracesLast, false, EXPERIMENTAL,             \
+          "Place traces that start with an uncommon block after all other " \
+          "traces in the frequency based block layout, so that the hot "    \
+          "code of a method stays contiguous")                              \
+                                                                            \
   product(bool, InlineReflectionGetCallerClass, true, DIAGNOSTIC,           \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
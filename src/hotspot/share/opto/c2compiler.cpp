@@ -60,6 +60,9 @@ const char* C2Compiler::retry_no_reduce_allocation_merges() {
 const char* C2Compiler::retry_no_superword() {
   return "retry without SuperWord";
 }
+const char* C2Compiler::retry_reduced_optimizations() {
+  return "retry with reduced optimizations";
+}
 
 void compiler_stubs_init(bool in_compiler_thread);
 
@@ -127,6 +130,7 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, boo
   bool eliminate_boxing = EliminateAutoBox;
   bool do_locks_coarsening = EliminateLocks;
   bool do_superword = UseSuperWord;
+  bool reduced_optimizations = false;
 
   while (!env->failing()) {
     ResourceMark rm;
@@ -138,6 +142,7 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, boo
                     eliminate_boxing,
                     do_locks_coarsening,
                     do_superword,
+                    reduced_optimizations,
                     install_code);
     Compile C(env, target, entry_bci, options, directive);
 
@@ -179,6 +184,16 @@ void C2Compiler::compile_method(ciEnv* env, ciMethod* target, int entry_bci, boo
         env->report_failure(C.failure_reason());
         continue;  // retry
       }
+      if (C.failure_reason_is(retry_reduced_optimizations())) {
+        assert(!reduced_optimizations, "must make progress");
+        reduced_optimizations = true;
+        do_escape_analysis = false;
+        do_iterative_escape_analysis = false;
+        do_reduce_allocation_merges = false;
+        do_superword = false;
+        env->report_failure(C.failure_reason());
+        continue;  // retry
+      }
       if (C.has_boxed_value()) {
         // Recompile without boxing elimination regardless failure reason.
         assert(eliminate_boxing, "must make progress");
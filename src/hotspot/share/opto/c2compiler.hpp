@@ -53,6 +53,7 @@ class C2Compiler : public AbstractCompiler {
   static const char* retry_no_reduce_allocation_merges();
   static const char* retry_no_locks_coarsening();
   static const char* retry_no_superword();
+  static const char* retry_reduced_optimizations();
 
   // Print compilation timers and statistics
   void print_timers();
@@ -391,6 +391,15 @@ void PhaseChaitin::Register_Allocate() {
   // them for real.
   de_ssa();
 
+  // Building the IFG and coloring grow much faster than linear in the number
+  // of live ranges. For huge methods, do not hold up the compiler thread for
+  // seconds; C1 compiles them at a fraction of the cost.
+  if (MaxLiveRangesForRegisterAllocation != 0 &&
+      _lrg_map.max_lrg_id() > MaxLiveRangesForRegisterAllocation) {
+    C->record_method_not_compilable("too many live ranges for register allocation");
+    return;
+  }
+
 #ifdef ASSERT
   // Verify the graph before RA.
   verify(&live_arena);
@@ -1055,8 +1055,10 @@ void Compile::Init(bool aliasing) {
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   _loop_opts_cnt = LoopOptsCount;
   set_do_inlining(Inline);
-  set_max_inline_size(MaxInlineSize);
-  set_freq_inline_size(FreqInlineSize);
+  // Directive values are not range checked like the flags they override.
+  set_max_inline_size((int)clamp(_directive->MaxInlineSizeOption, (intx)0, (intx)max_jint));
+  set_freq_inline_size((int)clamp(_directive->FreqInlineSizeOption, (intx)0, (intx)max_jint));
+  set_loop_unroll_limit((int)clamp(_directive->LoopUnrollLimitOption, (intx)0, (intx)(max_jint / 4)));
   set_do_scheduling(OptoScheduling);
 
   set_do_vector_loop(false);
@@ -5359,3 +5361,16 @@ Node* Compile::narrow_value(BasicType bt, Node* value, const Type* type, PhaseGV
 void Compile::record_method_not_compilable_oom() {
   record_method_not_compilable(CompilationMemoryStatistic::failure_reason_memlimit());
 }
+
+void Compile::record_node_limit_failure(const char* reason) {
+  if (RetryCompilationOnNodeLimit && !reduced_optimizations() && method() != nullptr) {
+    // Give the method another chance with the node-hungry optimizations
+    // turned off before giving up on it at this tier.
+    if (log() != nullptr) {
+      log()->elem("node_limit_retry reason='%s'", reason);
+    }
+    record_failure(C2Compiler::retry_reduced_optimizations());
+  } else {
+    record_method_not_compilable(reason);
+  }
+}
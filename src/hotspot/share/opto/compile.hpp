@@ -183,6 +183,7 @@ class Options {
   const bool _eliminate_boxing;      // Do boxing elimination.
   const bool _do_locks_coarsening;   // Do locks coarsening
   const bool _do_superword;          // Do SuperWord
+  const bool _reduced_optimizations; // Skip node-hungry optimizations
   const bool _install_code;          // Install the code that was compiled
  public:
   Options(bool subsume_loads,
@@ -192,6 +193,7 @@ class Options {
           bool eliminate_boxing,
           bool do_locks_coarsening,
           bool do_superword,
+          bool reduced_optimizations,
           bool install_code) :
           _subsume_loads(subsume_loads),
           _do_escape_analysis(do_escape_analysis),
@@ -200,6 +202,7 @@ class Options {
           _eliminate_boxing(eliminate_boxing),
           _do_locks_coarsening(do_locks_coarsening),
           _do_superword(do_superword),
+          _reduced_optimizations(reduced_optimizations),
           _install_code(install_code) {
   }
 
@@ -212,6 +215,7 @@ class Options {
        /* eliminate_boxing = */ false,
        /* do_lock_coarsening = */ false,
        /* do_superword = */ true,
+       /* reduced_optimizations = */ false,
        /* install_code = */ true
     );
   }
@@ -313,6 +317,7 @@ class Compile : public Phase {
   // Control of this compilation.
   int                   _max_inline_size;       // Max inline size for this compilation
   int                   _freq_inline_size;      // Max hot method inline size for this compilation
+  int                   _loop_unroll_limit;     // Max unrolled loop body size for this compilation
   int                   _fixed_slots;           // count of frame slots not allocated by the register
                                                 // allocator i.e. locks, original deopt pc, etc.
   uintx                 _max_node_limit;        // Max unique node count during a single compilation.
@@ -511,6 +516,7 @@ class Compile : public Phase {
   DEBUG_ONLY(bool _exception_backedge;)
 
   void record_method_not_compilable_oom();
+  void record_node_limit_failure(const char* reason);
 
  public:
 
@@ -595,6 +601,8 @@ class Compile : public Phase {
   /** Do locks coarsening. */
   bool              do_locks_coarsening() const { return _options._do_locks_coarsening; }
   bool              do_superword() const        { return _options._do_superword; }
+  /** Retrying after running out of nodes: no loop unrolling, only trivial inlining. */
+  bool              reduced_optimizations() const { return _options._reduced_optimizations; }
 
   // Other fixed compilation parameters.
   ciMethod*         method() const              { return _method; }
@@ -626,6 +634,8 @@ class Compile : public Phase {
   void          set_freq_inline_size(int n)     { _freq_inline_size = n; }
   int               freq_inline_size() const    { return _freq_inline_size; }
   void          set_max_inline_size(int n)      { _max_inline_size = n; }
+  int               loop_unroll_limit() const   { return _loop_unroll_limit; }
+  void          set_loop_unroll_limit(int n)    { _loop_unroll_limit = n; }
   bool              has_loops() const           { return _has_loops; }
   void          set_has_loops(bool z)           { _has_loops = z; }
   bool              has_split_ifs() const       { return _has_split_ifs; }
@@ -843,7 +853,7 @@ class Compile : public Phase {
       return true;
     }
     if (live_nodes() + margin > max_node_limit()) {
-      record_method_not_compilable(reason);
+      record_node_limit_failure(reason);
       return true;
     } else {
       return false;
@@ -253,6 +253,44 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
         receiver_method = callee->resolve_invoke(jvms->method()->holder(),
                                                       profile.receiver(0));
       }
+      if (receiver_method == nullptr && speculative_receiver_type == nullptr &&
+          morphism == 0 && PolymorphicInliningLimit > 2 && profile.has_receiver(2)) {
+        // Polymorphic call site without a major receiver: test for the most
+        // frequent receivers in turn and inline their targets, any other
+        // receiver takes the virtual call.
+        int n = 0;
+        int tested = 0;
+        while (n < (int)PolymorphicInliningLimit && profile.has_receiver(n)) {
+          tested = saturated_add(tested, profile.receiver_count(n));
+          n++;
+        }
+        CallGenerator* miss_cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                                           : CallGenerator::for_virtual_call(callee, vtable_index));
+        int inlined = 0;
+        for (int i = n - 1; i >= 0 && miss_cg != nullptr; i--) {
+          // Calls that reach this test missed all the tests before it.
+          tested -= profile.receiver_count(i);
+          ciMethod* next_receiver_method = callee->resolve_invoke(jvms->method()->holder(),
+                                                                  profile.receiver(i));
+          if (next_receiver_method == nullptr) {
+            continue;
+          }
+          CallGenerator* next_hit_cg = this->call_generator(next_receiver_method,
+                                              vtable_index, !call_does_dispatch, jvms,
+                                              allow_inline, prof_factor);
+          if (next_hit_cg == nullptr || !next_hit_cg->is_inline()) {
+            continue;
+          }
+          int reaching = MAX2(profile.count() - tested, profile.receiver_count(i));
+          float hit_prob = MIN2((float)profile.receiver_count(i) / (float)reaching, PROB_MAX);
+          trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), next_receiver_method, profile.receiver(i), site_count, profile.receiver_count(i));
+          miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, next_hit_cg, hit_prob);
+          inlined++;
+        }
+        if (miss_cg != nullptr && inlined > 0) {
+          return miss_cg;
+        }
+      }
       if (receiver_method != nullptr) {
         // The single majority receiver sufficiently outweighs the minority.
         CallGenerator* hit_cg = this->call_generator(receiver_method,
@@ -109,6 +109,14 @@
 // is marked GlobalEscape.  Finally, for any node marked ArgEscape, anything
 // it could point to is marked ArgEscape.
 //
+// Since the analysis is flow-insensitive, an object that escapes on any path
+// is not scalar replaced on any other path either.  There is no partial escape
+// analysis that materializes the object at the escape point.  Paths that the
+// profile shows were never taken are already replaced by uncommon traps during
+// parsing, so an object escaping only there is still scalar replaced and
+// rematerialized by deoptimization if the trap is hit.  Objects merged by a Phi
+// are handled by ReduceAllocationMerges.
+//
 
 class  Compile;
 class  Node;
@@ -130,8 +138,8 @@ class ConnectionGraph;
 
 // ConnectionGraph nodes
 class PointsToNode : public ArenaObj {
-  GrowableArray<PointsToNode*> _edges; // List of nodes this node points to
-  GrowableArray<PointsToNode*> _uses;  // List of nodes which point to this node
+  GrowableArrayInline<PointsToNode*, 2> _edges; // List of nodes this node points to
+  GrowableArrayInline<PointsToNode*, 2> _uses;  // List of nodes which point to this node
 
   const u1           _type;  // NodeType
   u1                _flags;  // NodeFlags
@@ -256,7 +264,7 @@ class JavaObjectNode: public PointsToNode {
 };
 
 class FieldNode: public PointsToNode {
-  GrowableArray<PointsToNode*> _bases; // List of JavaObject nodes which point to this node
+  GrowableArrayInline<PointsToNode*, 2> _bases; // List of JavaObject nodes which point to this node
   const int   _offset; // Field's offset.
   const bool  _is_oop; // Field points to object
         bool  _has_unknown_base; // Has phantom_object base
@@ -688,8 +696,8 @@ class ConnectionGraph: public ArenaObj {
 };
 
 inline PointsToNode::PointsToNode(ConnectionGraph *CG, Node* n, EscapeState es, NodeType type):
-  _edges(CG->_compile->comp_arena(), 2, 0, nullptr),
-  _uses (CG->_compile->comp_arena(), 2, 0, nullptr),
+  _edges(CG->_compile->comp_arena()),
+  _uses (CG->_compile->comp_arena()),
   _type((u1)type),
   _flags(ScalarReplaceable),
   _escape((u1)es),
@@ -702,7 +710,7 @@ inline PointsToNode::PointsToNode(ConnectionGraph *CG, Node* n, EscapeState es,
 
 inline FieldNode::FieldNode(ConnectionGraph *CG, Node* n, EscapeState es, int offs, bool is_oop):
   PointsToNode(CG, n, es, Field),
-  _bases(CG->_compile->comp_arena(), 2, 0, nullptr),
+  _bases(CG->_compile->comp_arena()),
   _offset(offs), _is_oop(is_oop),
   _has_unknown_base(false) {
 }
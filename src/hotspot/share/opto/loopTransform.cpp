@@ -849,6 +849,9 @@ bool IdealLoopTree::policy_maximally_unroll(PhaseIdealLoop* phase) const {
   if (!cl->is_valid_counted_loop(T_INT)) {
     return false;   // Malformed counted loop.
   }
+  if (phase->C->reduced_optimizations()) {
+    return false;   // Retrying after running out of nodes.
+  }
   if (!cl->has_exact_trip_count()) {
     return false;   // Trip count is not exact.
   }
@@ -862,8 +865,7 @@ bool IdealLoopTree::policy_maximally_unroll(PhaseIdealLoop* phase) const {
   assert(!phase->exceeding_node_budget(), "sanity");
 
   // Allow the unrolled body to get larger than the standard loop size limit.
-  uint unroll_limit = (uint)LoopUnrollLimit * 4;
-  assert((intx)unroll_limit == LoopUnrollLimit * 4, "LoopUnrollLimit must fit in 32bits");
+  uint unroll_limit = (uint)phase->C->loop_unroll_limit() * 4;
   if (trip_count > unroll_limit || _body.size() > unroll_limit) {
     return false;
   }
@@ -920,6 +922,12 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   if (!cl->is_valid_counted_loop(T_INT)) {
     return false; // Malformed counted loop
   }
+  if (phase->C->reduced_optimizations()) {
+    return false; // Retrying after running out of nodes
+  }
+  if (phase->C->loop_unroll_limit() == 0) {
+    return false; // Unrolling disabled, SLP analysis must not raise the limit
+  }
 
   // If nodes are depleted, some transform has miscalculated its needs.
   assert(!phase->exceeding_node_budget(), "sanity");
@@ -929,7 +937,7 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
   if (cl->trip_count() <= (cl->is_normal_loop() ? 2u : 1u)) {
     return false;
   }
-  _local_loop_unroll_limit  = LoopUnrollLimit;
+  _local_loop_unroll_limit  = phase->C->loop_unroll_limit();
   _local_loop_unroll_factor = 4;
   int future_unroll_cnt = cl->unrolled_count() * 2;
   if (!cl->is_vectorized_loop()) {
@@ -1095,7 +1103,7 @@ bool IdealLoopTree::policy_unroll(PhaseIdealLoop *phase) {
 
   // Check for being too big
   if (body_size > (uint)_local_loop_unroll_limit) {
-    if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < 4u * LoopUnrollLimit) {
+    if ((cl->is_subword_loop() || xors_in_loop >= 4) && body_size < 4u * phase->C->loop_unroll_limit()) {
       return should_unroll && phase->may_require_nodes(estimate);
     }
     return false; // Loop too big.
@@ -1132,7 +1140,7 @@ void IdealLoopTree::policy_unroll_slp_analysis(CountedLoopNode *cl, PhaseIdealLo
       int slp_max_unroll_factor = cl->slp_max_unroll();
       if (slp_max_unroll_factor >= future_unroll_cnt) {
         int new_limit = cl->node_count_before_unroll() * slp_max_unroll_factor;
-        if (new_limit > LoopUnrollLimit) {
+        if (new_limit > phase->C->loop_unroll_limit()) {
           if (TraceSuperWordLoopUnrollAnalysis) {
             tty->print_cr("slp analysis unroll=%d, default limit=%d\n", new_limit, _local_loop_unroll_limit);
           }
@@ -2077,7 +2085,7 @@ void PhaseIdealLoop::initialize_assertion_predicates_for_peeled_loop(const Predi
 //------------------------------do_unroll--------------------------------------
 // Unroll the loop body one step - make each trip do 2 iterations.
 void PhaseIdealLoop::do_unroll(IdealLoopTree *loop, Node_List &old_new, bool adjust_min_trip) {
-  assert(LoopUnrollLimit, "");
+  assert(C->loop_unroll_limit() > 0, "");
   CountedLoopNode *loop_head = loop->_head->as_CountedLoop();
   CountedLoopEndNode *loop_end = loop_head->loopexit();
 
@@ -2088,7 +2096,7 @@ void PhaseIdealLoop::do_unroll(IdealLoopTree *loop, Node_List &old_new, bool adj
     tty->print("Unrolling ");
     loop->dump_head();
   } else if (TraceLoopOpts) {
-    if (loop_head->trip_count() < (uint)LoopUnrollLimit) {
+    if (loop_head->trip_count() < (uint)C->loop_unroll_limit()) {
       tty->print("Unroll %d(%2d) ", loop_head->unrolled_count()*2, loop_head->trip_count());
     } else {
       tty->print("Unroll %d     ", loop_head->unrolled_count()*2);
@@ -802,6 +802,13 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // Avoid duplicated float compare.
   if (phis > 1 && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) return nullptr;
 
+  // A diamond in the body of an innermost counted loop that SuperWord works on
+  // can be turned into a vector blend. Branch prediction does not matter then.
+  bool vectorizable = used_inside_loop && UseVectorCmov && C->do_superword() &&
+                      r_loop != _ltree_root && r_loop->_child == nullptr &&
+                      r_loop->_head->is_CountedLoop() &&
+                      (cmp_op == Op_CmpI || cmp_op == Op_CmpL || cmp_op == Op_CmpF || cmp_op == Op_CmpD);
+
   float infrequent_prob = PROB_UNLIKELY_MAG(3);
   // Ignore cost and blocks frequency if CMOVE can be moved outside the loop.
   if (used_inside_loop) {
@@ -818,6 +825,8 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   // we are going to predict accurately all the time.
   if (C->use_cmove() && (cmp_op == Op_CmpF || cmp_op == Op_CmpD)) {
     //keep going
+  } else if (vectorizable) {
+    //keep going
   } else if (iff->_prob < infrequent_prob ||
       iff->_prob > (1.0f - infrequent_prob))
     return nullptr;
@@ -4511,15 +4520,20 @@ static bool is_unordered_reduction(Node* n) {
 void PhaseIdealLoop::move_unordered_reduction_out_of_loop(IdealLoopTree* loop) {
   assert(!C->major_progress() && loop->is_counted() && loop->is_innermost(), "sanity");
 
-  // Find all Phi nodes with an unordered Reduction on backedge.
+  // Find all Phi nodes with an unordered Reduction on backedge. Collect them
+  // first, as splitting the accumulation adds Phi nodes to cl.
   CountedLoopNode* cl = loop->_head->as_CountedLoop();
+  Node_List candidates;
   for (DUIterator_Fast jmax, j = cl->fast_outs(jmax); j < jmax; j++) {
     Node* phi = cl->fast_out(j);
     // We have a phi with a single use, and an unordered Reduction on the backedge.
-    if (!phi->is_Phi() || phi->outcnt() != 1 || !is_unordered_reduction(phi->in(2))) {
-      continue;
+    if (phi->is_Phi() && phi->outcnt() == 1 && is_unordered_reduction(phi->in(2))) {
+      candidates.push(phi);
     }
+  }
 
+  for (uint j = 0; j < candidates.size(); j++) {
+    Node* phi = candidates.at(j);
     ReductionNode* last_ur = phi->in(2)->as_Reduction();
     assert(!last_ur->requires_strict_order(), "must be");
 
@@ -4544,8 +4558,10 @@ void PhaseIdealLoop::move_unordered_reduction_out_of_loop(IdealLoopTree* loop) {
     // are outside the loop.
     ReductionNode* current = last_ur;
     ReductionNode* first_ur = nullptr;
+    Node_List chain; // From last_ur up to first_ur.
     while (true) {
       assert(!current->requires_strict_order(), "sanity");
+      chain.push(current);
 
       // Expect no ctrl and a vector_input from within the loop.
       Node* ctrl = current->in(0);
@@ -4619,40 +4635,96 @@ void PhaseIdealLoop::move_unordered_reduction_out_of_loop(IdealLoopTree* loop) {
     phi->as_Type()->set_type(vec_t);
     _igvn.set_type(phi, vec_t);
 
-    // Traverse down the chain of unordered Reductions, and replace them with vector_accumulators.
-    current = first_ur;
-    while (true) {
-      // Create vector_accumulator to replace current.
-      Node* last_vector_accumulator = current->in(1);
-      Node* vector_input            = current->in(2);
-      VectorNode* vector_accumulator = VectorNode::make(vopc, last_vector_accumulator, vector_input, vec_t);
+    // With a single vector phi, every vector_accumulator has to wait for the
+    // previous one. Split the chain into several independent accumulations,
+    // each with its own vector phi: the Reduction at position i of the chain
+    // accumulates into accumulator (i % num_accumulators).
+    const uint chain_length = chain.size();
+    const uint num_accumulators = MIN2((uint)SuperWordReductionAccumulators, chain_length);
+    Node_List phis;
+    Node_List accumulators;
+    phis.push(phi);
+    accumulators.push(phi);
+    for (uint k = 1; k < num_accumulators; k++) {
+      PhiNode* accumulator_phi = PhiNode::make(cl, identity_vector, vec_t);
+      register_new_node(accumulator_phi, cl);
+      phis.push(accumulator_phi);
+      accumulators.push(accumulator_phi);
+    }
+
+    // Traverse down the chain of unordered Reductions, and create the vector_accumulators.
+    // All of them are created before any Reduction is replaced: replacing a Reduction
+    // kills it, and with it the only use an accumulator of another accumulation may
+    // have so far.
+    Node_List vector_accumulators;
+    for (uint i = 0; i < chain_length; i++) {
+      current = chain.at(chain_length - 1 - i)->as_Reduction();
+      assert(!current->requires_strict_order(), "must be");
+      const uint k = i % num_accumulators;
+      Node* vector_input = current->in(2);
+      VectorNode* vector_accumulator = VectorNode::make(vopc, accumulators.at(k), vector_input, vec_t);
       register_new_node(vector_accumulator, cl);
-      _igvn.replace_node(current, vector_accumulator);
       VectorNode::trace_new_vector(vector_accumulator, "Unordered Reduction");
-      if (current == last_ur) {
-        break;
+      vector_accumulators.push(vector_accumulator);
+      accumulators.map(k, vector_accumulator);
+    }
+    assert(current == last_ur, "must have visited the whole chain");
+
+    // Replace the Reductions, first to last.
+    for (uint i = 0; i < chain_length; i++) {
+      _igvn.replace_node(chain.at(chain_length - 1 - i), vector_accumulators.at(i));
+    }
+    Node* last_vector_accumulator = vector_accumulators.at(chain_length - 1);
+
+    // Close each accumulation over its phi. Replacing last_ur made
+    // last_vector_accumulator the backedge input of phi, but it might belong
+    // to another accumulation. Update phi last, so that last_vector_accumulator
+    // does not lose its last use on the way.
+    for (uint k = num_accumulators; k-- > 0; ) {
+      Node* accumulator_phi = phis.at(k);
+      _igvn.rehash_node_delayed(accumulator_phi);
+      accumulator_phi->set_req_X(2, accumulators.at(k), &_igvn);
+    }
+
+    // Combine the accumulations pairwise after the loop.
+    Node_List combine_nodes;
+    uint width = num_accumulators;
+    while (width > 1) {
+      uint k = 0;
+      for ( ; 2 * k + 1 < width; k++) {
+        Node* combined = VectorNode::make(vopc, accumulators.at(2 * k), accumulators.at(2 * k + 1), vec_t);
+        combine_nodes.push(combined);
+        accumulators.map(k, combined);
       }
-      current = vector_accumulator->unique_out()->as_Reduction();
-      assert(!current->requires_strict_order(), "must be");
+      if (width % 2 == 1) {
+        accumulators.map(k++, accumulators.at(width - 1));
+      }
+      width = k;
     }
 
     // Create post-loop reduction.
-    Node* last_accumulator = phi->in(2);
+    Node* last_accumulator = accumulators.at(0);
     Node* post_loop_reduction = ReductionNode::make(sopc, nullptr, init, last_accumulator, bt);
 
-    // Take over uses of last_accumulator that are not in the loop.
-    for (DUIterator i = last_accumulator->outs(); last_accumulator->has_out(i); i++) {
-      Node* use = last_accumulator->out(i);
-      if (use != phi && use != post_loop_reduction) {
+    // Take over uses of last_vector_accumulator that are not in the loop.
+    for (DUIterator i = last_vector_accumulator->outs(); last_vector_accumulator->has_out(i); i++) {
+      Node* use = last_vector_accumulator->out(i);
+      if (use != post_loop_reduction && !phis.contains(use) && !combine_nodes.contains(use)) {
         assert(ctrl_or_self(use) != cl, "use must be outside loop");
-        use->replace_edge(last_accumulator, post_loop_reduction,  &_igvn);
+        use->replace_edge(last_vector_accumulator, post_loop_reduction,  &_igvn);
         --i;
       }
     }
-    register_new_node(post_loop_reduction, get_late_ctrl(post_loop_reduction, cl));
+    Node* post_loop_ctrl = get_late_ctrl(post_loop_reduction, cl);
+    for (uint k = 0; k < combine_nodes.size(); k++) {
+      register_new_node(combine_nodes.at(k), post_loop_ctrl);
+      VectorNode::trace_new_vector(combine_nodes.at(k), "Unordered Reduction");
+    }
+    register_new_node(post_loop_reduction, post_loop_ctrl);
     VectorNode::trace_new_vector(post_loop_reduction, "Unordered Reduction");
 
-    assert(last_accumulator->outcnt() == 2, "last_accumulator has 2 uses: phi and post_loop_reduction");
+    assert(num_accumulators > 1 || last_accumulator->outcnt() == 2,
+           "last_accumulator has 2 uses: phi and post_loop_reduction");
     assert(post_loop_reduction->outcnt() > 0, "should have taken over all non loop uses of last_accumulator");
     assert(phi->outcnt() == 1, "accumulator is the only use of phi");
   }
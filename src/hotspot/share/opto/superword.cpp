@@ -1590,7 +1590,15 @@ bool SuperWord::implemented(const Node_List* pack, const uint size) const {
       return false;
     } else if (p0->is_Cmp()) {
       // Cmp -> Bool -> Cmove
-      retValue = UseVectorCmov;
+      // VectorMaskCmp only does signed integral and java floating point compares.
+      retValue = UseVectorCmov &&
+                 (opc == Op_CmpI || opc == Op_CmpL || opc == Op_CmpF || opc == Op_CmpD);
+    } else if (p0->is_CMove()) {
+      // The mask produced by the compare must have the lane size of the blend.
+      Node* cmp = p0->in(CMoveNode::Condition)->in(1);
+      retValue = cmp->is_Cmp() &&
+                 type2aelembytes(velt_basic_type(cmp)) == type2aelembytes(velt_basic_type(p0)) &&
+                 VectorNode::implemented(opc, size, velt_basic_type(p0));
     } else if (VectorNode::is_scalar_op_that_returns_int_but_vector_op_returns_long(opc)) {
       // Requires extra vector long -> int conversion.
       retValue = VectorNode::implemented(opc, size, T_LONG) &&
@@ -2138,7 +2146,9 @@ bool SuperWord::apply(Node_List& memops_schedule) {
   apply_memops_reordering_with_schedule(memops_schedule);
   C->print_method(PHASE_AUTO_VECTORIZATION2_AFTER_REORDER, 4, cl);
 
-  adjust_pre_loop_limit_to_align_main_loop_vectors();
+  if (should_align_main_loop_vectors()) {
+    adjust_pre_loop_limit_to_align_main_loop_vectors();
+  }
   C->print_method(PHASE_AUTO_VECTORIZATION3_AFTER_ADJUST_LIMIT, 4, cl);
 
   bool is_success = apply_vectorization();
@@ -3236,6 +3246,25 @@ void SuperWord::determine_mem_ref_and_aw_for_main_loop_alignment() {
   )                                     \
 }                                       \
 
+// Aligning the main loop vectors can take up to aw / element size pre-loop iterations,
+// which are executed in scalar. For loops that are known to run only a few iterations,
+// that can be most of the work. Skip the alignment there, unless it is required.
+bool SuperWord::should_align_main_loop_vectors() const {
+  if (VLoop::vectors_should_be_aligned() || SuperWordAlignMinTripCount == 0) {
+    return true;
+  }
+  const float trip_cnt = cl()->profile_trip_cnt();
+  if (trip_cnt == COUNT_UNKNOWN || trip_cnt >= (float)SuperWordAlignMinTripCount) {
+    return true;
+  }
+#ifndef PRODUCT
+  if (is_trace_align_vector()) {
+    tty->print_cr("\nshould_align_main_loop_vectors: skip, profiled trip count %.1f", trip_cnt);
+  }
+#endif
+  return false;
+}
+
 // Ensure that the main loop vectors are aligned by adjusting the pre loop limit. We memory-align
 // the address of "_mem_ref_for_main_loop_alignment" to "_aw_for_main_loop_alignment", which is a
 // sufficiently large alignment width. We adjust the pre-loop iteration count by adjusting the
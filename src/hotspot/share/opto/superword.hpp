@@ -633,6 +633,7 @@ class SuperWord : public ResourceObj {
   static LoadNode::ControlDependency control_dependency(Node_List* p);
 
   // Ensure that the main loop vectors are aligned by adjusting the pre loop limit.
+  bool should_align_main_loop_vectors() const;
   void determine_mem_ref_and_aw_for_main_loop_alignment();
   void adjust_pre_loop_limit_to_align_main_loop_vectors();
 };
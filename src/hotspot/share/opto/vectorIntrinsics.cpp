@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "ci/ciSymbols.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "logging/log.hpp"
 #include "opto/library_call.hpp"
 #include "opto/runtime.hpp"
 #include "opto/vectornode.hpp"
@@ -59,9 +60,13 @@ static bool check_vbox(const TypeInstPtr* vbox_type) {
 }
 #endif
 
-#define log_if_needed(...)        \
-  if (C->print_intrinsics()) {    \
-    tty->print_cr(__VA_ARGS__);   \
+// Reasons for not intrinsifying are also available in product builds
+// with -Xlog:jit+intrinsics=debug, without the diagnostic PrintIntrinsics.
+#define log_if_needed(...)                    \
+  if (C->print_intrinsics()) {                \
+    tty->print_cr(__VA_ARGS__);               \
+  } else {                                    \
+    log_debug(jit, intrinsics)(__VA_ARGS__);  \
   }
 
 #ifndef PRODUCT
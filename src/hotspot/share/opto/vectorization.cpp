@@ -572,7 +572,7 @@ bool VPointer::scaled_iv_plus_offset(Node* n) {
   }
 
   int opc = n->Opcode();
-  if (opc == Op_AddI) {
+  if (opc == Op_AddI || opc == Op_AddL) {
     if (offset_plus_k(n->in(2)) && scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_4(n);)
       return true;
@@ -638,7 +638,9 @@ bool VPointer::scaled_iv(Node* n) {
       NOT_PRODUCT(_tracer.scaled_iv_7(n);)
       return true;
     }
-  } else if (opc == Op_LShiftL && n->in(2)->is_Con()) {
+  } else if ((opc == Op_LShiftL || opc == Op_MulL) && n->in(2)->is_Con()) {
+    // Long indexed accesses, e.g. into MemorySegments, scale the long index:
+    // (ConvI2L(iv) + invar) << k or (ConvI2L(iv) + invar) * k.
     if (!has_iv()) {
       // Need to preserve the current _offset value, so
       // create a temporary object for this expression subtree.
@@ -647,7 +649,7 @@ bool VPointer::scaled_iv(Node* n) {
       VPointer tmp(this);
       NOT_PRODUCT(_tracer.scaled_iv_8(n, &tmp);)
 
-      if (tmp.scaled_iv_plus_offset(n->in(1))) {
+      if (opc == Op_LShiftL && tmp.scaled_iv_plus_offset(n->in(1))) {
         int scale = n->in(2)->get_int();
         _scale   = tmp._scale  << scale;
         _offset += tmp._offset << scale;
@@ -657,6 +659,31 @@ bool VPointer::scaled_iv(Node* n) {
           maybe_add_to_invar(register_if_new(LShiftNode::make(tmp._invar, n->in(2), bt)), false);
 #ifdef ASSERT
           _debug_invar_scale = n->in(2);
+#endif
+        }
+        NOT_PRODUCT(_tracer.scaled_iv_9(n, _scale, _offset, _invar);)
+        return true;
+      }
+      // The constructor rejects too large scales, but the scaled offset must fit into an int.
+      const jlong factor = (opc == Op_MulL) ? n->in(2)->get_long() : 0;
+      if (factor != 0 && factor > min_jint && factor <= max_jint &&
+          tmp.scaled_iv_plus_offset(n->in(1))) {
+        const jlong scale  = (jlong)tmp._scale  * factor;
+        const jlong offset = (jlong)_offset + (jlong)tmp._offset * factor;
+        if (scale <= min_jint || scale > max_jint || offset < min_jint || offset > max_jint) {
+          NOT_PRODUCT(_tracer.scaled_iv_10(n);)
+          return false;
+        }
+        _scale  = (int)scale;
+        _offset = (int)offset;
+        if (tmp._invar != nullptr) {
+          Node* invar = tmp._invar;
+          if (invar->bottom_type()->basic_type() == T_INT) {
+            invar = register_if_new(new ConvI2LNode(invar));
+          }
+          maybe_add_to_invar(register_if_new(new MulLNode(invar, n->in(2))), false);
+#ifdef ASSERT
+          _debug_invar_scale = n->in(2);
 #endif
         }
         NOT_PRODUCT(_tracer.scaled_iv_9(n, _scale, _offset, _invar);)
@@ -1036,13 +1063,13 @@ void VPointer::Tracer::scaled_iv_7(Node* n) {
 
 void VPointer::Tracer::scaled_iv_8(Node* n, VPointer* tmp) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print(" %d VPointer::scaled_iv: Op_LShiftL, creating tmp VPointer: ", n->_idx); tmp->print();
+    print_depth(); tty->print(" %d VPointer::scaled_iv: Op_%s, creating tmp VPointer: ", n->_idx, n->Name()); tmp->print();
   }
 }
 
 void VPointer::Tracer::scaled_iv_9(Node* n, int scale, int offset, Node* invar) {
   if (_is_trace_alignment) {
-    print_depth(); tty->print_cr(" %d VPointer::scaled_iv: Op_LShiftL PASSED, setting _scale = %d, _offset = %d", n->_idx, scale, offset);
+    print_depth(); tty->print_cr(" %d VPointer::scaled_iv: Op_%s PASSED, setting _scale = %d, _offset = %d", n->_idx, n->Name(), scale, offset);
     print_depth(); tty->print_cr("  \\ VPointer::scaled_iv: in(1) [%d] is scaled_iv_plus_offset, in(2) [%d] used to scale: _scale = %d, _offset = %d",
     n->in(1)->_idx, n->in(2)->_idx, scale, offset);
     if (invar != nullptr) {
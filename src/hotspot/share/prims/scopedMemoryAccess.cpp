@@ -24,10 +24,13 @@
 
 #include "precompiled.hpp"
 #include "classfile/vmSymbols.hpp"
+#include "code/dependencies.hpp"
+#include "code/nmethod.hpp"
 #include "jni.h"
 #include "jvm.h"
 #include "oops/access.inline.hpp"
 #include "oops/oop.inline.hpp"
+#include "prims/jvmtiExport.hpp"
 #include "prims/stackwalk.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
@@ -64,6 +67,22 @@ static bool is_in_scoped_access(JavaThread* jt, oop session) {
   return false;
 }
 
+// Only compiled code that inlined a @Scoped method can have hoisted a session
+// liveness check out of the scoped access. Which methods were inlined is only
+// known if all evol_method dependencies are recorded, and C2 registers one for
+// every method it parses. C1 does not for all method handle inlining.
+static bool may_have_inlined_scoped_access(nmethod* nm) {
+  if (!JvmtiExport::all_dependencies_are_recorded() || !nm->is_compiled_by_c2()) {
+    return true;
+  }
+  for (Dependencies::DepStream deps(nm); deps.next(); ) {
+    if (deps.type() == Dependencies::evol_method && deps.method_argument(0)->is_scoped()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 class ScopedAsyncExceptionHandshake : public AsyncExceptionHandshake {
   OopHandle _session;
 
@@ -115,10 +134,12 @@ class CloseScopedMemoryClosure : public HandshakeClosure {
     }
 
     ResourceMark rm;
-    if (last_frame.is_compiled_frame() && last_frame.can_be_deoptimized()) {
+    if (last_frame.is_compiled_frame() && last_frame.can_be_deoptimized() &&
+        may_have_inlined_scoped_access(last_frame.cb()->as_nmethod())) {
       // FIXME: we would like to conditionally deoptimize only if the corresponding
       // _session is reachable from the frame, but reachabilityFence doesn't currently
-      // work the way it should. Therefore we deopt unconditionally for now.
+      // work the way it should. Therefore we deopt every frame that may contain a
+      // scoped access for now.
       Deoptimization::deoptimize(jt, last_frame);
     }
 
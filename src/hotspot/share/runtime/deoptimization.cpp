@@ -1037,15 +1037,26 @@ class DeoptimizeMarkedClosure : public HandshakeClosure {
 void Deoptimization::deoptimize_all_marked() {
   ResourceMark rm;
 
+  const jlong start = os::javaTimeNanos();
+
   // Make the dependent methods not entrant
-  CodeCache::make_marked_nmethods_deoptimized();
+  const int count = CodeCache::make_marked_nmethods_deoptimized();
+
+  const jlong patched = os::javaTimeNanos();
 
   DeoptimizeMarkedClosure deopt;
-  if (SafepointSynchronize::is_at_safepoint()) {
+  const bool at_safepoint = SafepointSynchronize::is_at_safepoint();
+  if (at_safepoint) {
     Threads::java_threads_do(&deopt);
   } else {
     Handshake::execute(&deopt);
   }
+
+  log_debug(deoptimization)("Deoptimized %d nmethods%s, "
+                            "make not entrant: " JLONG_FORMAT " ns, "
+                            "mark frames: " JLONG_FORMAT " ns",
+                            count, at_safepoint ? " at safepoint" : "",
+                            patched - start, os::javaTimeNanos() - patched);
 }
 
 Deoptimization::DeoptAction Deoptimization::_unloaded_action
@@ -573,6 +573,12 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(uint, NMTMallocSiteSampleInterval, 1, EXPERIMENTAL,               \
+          "With NativeMemoryTracking=detail, record the call stack of "     \
+          "only one in this many malloc calls and scale the per-site "      \
+          "numbers accordingly. Summary numbers stay exact")                \
+          range(1, max_juint)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -746,6 +752,11 @@ const int ObjectAlignmentInBytes = 8;
           "GuaranteedAsyncDeflationInterval, whichever is lower.")          \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, MonitorSpinAIMD, false, EXPERIMENTAL,                       \
+          "On a failed spin, reduce the spin duration of an inflated "      \
+          "monitor multiplicatively instead of by a fixed penalty, so that "\
+          "monitors where spinning does not pay stop spinning sooner")      \
+                                                                            \
   product(uintx, NoAsyncDeflationProgressMax, 3, DIAGNOSTIC,                \
           "Max number of no progress async deflation attempts to tolerate " \
           "before adjusting the in_use_list_ceiling up (0 is off).")        \
@@ -924,6 +935,16 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseDynamicNumberOfCompilerThreads, true,                    \
           "Dynamically choose the number of parallel compiler threads")     \
                                                                             \
+  product(uint, CompilerThreadsCPUPercent, 0, EXPERIMENTAL,                 \
+          "Limit the compiler threads started by "                          \
+          "UseDynamicNumberOfCompilerThreads to this percentage of the "    \
+          "active processors, at least one per compiler (0 = no limit)")    \
+          range(0, 1000)                                                    \
+                                                                            \
+  product(uint, CompilerThreadQueueWaitMillis, 0, EXPERIMENTAL,             \
+          "Start another compiler thread only if the last task taken from " \
+          "its queue waited at least this many milliseconds")               \
+                                                                            \
   product(bool, ReduceNumberOfCompilerThreads, true, DIAGNOSTIC,            \
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
@@ -1132,6 +1153,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, UseInterpreter, true,                                       \
           "Use interpreter for non-compiled methods")                       \
                                                                             \
+  product(int, InterpreterOopMapCacheSize, 32, EXPERIMENTAL,                \
+          "Number of entries in the per-class cache of interpreter "        \
+          "oop maps")                                                       \
+          range(8, 4096)                                                    \
+                                                                            \
   develop(bool, UseFastSignatureHandlers, true,                             \
           "Use fast signature handlers for native calls")                   \
                                                                             \
@@ -1530,6 +1556,11 @@ const int ObjectAlignmentInBytes = 8;
           "Size of code heap with non-profiled methods (in bytes)")         \
           range(0, max_uintx)                                               \
                                                                             \
+  product(bool, SmallPagesForProfiledCodeHeap, false, EXPERIMENTAL,         \
+          "With UseLargePages and a segmented code cache, do not use large "\
+          "pages for the profiled code heap. Ignored if the code cache is " \
+          "backed by pinned large pages")                                   \
+                                                                            \
   product_pd(uintx, ProfiledCodeHeapSize,                                   \
           "Size of code heap with profiled methods (in bytes)")             \
           range(0, max_uintx)                                               \
@@ -1736,6 +1767,11 @@ const int ObjectAlignmentInBytes = 8;
           "up to a multiple of the native os page size.")                   \
           range(128, 32*64*K)                                               \
                                                                             \
+  product(bool, PerfDataPadCounters, false, EXPERIMENTAL,                   \
+          "Start each PerfData entry on a cache line boundary and pad it "  \
+          "to whole cache lines, so that frequently updated counters do "   \
+          "not share cache lines. Doubles the default PerfDataMemorySize.") \
+                                                                            \
   product(int, PerfMaxStringConstLength, 1024,                              \
           "Maximum PerfStringConstant string length before truncation")     \
           range(32, 32*K)                                                   \
@@ -1942,6 +1978,11 @@ const int ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, nullptr,                    \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(size_t, JfrNativeAllocationSampleInterval, 512*K,        \
+          EXPERIMENTAL,                                                     \
+          "Number of bytes a Java thread allocates with os::malloc "        \
+          "between two NativeMemoryAllocationSample events"))               \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
@@ -1967,6 +2008,11 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(size_t, TrimNativeHeapMinFreeBytes, 0, EXPERIMENTAL,              \
+          "Skip a periodic native heap trim if the C-heap is known to "     \
+          "hold less than this many free bytes that a trim could "          \
+          "return to the OS. 0 (default) trims unconditionally.")           \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
@@ -559,11 +559,13 @@ bool HandshakeState::process_by_self(bool allow_suspend, bool check_async_except
   // Threads shouldn't block if they are in the middle of printing, but...
   ttyLocker::break_tty_lock_for_safepoint(os::current_thread_id());
 
-  while (has_operation()) {
-    // Handshakes cannot safely safepoint. The exceptions to this rule are
-    // the asynchronous suspension and unsafe access error handshakes.
-    MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
+  // Handshakes cannot safely safepoint. The exceptions to this rule are
+  // the asynchronous suspension and unsafe access error handshakes.
+  // The lock is held across all synchronous operations so that the queue
+  // is drained in one batch instead of re-locking for each operation.
+  MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
 
+  while (has_operation()) {
     HandshakeOperation* op = get_op_for_self(allow_suspend, check_async_exception);
     if (op != nullptr) {
       assert(op->_target == nullptr || op->_target == Thread::current(), "Wrong thread");
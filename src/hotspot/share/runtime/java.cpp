@@ -482,6 +482,10 @@ void before_exit(JavaThread* thread, bool halt) {
     BytecodeHistogram::print();
   }
 
+  if (HotMethodsFile != nullptr) {
+    CodeCache::write_hot_methods(HotMethodsFile);
+  }
+
 #ifdef LINUX
   if (DumpPerfMapAtExit) {
     CodeCache::write_perf_map();
@@ -37,6 +37,7 @@
 #include "compiler/compilerThread.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "gc/shared/oopStorageThreadCache.hpp"
 #include "gc/shared/tlab_globals.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm.h"
@@ -429,6 +430,8 @@ JavaThread::JavaThread(MEMFLAGS flags) :
   _current_waiting_monitor(nullptr),
   _active_handles(nullptr),
   _free_handle_block(nullptr),
+  _global_handle_cache(nullptr),
+  _weak_global_handle_cache(nullptr),
 
   _suspend_flags(0),
 
@@ -487,6 +490,7 @@ JavaThread::JavaThread(MEMFLAGS flags) :
   _cont_fastpath_thread_state(1),
   _held_monitor_count(0),
   _jni_monitor_count(0),
+  _profile_sample_countdown(0),
 
   _handshake(this),
 
@@ -947,6 +951,12 @@ void JavaThread::exit(bool destroy_vm, ExitType exit_type) {
     JNIHandleBlock::release_block(block);
   }
 
+  // Deleting the caches releases their entries.
+  delete _global_handle_cache;
+  _global_handle_cache = nullptr;
+  delete _weak_global_handle_cache;
+  _weak_global_handle_cache = nullptr;
+
   // These have to be removed while this is still a valid thread.
   _stack_overflow_state.remove_stack_guard_pages();
 
@@ -1358,6 +1368,23 @@ void JavaThread::push_jni_handle_block() {
   set_active_handles(new_handles);
 }
 
+// The caches are only used by the current thread, which creates them.
+OopStorageThreadCache* JavaThread::global_handle_cache() {
+  assert(this == Thread::current(), "invariant");
+  if (_global_handle_cache == nullptr) {
+    _global_handle_cache = new OopStorageThreadCache();
+  }
+  return _global_handle_cache;
+}
+
+OopStorageThreadCache* JavaThread::weak_global_handle_cache() {
+  assert(this == Thread::current(), "invariant");
+  if (_weak_global_handle_cache == nullptr) {
+    _weak_global_handle_cache = new OopStorageThreadCache();
+  }
+  return _weak_global_handle_cache;
+}
+
 // Pop off the current block of JNI handles.
 void JavaThread::pop_jni_handle_block() {
   // Release our JNI handle block
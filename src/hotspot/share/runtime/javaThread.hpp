@@ -63,6 +63,7 @@ class JvmtiThreadState;
 class Metadata;
 class OopHandleList;
 class OopStorage;
+class OopStorageThreadCache;
 class OSThread;
 
 class ThreadsList;
@@ -158,6 +159,11 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Released JNI global and weak global handles kept for reuse,
+  // allocated on first use
+  OopStorageThreadCache* _global_handle_cache;
+  OopStorageThreadCache* _weak_global_handle_cache;
+
  public:
   // For tracking the heavyweight monitor the thread is pending on.
   ObjectMonitor* current_pending_monitor() {
@@ -187,6 +193,8 @@ class JavaThread: public Thread {
   JNIHandleBlock* active_handles() const         { return _active_handles; }
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
+  OopStorageThreadCache* global_handle_cache();
+  OopStorageThreadCache* weak_global_handle_cache();
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
 
   void push_jni_handle_block();
@@ -464,6 +472,9 @@ class JavaThread: public Thread {
   intx _held_monitor_count;  // used by continuations for fast lock detection
   intx _jni_monitor_count;
 
+  // Branches left until the next sampled branch profile update in C1 code
+  int _profile_sample_countdown;
+
 private:
 
   friend class VMThread;
@@ -827,6 +838,7 @@ class JavaThread: public Thread {
   static ByteSize cont_fastpath_offset()      { return byte_offset_of(JavaThread, _cont_fastpath); }
   static ByteSize held_monitor_count_offset() { return byte_offset_of(JavaThread, _held_monitor_count); }
   static ByteSize jni_monitor_count_offset()  { return byte_offset_of(JavaThread, _jni_monitor_count); }
+  static ByteSize profile_sample_countdown_offset() { return byte_offset_of(JavaThread, _profile_sample_countdown); }
 
 #if INCLUDE_JVMTI
   static ByteSize is_in_VTMS_transition_offset()     { return byte_offset_of(JavaThread, _is_in_VTMS_transition); }
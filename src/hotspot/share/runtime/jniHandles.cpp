@@ -26,6 +26,7 @@
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "gc/shared/oopStorageThreadCache.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
 #include "memory/universe.hpp"
@@ -71,6 +72,36 @@ jobject JNIHandles::make_local(JavaThread* thread, oop obj, AllocFailType alloc_
   }
 }
 
+// Returns the current thread's cache of released global or weak global
+// handles, or null if handles are not cached.  Caching is disabled when
+// checking JNI calls, as a cached entry still looks allocated and would
+// hide the use of a deleted handle.
+static OopStorageThreadCache* handle_cache(bool weak) {
+  if ((OopStorageThreadCacheSize == 0) || CheckJNICalls) {
+    return nullptr;
+  }
+  Thread* thread = Thread::current();
+  if (!thread->is_Java_thread()) {
+    return nullptr;
+  }
+  JavaThread* jt = JavaThread::cast(thread);
+  return weak ? jt->weak_global_handle_cache() : jt->global_handle_cache();
+}
+
+static oop* allocate_handle_entry(OopStorage* storage, bool weak) {
+  OopStorageThreadCache* cache = handle_cache(weak);
+  return (cache != nullptr) ? cache->allocate(storage) : storage->allocate();
+}
+
+static void release_handle_entry(OopStorage* storage, oop* ptr, bool weak) {
+  OopStorageThreadCache* cache = handle_cache(weak);
+  if (cache != nullptr) {
+    cache->release(storage, ptr);
+  } else {
+    storage->release(ptr);
+  }
+}
+
 static void report_handle_allocation_failure(AllocFailType alloc_failmode,
                                              const char* handle_kind) {
   if (alloc_failmode == AllocFailStrategy::EXIT_OOM) {
@@ -89,7 +120,7 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    oop* ptr = allocate_handle_entry(global_handles(), false /* weak */);
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -111,7 +142,7 @@ jweak JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    oop* ptr = allocate_handle_entry(weak_global_handles(), true /* weak */);
     // Return nullptr on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -148,7 +179,7 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
-    global_handles()->release(oop_ptr);
+    release_handle_entry(global_handles(), oop_ptr, false /* weak */);
   }
 }
 
@@ -157,7 +188,7 @@ void JNIHandles::destroy_weak_global(jweak handle) {
   if (handle != nullptr) {
     oop* oop_ptr = weak_global_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)nullptr);
-    weak_global_handles()->release(oop_ptr);
+    release_handle_entry(weak_global_handles(), oop_ptr, true /* weak */);
   }
 }
 
@@ -1874,13 +1874,16 @@ inline static int adjust_up(int spin_duration) {
 }
 
 inline static int adjust_down(int spin_duration) {
-  // TODO: Use an AIMD-like policy to adjust _SpinDuration.
-  // AIMD is globally stable.
   int x = spin_duration;
   if (x > 0) {
-    // Consider an AIMD scheme like: x -= (x >> 3) + 100
-    // This is globally sample and tends to damp the response.
-    x -= Knob_Penalty;
+    if (MonitorSpinAIMD) {
+      // AIMD is globally stable and tends to damp the response. From the
+      // spin limit a monitor stops spinning after 15 failures instead of 25,
+      // while short durations recover as before via adjust_up().
+      x -= (x >> 3) + (Knob_Penalty >> 1);
+    } else {
+      x -= Knob_Penalty;
+    }
     if (x < 0) { x = 0; }
     return x;
   } else {
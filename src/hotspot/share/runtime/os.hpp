@@ -485,6 +485,10 @@ class os: AllStatic {
   struct size_change_t { size_t before; size_t after; };
   static bool trim_native_heap(size_change_t* rss_change = nullptr);
 
+  // Returns the number of free bytes retained by the C-heap that a trim could
+  // potentially return to the OS, or SIZE_MAX if that cannot be determined.
+  static size_t trimmable_native_heap_size();
+
   // A diagnostic function to print memory mappings in the given range.
   static void print_memory_mappings(char* addr, size_t bytes, outputStream* st);
   // Prints all mappings
@@ -134,8 +134,9 @@ void PerfData::create_entry(BasicType dtype, size_t dsize, size_t vlen) {
   size_t data_start = size;
   size += (dsize * dlen);
 
-  // align size to assure allocation in units of 8 bytes
-  int align = sizeof(jlong) - 1;
+  // align size to assure allocation in units of 8 bytes, or in whole
+  // cache lines to keep entries from sharing them
+  size_t align = (PerfDataPadCounters ? DEFAULT_CACHE_LINE_SIZE : sizeof(jlong)) - 1;
   size = ((size + align) & ~align);
   char* psmp = PerfMemory::alloc(size);
 
@@ -28,6 +28,7 @@
 #include "memory/allocation.inline.hpp"
 #include "runtime/arguments.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
 #include "runtime/mutex.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -93,6 +94,16 @@ void PerfMemory::initialize() {
     // initialization already performed
     return;
 
+  if (PerfDataPadCounters && FLAG_IS_DEFAULT(PerfDataMemorySize)) {
+    // padded entries need roughly twice the space
+    FLAG_SET_ERGO(PerfDataMemorySize, 2 * PerfDataMemorySize);
+  }
+
+  // with PerfDataPadCounters the first entry starts on a cache line boundary
+  const size_t entry_offset = PerfDataPadCounters
+                                ? align_up(sizeof(PerfDataPrologue), DEFAULT_CACHE_LINE_SIZE)
+                                : sizeof(PerfDataPrologue);
+
   size_t capacity = align_up((size_t)PerfDataMemorySize,
                              os::vm_allocation_granularity());
 
@@ -133,7 +144,7 @@ void PerfMemory::initialize() {
 
     _prologue = (PerfDataPrologue *)_start;
     _end = _start + _capacity;
-    _top = _start + sizeof(PerfDataPrologue);
+    _top = _start + entry_offset;
   }
 
   assert(_prologue != nullptr, "prologue pointer must be initialized");
@@ -150,7 +161,7 @@ void PerfMemory::initialize() {
   _prologue->minor_version = PERFDATA_MINOR_VERSION;
   _prologue->accessible = 0;
 
-  _prologue->entry_offset = sizeof(PerfDataPrologue);
+  _prologue->entry_offset = (jint)entry_offset;
   _prologue->num_entries = 0;
   _prologue->used = 0;
   _prologue->overflow = 0;
@@ -85,12 +85,14 @@ static void post_safepoint_synchronize_event(EventSafepointStateSynchronization&
                                              uint64_t safepoint_id,
                                              int initial_number_of_threads,
                                              int threads_waiting_to_block,
-                                             int iterations) {
+                                             int iterations,
+                                             jlong arming_time) {
   if (event.should_commit()) {
     event.set_safepointId(safepoint_id);
     event.set_initialThreadCount(initial_number_of_threads);
     event.set_runningThreadCount(threads_waiting_to_block);
     event.set_iterations(checked_cast<u4>(iterations));
+    event.set_armingTime(arming_time);
     event.commit();
   }
 }
@@ -367,7 +369,9 @@ void SafepointSynchronize::begin() {
   int initial_running = 0;
 
   // Arms the safepoint, _current_jni_active_count and _waiting_to_block must be set before.
+  SafepointTracing::arming();
   arm_safepoint();
+  SafepointTracing::armed();
 
   // Will spin until all threads are safe.
   int iterations = synchronize_threads(safepoint_limit_time, nof_threads, &initial_running);
@@ -415,7 +419,8 @@ void SafepointSynchronize::begin() {
   post_safepoint_synchronize_event(sync_event,
                                    _safepoint_id,
                                    initial_running,
-                                   _waiting_to_block, iterations);
+                                   _waiting_to_block, iterations,
+                                   SafepointTracing::last_arming_time_ns());
 
   SafepointTracing::synchronized(nof_threads, initial_running, _nof_threads_hit_polling_page);
 
@@ -860,6 +865,8 @@ void ThreadSafepointState::handle_polling_page_exception() {
 // Implementation of SafepointTracing
 
 jlong SafepointTracing::_last_safepoint_begin_time_ns = 0;
+jlong SafepointTracing::_last_safepoint_arming_time_ns = 0;
+jlong SafepointTracing::_last_safepoint_armed_time_ns = 0;
 jlong SafepointTracing::_last_safepoint_sync_time_ns = 0;
 jlong SafepointTracing::_last_safepoint_end_time_ns = 0;
 jlong SafepointTracing::_last_app_time_ns = 0;
@@ -946,6 +953,8 @@ void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
 
   // update the time stamp to begin recording safepoint time
   _last_safepoint_begin_time_ns = os::javaTimeNanos();
+  _last_safepoint_arming_time_ns = 0;
+  _last_safepoint_armed_time_ns = 0;
   _last_safepoint_sync_time_ns = 0;
 
   _last_app_time_ns = _last_safepoint_begin_time_ns - _last_safepoint_end_time_ns;
@@ -954,11 +963,26 @@ void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
   RuntimeService::record_safepoint_begin(_last_app_time_ns);
 }
 
+// Arming is timed on its own, without the waits for suspendible GC threads
+// and the Threads_lock that precede it.
+void SafepointTracing::arming() {
+  _last_safepoint_arming_time_ns = os::javaTimeNanos();
+}
+
+void SafepointTracing::armed() {
+  _last_safepoint_armed_time_ns = os::javaTimeNanos();
+}
+
 void SafepointTracing::synchronized(int nof_threads, int nof_running, int traps) {
   _last_safepoint_sync_time_ns = os::javaTimeNanos();
   _nof_threads = nof_threads;
   _nof_running = nof_running;
   _page_trap   = traps;
+  log_debug(safepoint)("Safepoint synchronization time breakdown: "
+                       "Arming: " JLONG_FORMAT " ns, "
+                       "Waiting for threads: " JLONG_FORMAT " ns",
+                       _last_safepoint_armed_time_ns - _last_safepoint_arming_time_ns,
+                       _last_safepoint_sync_time_ns  - _last_safepoint_armed_time_ns);
   RuntimeService::record_safepoint_synchronized(_last_safepoint_sync_time_ns - _last_safepoint_begin_time_ns);
 }
 
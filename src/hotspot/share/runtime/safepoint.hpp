@@ -229,6 +229,8 @@ class SafepointTracing : public AllStatic {
 private:
   // Absolute
   static jlong _last_safepoint_begin_time_ns;
+  static jlong _last_safepoint_arming_time_ns;
+  static jlong _last_safepoint_armed_time_ns;
   static jlong _last_safepoint_sync_time_ns;
   static jlong _last_safepoint_end_time_ns;
 
@@ -250,6 +252,8 @@ class SafepointTracing : public AllStatic {
   static void init();
 
   static void begin(VM_Operation::VMOp_Type type);
+  static void arming();
+  static void armed();
   static void synchronized(int nof_threads, int nof_running, int traps);
   static void end();
 
@@ -266,6 +270,10 @@ class SafepointTracing : public AllStatic {
   static jlong start_of_safepoint() {
     return _last_safepoint_begin_time_ns;
   }
+
+  static jlong last_arming_time_ns() {
+    return _last_safepoint_armed_time_ns - _last_safepoint_arming_time_ns;
+  }
 };
 
 #endif // SHARE_RUNTIME_SAFEPOINT_HPP
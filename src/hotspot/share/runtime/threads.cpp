@@ -1326,19 +1326,7 @@ void Threads::print_on(outputStream* st, bool print_stacks,
       if (internal_format) {
         p->trace_stack();
       } else {
-        p->print_stack_on(st);
-        const oop thread_oop = p->threadObj();
-        if (thread_oop != nullptr) {
-          if (p->is_vthread_mounted()) {
-            const oop vt = p->vthread();
-            assert(vt != nullptr, "vthread should not be null when vthread is mounted");
-            // JavaThread._vthread can refer to the carrier thread. Print only if _vthread refers to a virtual thread.
-            if (vt != thread_oop) {
-              st->print_cr("   Mounted virtual thread #" INT64_FORMAT, (int64_t)java_lang_Thread::thread_id(vt));
-              p->print_vthread_stack_on(st);
-            }
-          }
-        }
+        print_java_thread_stack_on(p, st);
       }
     }
     st->cr();
@@ -1355,6 +1343,22 @@ void Threads::print_on(outputStream* st, bool print_stacks,
   st->flush();
 }
 
+void Threads::print_java_thread_stack_on(JavaThread* p, outputStream* st) {
+  p->print_stack_on(st);
+  const oop thread_oop = p->threadObj();
+  if (thread_oop != nullptr) {
+    if (p->is_vthread_mounted()) {
+      const oop vt = p->vthread();
+      assert(vt != nullptr, "vthread should not be null when vthread is mounted");
+      // JavaThread._vthread can refer to the carrier thread. Print only if _vthread refers to a virtual thread.
+      if (vt != thread_oop) {
+        st->print_cr("   Mounted virtual thread #" INT64_FORMAT, (int64_t)java_lang_Thread::thread_id(vt));
+        p->print_vthread_stack_on(st);
+      }
+    }
+  }
+}
+
 void Threads::print_on_error(Thread* this_thread, outputStream* st, Thread* current, char* buf,
                              int buflen, bool* found_current) {
   if (this_thread != nullptr) {
@@ -119,6 +119,9 @@ class Threads: AllStatic {
   // Verification
   static void verify();
   static void print_on(outputStream* st, bool print_stacks, bool internal_format, bool print_concurrent_locks, bool print_extended_info);
+  // Prints the Java stack of p, and of its mounted virtual thread if any.
+  // The caller must be at a safepoint or in a handshake with p.
+  static void print_java_thread_stack_on(JavaThread* p, outputStream* st);
   static void print(bool print_stacks, bool internal_format) {
     // this function is only used by debug.cpp
     print_on(tty, print_stacks, internal_format, false /* no concurrent lock printed */, false /* simple format */);
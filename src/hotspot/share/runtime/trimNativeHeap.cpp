@@ -53,6 +53,7 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   // Statistics
   uint64_t _num_trims_performed;
+  uint64_t _num_trims_skipped;
 
   bool is_suspended() const {
     assert(_lock->is_locked(), "Must be");
@@ -136,6 +137,16 @@ class NativeHeapTrimmerThread : public NamedThread {
   void execute_trim_and_log(double t1) {
     assert(os::can_trim_native_heap(), "Unexpected");
 
+    if (TrimNativeHeapMinFreeBytes > 0) {
+      const size_t trimmable = os::trimmable_native_heap_size();
+      if (trimmable != SIZE_MAX && trimmable < TrimNativeHeapMinFreeBytes) {
+        _num_trims_skipped++;
+        log_debug(trimnative)("Periodic Trim skipped: " PROPERFMT " free in C-heap",
+                              PROPERFMTARGS(trimmable));
+        return;
+      }
+    }
+
     os::size_change_t sc = { 0, 0 };
     LogTarget(Info, trimnative) lt;
     const bool logging_enabled = lt.is_enabled();
@@ -167,7 +178,8 @@ class NativeHeapTrimmerThread : public NamedThread {
     _lock(new (std::nothrow) PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
     _suspend_count(0),
-    _num_trims_performed(0)
+    _num_trims_performed(0),
+    _num_trims_skipped(0)
   {
     set_name("Native Heap Trimmer");
     if (os::create_thread(this, os::vm_thread)) {
@@ -211,17 +223,19 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   void print_state(outputStream* st) const {
     int64_t num_trims = 0;
+    int64_t num_skipped = 0;
     bool stopped = false;
     uint16_t suspenders = 0;
     {
       // Don't pull lock during error reporting
       ConditionalMutexLocker ml(_lock, !VMError::is_error_reported(), Mutex::_no_safepoint_check_flag);
       num_trims = _num_trims_performed;
+      num_skipped = _num_trims_skipped;
       stopped = _stop;
       suspenders = _suspend_count;
     }
-    st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d",
-                 num_trims, suspenders, stopped);
+    st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d, skipped: " UINT64_FORMAT,
+                 num_trims, suspenders, stopped, num_skipped);
   }
 
 }; // NativeHeapTrimmer
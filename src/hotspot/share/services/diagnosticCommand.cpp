@@ -52,10 +52,13 @@
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
 #include "runtime/os.hpp"
+#include "runtime/threadSMR.inline.hpp"
+#include "runtime/threads.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -558,12 +561,55 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
-  _extended("-e", "print extended thread information", "BOOLEAN", false, "false") {
+  _extended("-e", "print extended thread information", "BOOLEAN", false, "false"),
+  _handshake("-handshake", "print each thread in a handshake with it instead of at a safepoint. "
+             "Does not print java.util.concurrent locks, JNI global references or deadlocks", "BOOLEAN", false, "false") {
   _dcmdparser.add_dcmd_option(&_locks);
   _dcmdparser.add_dcmd_option(&_extended);
+  _dcmdparser.add_dcmd_option(&_handshake);
+}
+
+class PrintThreadClosure : public HandshakeClosure {
+  outputStream* _st;
+  bool _print_extended_info;
+ public:
+  PrintThreadClosure(outputStream* st, bool print_extended_info) :
+    HandshakeClosure("PrintThread"), _st(st), _print_extended_info(print_extended_info) {}
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = JavaThread::cast(thread);
+    ResourceMark rm;
+    jt->print_on(_st, _print_extended_info);
+    Threads::print_java_thread_stack_on(jt, _st);
+    _st->cr();
+  }
+};
+
+// Threads are stopped one at a time, so the dump is not a consistent snapshot
+// of all threads, but no global safepoint is needed however many threads there are.
+void ThreadDumpDCmd::print_with_handshakes(TRAPS) {
+  outputStream* st = output();
+  char buf[32];
+  st->print_raw_cr(os::local_time_string(buf, sizeof(buf)));
+  st->print_cr("Full thread dump %s (%s %s), threads printed one at a time:",
+               VM_Version::vm_name(),
+               VM_Version::vm_release(),
+               VM_Version::vm_info_string());
+  st->cr();
+
+  PrintThreadClosure cl(st, _extended.value());
+  ThreadsListHandle tlh(THREAD);
+  for (uint i = 0; i < tlh.length(); i++) {
+    Handshake::execute(&cl, &tlh, tlh.thread_at(i));
+  }
 }
 
 void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
+  if (_handshake.value()) {
+    print_with_handshakes(THREAD);
+    return;
+  }
+
   // thread stacks and JNI global handles
   VM_PrintThreads op1(output(), _locks.value(), _extended.value(), true /* print JNI handle info */);
   VMThread::execute(&op1);
@@ -426,8 +426,10 @@ class ThreadDumpDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _locks;
   DCmdArgument<bool> _extended;
+  DCmdArgument<bool> _handshake;
+  void print_with_handshakes(TRAPS);
 public:
-  static int num_arguments() { return 2; }
+  static int num_arguments() { return 3; }
   ThreadDumpDCmd(outputStream* output, bool heap);
   static const char* name() { return "Thread.print"; }
   static const char* description() {
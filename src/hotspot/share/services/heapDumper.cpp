@@ -2206,6 +2206,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   volatile int            _dump_seq;
   // parallel heap dump support
   uint                    _num_dumper_threads;
+  // serial dump without segment files, for destinations that are not regular files
+  bool                    _direct_dump;
   DumperController*       _dumper_controller;
   ParallelObjectIterator* _poi;
 
@@ -2252,8 +2254,11 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
   // HPROF_TRACE and HPROF_FRAME records for platform and mounted virtual threads
   void dump_stack_traces(AbstractDumpWriter* writer);
 
+  // HPROF_HEAP_DUMP_SEGMENT records of the given dumper
+  void dump_heap_segments(uint worker_id, int dumper_id, DumpWriter* segment_writer);
+
  public:
-  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads) :
+  VM_HeapDumper(DumpWriter* writer, bool gc_before_heap_dump, bool oome, uint num_dump_threads, bool direct_dump) :
     VM_GC_Operation(0 /* total collections,      dummy, ignored */,
                     GCCause::_heap_dump /* GC Cause */,
                     0 /* total full collections, dummy, ignored */,
@@ -2270,6 +2275,8 @@ class VM_HeapDumper : public VM_GC_Operation, public WorkerTask, public Unmounte
 
     _dump_seq = VMDumperId;
     _num_dumper_threads = num_dump_threads;
+    _direct_dump = direct_dump;
+    assert(!_direct_dump || _num_dumper_threads == 1, "direct dump is serial");
     _dumper_controller = nullptr;
     _poi = nullptr;
     if (oome) {
@@ -2378,7 +2385,7 @@ void VM_HeapDumper::prepare_parallel_dump(WorkerThreads* workers) {
   uint num_active_workers = workers != nullptr ? workers->active_workers() : 0;
   uint num_requested_dump_threads = _num_dumper_threads;
   // check if we can dump in parallel based on requested and active threads
-  if (num_active_workers <= 1 || num_requested_dump_threads <= 1) {
+  if (num_active_workers <= 1 || num_requested_dump_threads <= 1 || _direct_dump) {
     _num_dumper_threads = 1;
   } else {
     _num_dumper_threads = clamp(num_requested_dump_threads, 2U, num_active_workers);
@@ -2495,56 +2502,20 @@ void VM_HeapDumper::work(uint worker_id) {
   // HPROF_HEAP_DUMP/HPROF_HEAP_DUMP_SEGMENT starts here
 
   ResourceMark rm;
-  // share global compressor, local DumpWriter is not responsible for its life cycle
-  DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
-                            writer()->is_overwrite(), writer()->compressor());
-  if (!segment_writer.has_error()) {
-    if (is_vm_dumper(dumper_id)) {
-      // dump some non-heap subrecords to heap dump segment
-      TraceTime timer("Dump non-objects (part 2)", TRACETIME_LOG(Info, heapdump));
-      // Writes HPROF_GC_CLASS_DUMP records
-      ClassDumper class_dumper(&segment_writer);
-      ClassLoaderDataGraph::classes_do(&class_dumper);
-
-      // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
-      dump_threads(&segment_writer);
-
-      // HPROF_GC_ROOT_JNI_GLOBAL
-      JNIGlobalsDumper jni_dumper(&segment_writer);
-      JNIHandles::oops_do(&jni_dumper);
-      // technically not jni roots, but global roots
-      // for things like preallocated throwable backtraces
-      Universe::vm_global()->oops_do(&jni_dumper);
-      // HPROF_GC_ROOT_STICKY_CLASS
-      // These should be classes in the null class loader data, and not all classes
-      // if !ClassUnloading
-      StickyClassDumper stiky_class_dumper(&segment_writer);
-      ClassLoaderData::the_null_class_loader_data()->classes_do(&stiky_class_dumper);
-    }
-
-    // Heap iteration.
-    // writes HPROF_GC_INSTANCE_DUMP records.
-    // After each sub-record is written check_segment_length will be invoked
-    // to check if the current segment exceeds a threshold. If so, a new
-    // segment is started.
-    // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
-    // of the heap dump.
-
-    TraceTime timer(is_parallel_dump() ? "Dump heap objects in parallel" : "Dump heap objects", TRACETIME_LOG(Info, heapdump));
-    HeapObjectDumper obj_dumper(&segment_writer, this);
-    if (!is_parallel_dump()) {
-      Universe::heap()->object_iterate(&obj_dumper);
-    } else {
-      // == Parallel dump
-      _poi->object_iterate(&obj_dumper, worker_id);
+  if (_direct_dump) {
+    // There is a single dumper, writing its segments straight into the destination.
+    dump_heap_segments(worker_id, dumper_id, writer());
+    _dumper_controller->dumper_complete(writer(), writer());
+  } else {
+    // share global compressor, local DumpWriter is not responsible for its life cycle
+    DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
+                              writer()->is_overwrite(), writer()->compressor());
+    if (!segment_writer.has_error()) {
+      dump_heap_segments(worker_id, dumper_id, &segment_writer);
     }
-
-    segment_writer.finish_dump_segment();
-    segment_writer.flush();
+    _dumper_controller->dumper_complete(&segment_writer, writer());
   }
 
-  _dumper_controller->dumper_complete(&segment_writer, writer());
-
   if (is_vm_dumper(dumper_id)) {
     _dumper_controller->wait_all_dumpers_complete();
 
@@ -2556,6 +2527,51 @@ void VM_HeapDumper::work(uint worker_id) {
   }
 }
 
+void VM_HeapDumper::dump_heap_segments(uint worker_id, int dumper_id, DumpWriter* segment_writer) {
+  if (is_vm_dumper(dumper_id)) {
+    // dump some non-heap subrecords to heap dump segment
+    TraceTime timer("Dump non-objects (part 2)", TRACETIME_LOG(Info, heapdump));
+    // Writes HPROF_GC_CLASS_DUMP records
+    ClassDumper class_dumper(segment_writer);
+    ClassLoaderDataGraph::classes_do(&class_dumper);
+
+    // HPROF_GC_ROOT_THREAD_OBJ + frames + jni locals
+    dump_threads(segment_writer);
+
+    // HPROF_GC_ROOT_JNI_GLOBAL
+    JNIGlobalsDumper jni_dumper(segment_writer);
+    JNIHandles::oops_do(&jni_dumper);
+    // technically not jni roots, but global roots
+    // for things like preallocated throwable backtraces
+    Universe::vm_global()->oops_do(&jni_dumper);
+    // HPROF_GC_ROOT_STICKY_CLASS
+    // These should be classes in the null class loader data, and not all classes
+    // if !ClassUnloading
+    StickyClassDumper stiky_class_dumper(segment_writer);
+    ClassLoaderData::the_null_class_loader_data()->classes_do(&stiky_class_dumper);
+  }
+
+  // Heap iteration.
+  // writes HPROF_GC_INSTANCE_DUMP records.
+  // After each sub-record is written check_segment_length will be invoked
+  // to check if the current segment exceeds a threshold. If so, a new
+  // segment is started.
+  // The HPROF_GC_CLASS_DUMP and HPROF_GC_INSTANCE_DUMP are the vast bulk
+  // of the heap dump.
+
+  TraceTime timer(is_parallel_dump() ? "Dump heap objects in parallel" : "Dump heap objects", TRACETIME_LOG(Info, heapdump));
+  HeapObjectDumper obj_dumper(segment_writer, this);
+  if (!is_parallel_dump()) {
+    Universe::heap()->object_iterate(&obj_dumper);
+  } else {
+    // == Parallel dump
+    _poi->object_iterate(&obj_dumper, worker_id);
+  }
+
+  segment_writer->finish_dump_segment();
+  segment_writer->flush();
+}
+
 void VM_HeapDumper::dump_stack_traces(AbstractDumpWriter* writer) {
   // write a HPROF_TRACE record without any frames to be referenced as object alloc sites
   DumperSupport::write_header(writer, HPROF_TRACE, 3 * sizeof(u4));
@@ -2607,6 +2623,10 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
 
   // write HPROF_TRACE/HPROF_FRAME records to global writer
   _dumper_controller->lock_global_writer();
+  if (_direct_dump) {
+    // The global writer is the segment writer, top-level records can only go between segments.
+    segment_writer->finish_dump_segment();
+  }
   thread_dumper.dump_stack_traces(writer(), _klass_map);
   _dumper_controller->unlock_global_writer();
 
@@ -2662,8 +2682,16 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     return -1;
   }
 
+  // A destination that is not a regular file, e.g. a named pipe read by a remote
+  // consumer, is written directly by a single dumper without segment files.
+  struct stat st;
+  const bool direct_dump = os::stat(path, &st) == 0 && (st.st_mode & S_IFMT) != S_IFREG;
+  if (direct_dump) {
+    num_dump_threads = 1;
+  }
+
   // generate the segmented heap dump into separate files
-  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
+  VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads, direct_dump);
   VMThread::execute(&dumper);
 
   // record any error that the writer may have encountered
@@ -2677,7 +2705,8 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   // Phase 2: Merge multiple heap files into one complete heap dump file.
   //          This is done by DumpMerger, which is performed outside safepoint
 
-  DumpMerger merger(path, &writer, dumper.dump_seq());
+  // Nothing to merge for a direct dump, only the HPROF_HEAP_DUMP_END record is written.
+  DumpMerger merger(path, &writer, direct_dump ? 0 : dumper.dump_seq());
   // Perform heapdump file merge operation in the current thread prevents us
   // from occupying the VM Thread, which in turn affects the occurrence of
   // GC and other VM operations.
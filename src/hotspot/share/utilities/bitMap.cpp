@@ -529,68 +529,70 @@ void BitMap::set_intersection(const BitMap& other) {
 
 bool BitMap::set_union_with_result(const BitMap& other) {
   assert(size() == other.size(), "must have same size");
-  bool changed = false;
+  // Accumulate the changed bits rather than a short-circuited flag, so
+  // the loop is branch-free and can be vectorized by the compiler.
+  bm_word_t changed = 0;
   bm_word_t* dest_map = map();
   const bm_word_t* other_map = other.map();
   idx_t limit = to_words_align_down(size());
   for (idx_t index = 0; index < limit; ++index) {
     bm_word_t orig = dest_map[index];
     bm_word_t temp = orig | other_map[index];
-    changed = changed || (temp != orig);
+    changed |= temp ^ orig;
     dest_map[index] = temp;
   }
   idx_t rest = bit_in_word(size());
   if (rest > 0) {
     bm_word_t orig = dest_map[limit];
     bm_word_t temp = merge_tail_of_map(orig | other_map[limit], orig, rest);
-    changed = changed || (temp != orig);
+    changed |= temp ^ orig;
     dest_map[limit] = temp;
   }
-  return changed;
+  return changed != 0;
 }
 
 bool BitMap::set_difference_with_result(const BitMap& other) {
   assert(size() == other.size(), "must have same size");
-  bool changed = false;
+  bm_word_t changed = 0;
   bm_word_t* dest_map = map();
   const bm_word_t* other_map = other.map();
   idx_t limit = to_words_align_down(size());
   for (idx_t index = 0; index < limit; ++index) {
     bm_word_t orig = dest_map[index];
     bm_word_t temp = orig & ~other_map[index];
-    changed = changed || (temp != orig);
+    changed |= temp ^ orig;
     dest_map[index] = temp;
   }
   idx_t rest = bit_in_word(size());
   if (rest > 0) {
     bm_word_t orig = dest_map[limit];
     bm_word_t temp = merge_tail_of_map(orig & ~other_map[limit], orig, rest);
-    changed = changed || (temp != orig);
+    changed |= temp ^ orig;
     dest_map[limit] = temp;
   }
-  return changed;
+  return changed != 0;
 }
 
 bool BitMap::set_intersection_with_result(const BitMap& other) {
   assert(size() == other.size(), "must have same size");
-  bool changed = false;
+  bm_word_t changed = 0;
   bm_word_t* dest_map = map();
   const bm_word_t* other_map = other.map();
   idx_t limit = to_words_align_down(size());
   for (idx_t index = 0; index < limit; ++index) {
     bm_word_t orig = dest_map[index];
     bm_word_t temp = orig & other_map[index];
-    changed = changed || (temp != orig);
+    changed |= temp ^ orig;
     dest_map[index] = temp;
   }
   idx_t rest = bit_in_word(size());
   if (rest > 0) {
     bm_word_t orig = dest_map[limit];
     bm_word_t temp = merge_tail_of_map(orig & other_map[limit], orig, rest);
-    changed = changed || (temp != orig);
+    changed |= temp ^ orig;
     dest_map[limit] = temp;
   }
-  return changed;
+  return changed != 0;
 }
 
 void BitMap::set_from(const BitMap& other) {
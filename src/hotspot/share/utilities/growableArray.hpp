@@ -851,6 +851,61 @@ class GrowableArrayCHeap : public GrowableArrayWithAllocator<E, GrowableArrayCHe
   }
 };
 
+// GrowableArray with inline storage for the first N elements.
+//
+// The data array only moves to the resource area, or to the given arena, once
+// more than N elements are needed. Short-lived or mostly-small arrays thus
+// avoid a separate allocation and keep their elements next to the instance.
+//
+// Since the elements may live inside the instance, it can neither be copied
+// nor swapped with another array. Once the elements have moved out of the
+// inline storage they do not move back.
+template <typename E, int N>
+class GrowableArrayInline : public GrowableArrayWithAllocator<E, GrowableArrayInline<E, N> > {
+  friend class GrowableArrayWithAllocator<E, GrowableArrayInline<E, N> >;
+
+  STATIC_ASSERT(N > 0);
+
+  Arena* const _arena;
+  debug_only(GrowableArrayNestingCheck _nesting_check;)
+  alignas(E) char _inline_data[N * sizeof(E)];
+
+  NONCOPYABLE(GrowableArrayInline);
+
+  E* allocate() {
+    if (_arena != nullptr) {
+      return (E*)GrowableArrayArenaAllocator::allocate(this->_capacity, sizeof(E), _arena);
+    }
+    debug_only(_nesting_check.on_resource_area_alloc());
+    return (E*)GrowableArrayResourceAllocator::allocate(this->_capacity, sizeof(E));
+  }
+
+  // Nothing to free: resource area and arena memory is released in bulk,
+  // and the inline storage is part of the instance.
+  void deallocate(E* mem) {}
+
+public:
+  // Resource area backed when growing beyond N elements.
+  GrowableArrayInline() :
+      GrowableArrayWithAllocator<E, GrowableArrayInline<E, N> >(
+          reinterpret_cast<E*>(_inline_data), N),
+      _arena(nullptr)
+      debug_only(COMMA _nesting_check(true)) {}
+
+  // Arena backed when growing beyond N elements.
+  explicit GrowableArrayInline(Arena* arena) :
+      GrowableArrayWithAllocator<E, GrowableArrayInline<E, N> >(
+          reinterpret_cast<E*>(_inline_data), N),
+      _arena(arena)
+      debug_only(COMMA _nesting_check(false)) {
+    assert(arena != nullptr, "use the default constructor for resource area allocation");
+  }
+
+  bool is_inline() const { return this->_data == reinterpret_cast<const E*>(_inline_data); }
+
+  void swap(GrowableArrayWithAllocator<E, GrowableArrayInline<E, N> >* other) = delete;
+};
+
 // Custom STL-style iterator to iterate over GrowableArrays
 // It is constructed by invoking GrowableArray::begin() and GrowableArray::end()
 template <typename E>
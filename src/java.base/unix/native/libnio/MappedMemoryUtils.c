@@ -40,6 +40,11 @@ typedef unsigned char mincore_vec_t;
 typedef char mincore_vec_t;
 #endif
 
+/* Since Linux 5.14; may be missing from older headers */
+#if defined(__linux__) && !defined(MADV_POPULATE_READ)
+#define MADV_POPULATE_READ 22
+#endif
+
 JNIEXPORT jboolean JNICALL
 Java_java_nio_MappedMemoryUtils_isLoaded0(JNIEnv *env, jobject obj, jlong address,
                                          jlong len, jlong numPages)
@@ -85,6 +90,15 @@ Java_java_nio_MappedMemoryUtils_load0(JNIEnv *env, jobject obj, jlong address,
                                      jlong len)
 {
     char *a = (char *)jlong_to_ptr(address);
+#ifdef MADV_POPULATE_READ
+    /* Fault the whole range in with one call, instead of a page fault per
+     * page when the caller touches it. Older kernels reject the advice with
+     * EINVAL, and it can also fail for ranges beyond the end of the file, so
+     * fall back to MADV_WILLNEED on any error. */
+    if (madvise((caddr_t)a, (size_t)len, MADV_POPULATE_READ) == 0) {
+        return;
+    }
+#endif
     int result = madvise((caddr_t)a, (size_t)len, MADV_WILLNEED);
     if (result == -1) {
         JNU_ThrowIOExceptionWithMessageAndLastError(env, "madvise with advise MADV_WILLNEED failed");
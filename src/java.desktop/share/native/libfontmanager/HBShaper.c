@@ -225,6 +225,13 @@ JDKFontInfo*
 #define TYPO_LIGA 0x00000002
 #define TYPO_RTL  0x80000000
 
+/*
+ * HarfBuzz only looks at a few code points of context on either side of
+ * the run being shaped, so only that much of the text around the run needs
+ * to be copied out of the Java array. This is generous for surrogate pairs.
+ */
+#define CONTEXT_CHARS 32
+
 JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
     (JNIEnv *env, jclass cls,
      jobject font2D,
@@ -247,11 +254,12 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_font_t* hbfont;
      jchar  *chars;
      jsize len;
+     jint ctxStart, ctxLimit;
      int glyphCount;
      hb_glyph_info_t *glyphInfo;
      hb_glyph_position_t *glyphPos;
      hb_direction_t direction = HB_DIRECTION_LTR;
-     hb_feature_t *features = NULL;
+     hb_feature_t features[2];
      int featureCount = 0;
      char* kern = (flags & TYPO_KERN) ? "kern" : "-kern";
      char* liga = (flags & TYPO_LIGA) ? "liga" : "-liga";
@@ -281,37 +289,47 @@ JNIEXPORT jboolean JNICALL Java_sun_font_SunLayoutEngine_shape
      hb_buffer_set_cluster_level(buffer,
                                  HB_BUFFER_CLUSTER_LEVEL_MONOTONE_CHARACTERS);
 
-     chars = (*env)->GetCharArrayElements(env, text, NULL);
+     /* Copy the run and its context rather than the whole text array. */
+     len = (*env)->GetArrayLength(env, text);
+     ctxStart = offset > CONTEXT_CHARS ? offset - CONTEXT_CHARS : 0;
+     ctxLimit = len - limit > CONTEXT_CHARS ? limit + CONTEXT_CHARS : len;
+     chars = (jchar*)malloc((ctxLimit - ctxStart + 1) * sizeof(jchar));
+     if (chars == NULL) {
+         hb_buffer_destroy(buffer);
+         hb_font_destroy(hbfont);
+         free((void*)jdkFontInfo);
+         JNU_ThrowOutOfMemoryError(env, NULL);
+         return JNI_FALSE;
+     }
+     (*env)->GetCharArrayRegion(env, text, ctxStart, ctxLimit - ctxStart, chars);
      if ((*env)->ExceptionCheck(env)) {
          hb_buffer_destroy(buffer);
          hb_font_destroy(hbfont);
          free((void*)jdkFontInfo);
+         free(chars);
          return JNI_FALSE;
      }
-     len = (*env)->GetArrayLength(env, text);
 
-     hb_buffer_add_utf16(buffer, chars, len, offset, limit-offset);
+     /* Cluster values are relative to the copied text, see storeGVData. */
+     hb_buffer_add_utf16(buffer, chars, ctxLimit - ctxStart,
+                         offset - ctxStart, limit - offset);
 
-     features = calloc(2, sizeof(hb_feature_t));
-     if (features) {
-         hb_feature_from_string(kern, -1, &features[featureCount++]);
-         hb_feature_from_string(liga, -1, &features[featureCount++]);
-     }
+     hb_feature_from_string(kern, -1, &features[featureCount++]);
+     hb_feature_from_string(liga, -1, &features[featureCount++]);
 
      hb_shape_full(hbfont, buffer, features, featureCount, 0);
      glyphCount = hb_buffer_get_length(buffer);
      glyphInfo = hb_buffer_get_glyph_infos(buffer, 0);
      glyphPos = hb_buffer_get_glyph_positions(buffer, &buflen);
 
-     ret = storeGVData(env, gvdata, slot, baseIndex, offset, startPt,
+     ret = storeGVData(env, gvdata, slot, baseIndex, offset - ctxStart, startPt,
                        limit - offset, glyphCount, glyphInfo, glyphPos,
                        jdkFontInfo->devScale);
 
      hb_buffer_destroy (buffer);
      hb_font_destroy(hbfont);
      free((void*)jdkFontInfo);
-     if (features != NULL) free(features);
-     (*env)->ReleaseCharArrayElements(env, text, chars, JNI_ABORT);
+     free(chars);
      return ret;
 }
 
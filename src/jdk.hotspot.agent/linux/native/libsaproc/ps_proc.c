@@ -61,6 +61,25 @@ static inline uintptr_t align(uintptr_t ptr, size_t size) {
 // ptrace functions
 // ---------------------------------------------
 
+// read as much of "size" bytes at "addr" as possible with process_vm_readv,
+// which transfers the whole range in one system call instead of one
+// PTRACE_PEEKDATA call per word. Returns the number of bytes read; the
+// caller falls back to ptrace for the rest (for example if the system call
+// is unavailable or the range crosses into an unreadable page).
+static size_t process_read_data_vm(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
+  size_t done = 0;
+  while (done < size) {
+    struct iovec local_iov = { buf + done, size - done };
+    struct iovec remote_iov = { (void*)(addr + done), size - done };
+    ssize_t n = process_vm_readv(ph->pid, &local_iov, 1, &remote_iov, 1, 0);
+    if (n <= 0) {
+      break;
+    }
+    done += (size_t)n;
+  }
+  return done;
+}
+
 // read "size" bytes of data from "addr" within the target process.
 // unlike the standard ptrace() function, process_read_data() can handle
 // unaligned address - alignment check, if required, should be done
@@ -69,6 +88,14 @@ static inline uintptr_t align(uintptr_t ptr, size_t size) {
 static bool process_read_data(struct ps_prochandle* ph, uintptr_t addr, char *buf, size_t size) {
   long rslt;
   size_t i, words;
+  size_t done = process_read_data_vm(ph, addr, buf, size);
+  if (done == size) {
+    return true;
+  }
+  addr += done;
+  buf += done;
+  size -= done;
+
   uintptr_t end_addr = addr + size;
   uintptr_t aligned_addr = align(addr, sizeof(long));
 
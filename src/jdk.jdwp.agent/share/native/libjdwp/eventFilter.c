@@ -374,10 +374,15 @@ eventInstance(EventInfo *evinfo)
  *
  * If shouldDelete is returned true, a count filter has expired
  * and the corresponding node should be deleted.
+ *
+ * The name of the event class is only needed by class pattern
+ * filters. It is looked up on first use and returned in *classname,
+ * so that it can be shared by all handlers the event is passed to.
+ * The caller must free it.
  */
 jboolean
 eventFilterRestricted_passesFilter(JNIEnv *env,
-                                   char *classname,
+                                   char **classname,
                                    EventInfo *evinfo,
                                    HandlerNode *node,
                                    jboolean *shouldDelete)
@@ -497,7 +502,10 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
                 break;
 
         case JDWP_REQUEST_MODIFIER(ClassMatch): {
-            if (!patternStringMatch(classname,
+            if (*classname == NULL) {
+                *classname = getClassname(clazz);
+            }
+            if (!patternStringMatch(*classname,
                        filter->u.ClassMatch.classPattern)) {
                 return JNI_FALSE;
             }
@@ -505,7 +513,10 @@ eventFilterRestricted_passesFilter(JNIEnv *env,
         }
 
         case JDWP_REQUEST_MODIFIER(ClassExclude): {
-            if (patternStringMatch(classname,
+            if (*classname == NULL) {
+                *classname = getClassname(clazz);
+            }
+            if (patternStringMatch(*classname,
                       filter->u.ClassExclude.classPattern)) {
                 return JNI_FALSE;
             }
@@ -551,7 +551,7 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
         char        *classname;
 
         node = getHandlerChain(ei)->first;
-        classname = getClassname(evinfo->clazz);
+        classname = NULL; /* looked up by the filters if needed */
 
         /* Filter the event over each handler node. */
         while (node != NULL) {
@@ -559,7 +559,7 @@ filterAndHandleEvent(JNIEnv *env, EventInfo *evinfo, EventIndex ei,
             HandlerNode *next = NEXT(node);
             jboolean shouldDelete;
 
-            if (eventFilterRestricted_passesFilter(env, classname,
+            if (eventFilterRestricted_passesFilter(env, &classname,
                                                    evinfo, node,
                                                    &shouldDelete)) {
                 HandlerFunction func = HANDLER_FUNCTION(node);
@@ -145,6 +145,23 @@ TEST_VM_F(DirectivesParserTest, c2_block) {
       "]" "\n");
 }
 
+#ifdef COMPILER2
+TEST_VM_F(DirectivesParserTest, c2_optimization_limits) {
+  test_positive(
+      "[" "\n"
+      "  {" "\n"
+      "    match: \"foo/bar.*\"," "\n"
+      "    c2: {" "\n"
+      "      MaxInlineSize: 70," "\n"
+      "      FreqInlineSize: 500," "\n"
+      "      LoopUnrollLimit: 20," "\n"
+      "      Vectorize: true," "\n"
+      "    }" "\n"
+      "  }" "\n"
+      "]" "\n");
+}
+#endif // COMPILER2
+
 TEST_VM_F(DirectivesParserTest, boolean_array) {
   test_negative(
       "[" "\n"
@@ -25,6 +25,8 @@
 #include "precompiled.hpp"
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1Predictions.hpp"
+#include "runtime/os.hpp"
+#include "utilities/ostream.hpp"
 #include "unittest.hpp"
 
 TEST_VM(G1Analytics, is_initialized) {
@@ -33,3 +35,46 @@ TEST_VM(G1Analytics, is_initialized) {
   ASSERT_EQ(a.long_term_pause_time_ratio(), 0.0);
   ASSERT_EQ(a.short_term_pause_time_ratio(), 0.0);
 }
+
+static void analytics_file_name(char* buf, size_t len) {
+  os::snprintf_checked(buf, len, "%s%sg1analytics%d.txt",
+                       os::get_temp_directory(), os::file_separator(), os::current_process_id());
+}
+
+TEST_VM(G1Analytics, persisted_values_roundtrip) {
+  char path[JVM_MAXPATHLEN];
+  analytics_file_name(path, sizeof(path));
+
+  G1Predictions p(0.888888);
+  G1Analytics a(&p, nullptr);
+  for (int i = 0; i < 10; i++) {
+    a.report_cost_per_byte_ms(0.5, true /* for_young_only_phase */);
+  }
+  ASSERT_TRUE(a.save_to_file(path));
+
+  G1Analytics loaded(&p, path);
+  G1Analytics defaults(&p, nullptr);
+  // A single seed value of 0.5 predicts a much higher copy cost than the defaults.
+  ASSERT_GT(loaded.predict_object_copy_time_ms(1000, true), 100 * defaults.predict_object_copy_time_ms(1000, true));
+
+  remove(path);
+}
+
+TEST_VM(G1Analytics, persisted_values_other_configuration) {
+  char path[JVM_MAXPATHLEN];
+  analytics_file_name(path, sizeof(path));
+
+  {
+    fileStream fs(path, "w");
+    ASSERT_TRUE(fs.is_open());
+    fs.print_cr("G1Analytics 1 1 1 1");
+    fs.print_cr("cost_per_byte_copied_ms 0.5");
+  }
+
+  G1Predictions p(0.888888);
+  G1Analytics loaded(&p, path);
+  G1Analytics defaults(&p, nullptr);
+  ASSERT_EQ(loaded.predict_object_copy_time_ms(1000, true), defaults.predict_object_copy_time_ms(1000, true));
+
+  remove(path);
+}
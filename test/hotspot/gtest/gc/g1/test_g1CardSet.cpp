@@ -31,6 +31,9 @@
 #include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
 #include "unittest.hpp"
 #include "utilities/powerOfTwo.hpp"
 
@@ -78,6 +81,7 @@ class G1CardSetTest : public ::testing::Test {
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_coarsen_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -479,6 +483,82 @@ void G1CardSetTest::cardset_mt_test() {
   ASSERT_TRUE(count_cards._num_cards <= cl.added());
 }
 
+class VM_CoarsenCardSet : public VM_GTestExecuteAtSafepoint {
+  G1CardSet* _card_set;
+  size_t _num_coarsened;
+
+public:
+  VM_CoarsenCardSet(G1CardSet* card_set) : _card_set(card_set), _num_coarsened(0) { }
+
+  void doit() override { _num_coarsened = _card_set->coarsen_to_full(); }
+
+  size_t num_coarsened() const { return _num_coarsened; }
+};
+
+void G1CardSetTest::cardset_coarsen_test() {
+  const uint CardsPerRegion = 2048;
+  const double FullCardSetThreshold = 0.8;
+  const double BitmapCoarsenThreshold = 0.9;
+
+  G1CardSetConfiguration config(28,
+                                BitmapCoarsenThreshold,
+                                8,
+                                FullCardSetThreshold,
+                                CardsPerRegion,
+                                0);
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set(&config, &mm);
+
+  // Inline pointer, array and howl containers in different card regions.
+  uint cards1[] = { 1, 2 };
+  translate_cards(CardsPerRegion, 10, cards1, ARRAY_SIZE(cards1));
+  uint cards2[] = { 3, 5, 8, 13, 21, 34, 55, 89, 144, 233 };
+  translate_cards(CardsPerRegion, 20, cards2, ARRAY_SIZE(cards2));
+
+  G1AddCardResult results1[] = { Added, Added };
+  G1AddCardResult results2[] = { Added, Added, Added, Added, Added, Added, Added, Added, Added, Added };
+  add_cards(&card_set, CardsPerRegion, cards1, ARRAY_SIZE(cards1), results1);
+  add_cards(&card_set, CardsPerRegion, cards2, ARRAY_SIZE(cards2), results2);
+
+  const uint NumHowlCards = 600;
+  for (uint i = 0; i < NumHowlCards; i++) {
+    card_set.add_card(30, i * 3);
+  }
+  ASSERT_EQ(3u, card_set.num_containers());
+
+  {
+    VM_CoarsenCardSet op(&card_set);
+    {
+      ThreadInVMfromNative invm(JavaThread::current());
+      VMThread::execute(&op);
+    }
+    ASSERT_EQ(3u, op.num_coarsened());
+  }
+
+  ASSERT_EQ(3u, card_set.num_containers());
+  ASSERT_EQ(3u * CardsPerRegion, card_set.occupied());
+  contains_cards(&card_set, CardsPerRegion, cards1, ARRAY_SIZE(cards1));
+  contains_cards(&card_set, CardsPerRegion, cards2, ARRAY_SIZE(cards2));
+  ASSERT_TRUE(card_set.contains_card(10, CardsPerRegion - 1));
+  ASSERT_TRUE(card_set.contains_card(30, 1));
+  ASSERT_FALSE(card_set.contains_card(40, 0));
+
+  check_iteration(&card_set, card_set.occupied());
+
+  {
+    // Already fully coarsened card sets are not changed.
+    VM_CoarsenCardSet op(&card_set);
+    {
+      ThreadInVMfromNative invm(JavaThread::current());
+      VMThread::execute(&op);
+    }
+    ASSERT_EQ(0u, op.num_coarsened());
+  }
+  ASSERT_EQ(3u * CardsPerRegion, card_set.occupied());
+}
+
 TEST_VM(G1CardSetTest, basic_cardset_test) {
   G1CardSetTest::cardset_basic_test();
 }
@@ -486,3 +566,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, coarsen_cardset_test) {
+  G1CardSetTest::cardset_coarsen_test();
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/allocationLatency.hpp"
+#include "unittest.hpp"
+
+TEST(AllocationLatencyHistogram, bucket_for) {
+  const uint last = AllocationLatencyHistogram::NumBuckets - 1;
+
+  EXPECT_EQ(0u, AllocationLatencyHistogram::bucket_for(0));
+  EXPECT_EQ(0u, AllocationLatencyHistogram::bucket_for(999));
+  EXPECT_EQ(1u, AllocationLatencyHistogram::bucket_for(1000));
+  EXPECT_EQ(1u, AllocationLatencyHistogram::bucket_for(1999));
+  EXPECT_EQ(2u, AllocationLatencyHistogram::bucket_for(2000));
+  EXPECT_EQ(2u, AllocationLatencyHistogram::bucket_for(3999));
+  EXPECT_EQ(11u, AllocationLatencyHistogram::bucket_for(1024 * 1000));
+  EXPECT_EQ(last, AllocationLatencyHistogram::bucket_for(((jlong)1 << (last - 1)) * 1000));
+  EXPECT_EQ(last, AllocationLatencyHistogram::bucket_for(max_jlong));
+}
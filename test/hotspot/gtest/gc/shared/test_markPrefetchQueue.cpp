@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/markPrefetchQueue.inline.hpp"
+#include "unittest.hpp"
+
+typedef MarkPrefetchQueue<int, 4> TestPrefetchQueue;
+
+static int values[32];
+
+TEST(MarkPrefetchQueue, bypass) {
+  TestPrefetchQueue queue(0);
+  int ready = -1;
+  EXPECT_TRUE(queue.push(1, &values[1], ready));
+  EXPECT_EQ(1, ready);
+  EXPECT_TRUE(queue.is_empty());
+  EXPECT_FALSE(queue.pop(ready));
+}
+
+TEST(MarkPrefetchQueue, distance) {
+  TestPrefetchQueue queue(3);
+  int ready = -1;
+  EXPECT_FALSE(queue.push(0, &values[0], ready));
+  EXPECT_FALSE(queue.push(1, &values[1], ready));
+  EXPECT_FALSE(queue.push(2, nullptr, ready));
+  EXPECT_EQ(3u, queue.size());
+
+  // Entries come out in FIFO order once the distance is exceeded.
+  EXPECT_TRUE(queue.push(3, &values[3], ready));
+  EXPECT_EQ(0, ready);
+  EXPECT_EQ(3u, queue.size());
+
+  int expected = 1;
+  while (queue.pop(ready)) {
+    EXPECT_EQ(expected++, ready);
+  }
+  EXPECT_EQ(4, expected);
+  EXPECT_TRUE(queue.is_empty());
+}
+
+TEST(MarkPrefetchQueue, wrap_around) {
+  TestPrefetchQueue queue(TestPrefetchQueue::MaxDistance);
+  int ready = -1;
+  int expected = 0;
+  for (int i = 0; i < 32; i++) {
+    if (queue.push(i, &values[i], ready)) {
+      EXPECT_EQ(expected++, ready);
+    }
+  }
+  EXPECT_EQ(32 - (int)TestPrefetchQueue::MaxDistance, expected);
+  while (queue.pop(ready)) {
+    EXPECT_EQ(expected++, ready);
+  }
+  EXPECT_EQ(32, expected);
+}
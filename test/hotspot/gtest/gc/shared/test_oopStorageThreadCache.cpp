@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/oopStorageThreadCache.hpp"
+#include "unittest.hpp"
+
+class OopStorageThreadCacheTest : public ::testing::Test {
+  OopStorage* _storage;
+
+public:
+  OopStorageThreadCacheTest() :
+    _storage(OopStorage::create("Test Thread Cache Storage", mtGC))
+  {}
+
+  ~OopStorageThreadCacheTest() {
+    delete _storage;
+  }
+
+  OopStorage* storage() const { return _storage; }
+};
+
+TEST_VM_F(OopStorageThreadCacheTest, release_is_deferred_until_flush) {
+  const uint capacity = 8;
+  OopStorageThreadCache cache(capacity);
+  oop* entries[capacity];
+
+  for (uint i = 0; i < capacity; ++i) {
+    entries[i] = cache.allocate(storage());
+    ASSERT_NE(nullptr, entries[i]);
+  }
+  EXPECT_EQ(capacity, storage()->allocation_count());
+
+  for (uint i = 0; i < capacity; ++i) {
+    cache.release(storage(), entries[i]);
+  }
+  EXPECT_EQ(capacity, cache.count());
+  EXPECT_EQ(capacity, storage()->allocation_count());
+  for (uint i = 0; i < capacity; ++i) {
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, storage()->allocation_status(entries[i]));
+  }
+
+  cache.flush();
+  EXPECT_EQ(0u, cache.count());
+  EXPECT_EQ(0u, storage()->allocation_count());
+  for (uint i = 0; i < capacity; ++i) {
+    EXPECT_EQ(OopStorage::UNALLOCATED_ENTRY, storage()->allocation_status(entries[i]));
+  }
+}
+
+TEST_VM_F(OopStorageThreadCacheTest, allocate_reuses_cached_entry) {
+  OopStorageThreadCache cache(4);
+  oop* entry = cache.allocate(storage());
+  ASSERT_NE(nullptr, entry);
+  cache.release(storage(), entry);
+  EXPECT_EQ(1u, cache.count());
+
+  EXPECT_EQ(entry, cache.allocate(storage()));
+  EXPECT_EQ(0u, cache.count());
+  EXPECT_EQ(1u, storage()->allocation_count());
+
+  cache.release(storage(), entry);
+  cache.flush();
+  EXPECT_EQ(0u, storage()->allocation_count());
+}
+
+TEST_VM_F(OopStorageThreadCacheTest, full_cache_flushes) {
+  const uint capacity = 4;
+  OopStorageThreadCache cache(capacity);
+  oop* entries[capacity + 1];
+
+  for (uint i = 0; i <= capacity; ++i) {
+    entries[i] = cache.allocate(storage());
+    ASSERT_NE(nullptr, entries[i]);
+  }
+  for (uint i = 0; i <= capacity; ++i) {
+    cache.release(storage(), entries[i]);
+  }
+  // The last release flushed the full cache before caching its entry.
+  EXPECT_EQ(1u, cache.count());
+  EXPECT_EQ(1u, storage()->allocation_count());
+
+  cache.flush();
+  EXPECT_EQ(0u, storage()->allocation_count());
+}
+
+TEST_VM_F(OopStorageThreadCacheTest, zero_capacity_releases_directly) {
+  OopStorageThreadCache cache(0);
+  oop* entry = cache.allocate(storage());
+  ASSERT_NE(nullptr, entry);
+  cache.release(storage(), entry);
+  EXPECT_EQ(0u, cache.count());
+  EXPECT_EQ(0u, storage()->allocation_count());
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "unittest.hpp"
+
+typedef GenericTaskQueue<int, mtGC> TestTaskQueue;
+typedef GenericTaskQueueSet<TestTaskQueue, mtGC> TestTaskQueueSet;
+
+class TaskQueueStealTest : public ::testing::Test {
+ protected:
+  static const uint NumQueues = 3;
+
+  TestTaskQueueSet _set;
+  TestTaskQueue _queues[NumQueues];
+
+  TaskQueueStealTest() : _set(NumQueues) {
+    for (uint i = 0; i < NumQueues; i++) {
+      _set.register_queue(i, &_queues[i]);
+    }
+  }
+
+  void fill(uint queue_num, int count) {
+    for (int i = 0; i < count; i++) {
+      ASSERT_TRUE(_queues[queue_num].push(i));
+    }
+  }
+};
+
+TEST_VM_F(TaskQueueStealTest, single_steal) {
+  fill(1, 10);
+
+  int t;
+  ASSERT_TRUE(_set.steal(0, t));
+  EXPECT_EQ(0, t);
+  EXPECT_EQ(0u, _queues[0].size());
+  EXPECT_EQ(9u, _queues[1].size());
+}
+
+TEST_VM_F(TaskQueueStealTest, batched_steal) {
+  _set.set_steal_policy(true /* batched */, false /* numa_local */);
+  fill(1, 10);
+
+  // Half of the victim's tasks are taken; one is returned and the rest
+  // land in the thief's queue, oldest first.
+  int t;
+  ASSERT_TRUE(_set.steal(0, t));
+  EXPECT_EQ(0, t);
+  EXPECT_EQ(4u, _queues[0].size());
+  EXPECT_EQ(5u, _queues[1].size());
+
+  int expected = 4;
+  while (_queues[0].pop_local(t)) {
+    EXPECT_EQ(expected--, t);
+  }
+  EXPECT_EQ(0, expected);
+}
+
+TEST_VM_F(TaskQueueStealTest, batched_steal_single_element) {
+  _set.set_steal_policy(true /* batched */, false /* numa_local */);
+  fill(2, 1);
+
+  int t;
+  ASSERT_TRUE(_set.steal(0, t));
+  EXPECT_EQ(0, t);
+  EXPECT_EQ(0u, _queues[0].size());
+  EXPECT_EQ(0u, _queues[2].size());
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/taskqueue.inline.hpp"
+#include "gc/shared/workerThread.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ostream.hpp"
+#include "utilities/ticks.hpp"
+
+#include "unittest.hpp"
+
+// This "test" doesn't really verify much.  Rather, it's mostly a
+// microbenchmark for GenericTaskQueue push/pop and stealing.  Each worker
+// owns a queue, and all work starts out in the queue of worker 0.
+// Processing a task of depth d > 0 pushes two tasks of depth d - 1, so the
+// total amount of work is fixed and the other workers only get work by
+// stealing.  Results are printed with one line per thread count in the
+// form
+//
+//   taskqueue_parperf threads=<n> tasks=<n> ns=<n> ops_per_s=<n> steals=<n>
+//
+// so that runs can be compared by scripts.
+
+typedef GenericTaskQueue<uint, mtGC> PerfTaskQueue;
+typedef GenericTaskQueueSet<PerfTaskQueue, mtGC> PerfTaskQueueSet;
+
+const uint _perf_max_workers = 16;
+const uint _perf_roots = 64;
+const uint _perf_depth = 14;
+
+class TaskQueueParPerf : public ::testing::Test {
+  PerfTaskQueueSet _set;
+  PerfTaskQueue _queues[_perf_max_workers];
+  uint _num_workers;
+
+  static WorkerThreads* _workers;
+
+public:
+  class Task;
+
+  TaskQueueParPerf() :
+    _set(_perf_max_workers),
+    _num_workers(MIN2(_perf_max_workers, (uint)os::processor_count()))
+  {
+    for (uint i = 0; i < _perf_max_workers; ++i) {
+      _set.register_queue(i, &_queues[i]);
+    }
+  }
+
+  WorkerThreads* workers() const {
+    if (_workers == nullptr) {
+      WorkerThreads* wg = new WorkerThreads("TaskQueueParPerf workers", _perf_max_workers);
+      wg->initialize_workers();
+      _workers = wg;
+    }
+    return _workers;
+  }
+
+  void run_test(uint nthreads);
+};
+
+WorkerThreads* TaskQueueParPerf::_workers = nullptr;
+
+class TaskQueueParPerf::Task : public WorkerTask {
+  PerfTaskQueueSet* _set;
+  volatile size_t _remaining;
+  volatile size_t _steals;
+
+  void process(PerfTaskQueue* queue, uint depth) {
+    if (depth > 0) {
+      guarantee(queue->push(depth - 1), "queue overflow");
+      guarantee(queue->push(depth - 1), "queue overflow");
+    }
+    Atomic::dec(&_remaining);
+  }
+
+public:
+  Task(PerfTaskQueueSet* set, size_t total) :
+    WorkerTask("TaskQueueParPerf::Task"),
+    _set(set),
+    _remaining(total),
+    _steals(0)
+  {}
+
+  virtual void work(uint worker_id) {
+    PerfTaskQueue* queue = _set->queue(worker_id);
+    size_t steals = 0;
+    uint t;
+    while (Atomic::load_acquire(&_remaining) > 0) {
+      while (queue->pop_local(t)) {
+        process(queue, t);
+      }
+      if (_set->steal(worker_id, t)) {
+        steals++;
+        process(queue, t);
+      }
+    }
+    Atomic::add(&_steals, steals);
+  }
+
+  size_t steals() const { return _steals; }
+};
+
+void TaskQueueParPerf::run_test(uint nthreads) {
+  if (nthreads > _num_workers) {
+    return;
+  }
+  // Each root expands to a full binary tree of tasks.
+  const size_t total = (size_t)_perf_roots * ((size_t(1) << (_perf_depth + 1)) - 1);
+  for (uint i = 0; i < _perf_roots; ++i) {
+    ASSERT_TRUE(_queues[0].push(_perf_depth));
+  }
+  Task task(&_set, total);
+  Ticks start_time = Ticks::now();
+  workers()->run_task(&task, nthreads);
+  Tickspan duration = Ticks::now() - start_time;
+
+  for (uint i = 0; i < _perf_max_workers; ++i) {
+    ASSERT_TRUE(_queues[i].is_empty());
+  }
+  jlong ns = (jlong)duration.nanoseconds();
+  tty->print_cr("taskqueue_parperf threads=%u tasks=" SIZE_FORMAT " ns=" JLONG_FORMAT
+                " ops_per_s=" JLONG_FORMAT " steals=" SIZE_FORMAT,
+                nthreads, total, ns,
+                ns > 0 ? (jlong)(total * (double)NANOSECS_PER_SEC / ns) : (jlong)0,
+                task.steals());
+}
+
+TEST_VM_F(TaskQueueParPerf, test) {
+  run_test(1);
+  run_test(2);
+  run_test(4);
+  run_test(8);
+  run_test(12);
+  run_test(16);
+}
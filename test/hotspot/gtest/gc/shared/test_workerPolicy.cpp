@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/gc_globals.hpp"
+#include "gc/shared/workerDataArray.inline.hpp"
+#include "gc/shared/workerPolicy.hpp"
+#include "runtime/flags/flagSetting.hpp"
+#include "runtime/globals_extension.hpp"
+#include "unittest.hpp"
+
+static const uint NumWorkers = 8;
+
+class WorkerEfficiencyTrackerTest : public ::testing::Test {
+ protected:
+  WorkerDataArray<double> _times;
+  WorkerDataArray<double> _idle;
+
+  WorkerEfficiencyTrackerTest() :
+    _times(nullptr, "Times", NumWorkers),
+    _idle(nullptr, "Idle", NumWorkers) { }
+};
+
+TEST_VM_F(WorkerEfficiencyTrackerTest, disabled) {
+  AutoSaveRestore<bool> FLAG_GUARD(UseAdaptiveGCWorkerSizing);
+  FLAG_SET_ERGO(UseAdaptiveGCWorkerSizing, false);
+
+  WorkerEfficiencyTracker tracker;
+  _times.set(0, 0.010);
+  for (uint i = 1; i < NumWorkers; i++) {
+    _times.set(i, 0.001);
+  }
+  tracker.record(NumWorkers, &_times);
+  EXPECT_EQ(NumWorkers, tracker.adjust(NumWorkers, "Test"));
+}
+
+TEST_VM_F(WorkerEfficiencyTrackerTest, no_samples) {
+  AutoSaveRestore<bool> FLAG_GUARD(UseAdaptiveGCWorkerSizing);
+  FLAG_SET_ERGO(UseAdaptiveGCWorkerSizing, true);
+
+  WorkerEfficiencyTracker tracker;
+  EXPECT_EQ(NumWorkers, tracker.adjust(NumWorkers, "Test"));
+
+  // A single worker does not tell anything about scaling.
+  _times.set(0, 0.010);
+  tracker.record(1, &_times);
+  EXPECT_EQ(NumWorkers, tracker.adjust(NumWorkers, "Test"));
+}
+
+TEST_VM_F(WorkerEfficiencyTrackerTest, poor_scaling) {
+  AutoSaveRestore<bool> FLAG_GUARD(UseAdaptiveGCWorkerSizing);
+  AutoSaveRestore<uint> FLAG_GUARD(GCWorkerEfficiencyTarget);
+  FLAG_SET_ERGO(UseAdaptiveGCWorkerSizing, true);
+  FLAG_SET_ERGO(GCWorkerEfficiencyTarget, 50u);
+
+  // One worker does most of the work: parallelism is (10 + 7) / 10 = 1.7.
+  WorkerEfficiencyTracker tracker;
+  _times.set(0, 0.010);
+  for (uint i = 1; i < NumWorkers; i++) {
+    _times.set(i, 0.001);
+  }
+  tracker.record(NumWorkers, &_times);
+  EXPECT_EQ(4u, tracker.adjust(NumWorkers, "Test"));
+  EXPECT_EQ(2u, tracker.adjust(2, "Test"));
+}
+
+TEST_VM_F(WorkerEfficiencyTrackerTest, good_scaling) {
+  AutoSaveRestore<bool> FLAG_GUARD(UseAdaptiveGCWorkerSizing);
+  AutoSaveRestore<uint> FLAG_GUARD(GCWorkerEfficiencyTarget);
+  FLAG_SET_ERGO(UseAdaptiveGCWorkerSizing, true);
+  FLAG_SET_ERGO(GCWorkerEfficiencyTarget, 50u);
+
+  // Four perfectly balanced workers may grow to eight.
+  WorkerEfficiencyTracker tracker;
+  for (uint i = 0; i < 4; i++) {
+    _times.set(i, 0.005);
+  }
+  tracker.record(4, &_times);
+  EXPECT_EQ(NumWorkers, tracker.adjust(NumWorkers, "Test"));
+  EXPECT_EQ(NumWorkers, tracker.adjust(2 * NumWorkers, "Test"));
+}
+
+TEST_VM_F(WorkerEfficiencyTrackerTest, idle_time) {
+  AutoSaveRestore<bool> FLAG_GUARD(UseAdaptiveGCWorkerSizing);
+  AutoSaveRestore<uint> FLAG_GUARD(GCWorkerEfficiencyTarget);
+  FLAG_SET_ERGO(UseAdaptiveGCWorkerSizing, true);
+  FLAG_SET_ERGO(GCWorkerEfficiencyTarget, 50u);
+
+  // All workers take as long, but three of them mostly wait for work:
+  // parallelism is (10 + 3 * 2) / 10 = 1.6.
+  WorkerEfficiencyTracker tracker;
+  _times.set(0, 0.010);
+  for (uint i = 1; i < 4; i++) {
+    _times.set(i, 0.010);
+    _idle.set(i, 0.008);
+  }
+  tracker.record(4, &_times, &_idle);
+  EXPECT_EQ(4u, tracker.adjust(NumWorkers, "Test"));
+}
@@ -106,3 +106,26 @@ TEST_F(ZBitMapTest, test_set_pair_unset) {
   test_set_pair_unset(false);
   test_set_pair_unset(true);
 }
+
+TEST(ZMovableBitMapTest, test_par_set_word_bits) {
+  ZMovableBitMap bitmap;
+  bitmap.initialize(2 * BitsPerWord, true /* clear */);
+
+  // Set a few bits in the second word, with one pre-set bit
+  bitmap.set_bit(BitsPerWord + 1);
+  const BitMap::bm_word_t mask = ((BitMap::bm_word_t)1 << 1) |
+                                 ((BitMap::bm_word_t)1 << 5) |
+                                 ((BitMap::bm_word_t)1 << (BitsPerWord - 1));
+  bitmap.par_set_word_bits(BitsPerWord + 3, mask);
+
+  for (BitMap::idx_t i = 0; i < 2 * BitsPerWord; i++) {
+    const bool expected = i == BitsPerWord + 1 ||
+                          i == BitsPerWord + 5 ||
+                          i == 2 * BitsPerWord - 1;
+    EXPECT_EQ(bitmap.at(i), expected) << "Bit " << i;
+  }
+
+  // Setting already set bits is a no-op
+  bitmap.par_set_word_bits(BitsPerWord, mask);
+  EXPECT_EQ(bitmap.count_one_bits(), (BitMap::idx_t)3);
+}
@@ -244,7 +244,8 @@ TEST_VM_F(AsyncLogTest, logBuffer) {
 }
 
 TEST_VM_F(AsyncLogTest, droppingMessage) {
-  if (AsyncLogWriter::instance() == nullptr) {
+  if (AsyncLogWriter::instance() == nullptr ||
+      LogConfiguration::async_mode() != LogConfiguration::AsyncMode::Drop) {
     return;
   }
 
@@ -253,6 +254,21 @@ TEST_VM_F(AsyncLogTest, droppingMessage) {
   EXPECT_TRUE(file_contains_substring(TestLogFileName, "messages dropped due to async logging"));
 }
 
+TEST_VM_F(AsyncLogTest, parseAsyncArgument) {
+  const LogConfiguration::AsyncMode saved = LogConfiguration::async_mode();
+
+  EXPECT_TRUE(LogConfiguration::parse_async_argument(""));
+  EXPECT_EQ(LogConfiguration::AsyncMode::Drop, LogConfiguration::async_mode());
+  EXPECT_TRUE(LogConfiguration::parse_async_argument(":stall"));
+  EXPECT_EQ(LogConfiguration::AsyncMode::Stall, LogConfiguration::async_mode());
+  EXPECT_TRUE(LogConfiguration::parse_async_argument(":drop"));
+  EXPECT_EQ(LogConfiguration::AsyncMode::Drop, LogConfiguration::async_mode());
+  EXPECT_FALSE(LogConfiguration::parse_async_argument(":block"));
+  EXPECT_FALSE(LogConfiguration::parse_async_argument("stall"));
+
+  LogConfiguration::set_async_mode(saved);
+}
+
 TEST_VM_F(AsyncLogTest, stdoutOutput) {
   testing::internal::CaptureStdout();
 
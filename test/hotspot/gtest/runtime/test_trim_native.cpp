@@ -49,14 +49,20 @@ static int check_trim_state() {
     uint64_t num_trims = 0;
     int suspend_count = 0;
     int stopped = 0;
-    EXPECT_EQ(::sscanf(s, "Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d",
-                       &num_trims, &suspend_count, &stopped), 3);
+    uint64_t num_skipped = 0;
+    EXPECT_EQ(::sscanf(s, "Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d, skipped: " UINT64_FORMAT,
+                       &num_trims, &suspend_count, &stopped, &num_skipped), 4);
 
-    // Number of trims we can reasonably expect should be limited
+    // Number of trims we can reasonably expect should be limited, skipped ones included
     const double fudge_factor = 1.5;
     const uint64_t elapsed_ms = (uint64_t)(os::elapsedTime() * fudge_factor * 1000.0);
     const uint64_t max_num_trims = (elapsed_ms / TrimNativeHeapInterval) + 1;
-    EXPECT_LE(num_trims, max_num_trims);
+    EXPECT_LE(num_trims + num_skipped, max_num_trims);
+
+    // Trims are only ever skipped if a minimum free size is given
+    if (TrimNativeHeapMinFreeBytes == 0) {
+      EXPECT_EQ(num_skipped, (uint64_t)0);
+    }
 
     // We should not be stopped
     EXPECT_EQ(stopped, 0);
@@ -99,3 +105,30 @@ TEST_VM(os, TrimNative) {
   EXPECT_GT(c2, c1);
   EXPECT_GT(c3, c2);
 }
+
+TEST_VM(os, trimmable_native_heap_size) {
+
+  if (!os::can_trim_native_heap()) {
+    // Platforms that cannot trim do not know either
+    EXPECT_EQ(os::trimmable_native_heap_size(), SIZE_MAX);
+    return;
+  }
+
+  // Free 1M worth of small blocks; most of that should then be reported as
+  // trimmable free space, unless the mallinfo counters wrapped. Concurrent
+  // allocations may reuse some of it, so only check a lower bound.
+  const int num_blocks = 1024;
+  const size_t block_size = 1 * K;
+  void* blocks[num_blocks];
+  for (int i = 0; i < num_blocks; i++) {
+    blocks[i] = os::malloc(block_size, mtTest);
+    ASSERT_NOT_NULL(blocks[i]);
+  }
+  for (int i = 0; i < num_blocks; i++) {
+    os::free(blocks[i]);
+  }
+  const size_t trimmable = os::trimmable_native_heap_size();
+  if (trimmable != SIZE_MAX) {
+    EXPECT_GE(trimmable, (size_t)(num_blocks * block_size) / 4);
+  }
+}
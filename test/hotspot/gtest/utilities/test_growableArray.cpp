@@ -690,3 +690,42 @@ TEST(GrowableArrayCHeap, returning_references_works_as_expected) {
   EXPECT_EQ(5, first);
   EXPECT_EQ(5, last);
 }
+
+TEST_VM(GrowableArrayInline, resource_area) {
+  ResourceMark rm;
+  GrowableArrayInline<int, 4> a;
+  ASSERT_TRUE(a.is_inline());
+  ASSERT_EQ(a.capacity(), 4);
+
+  for (int i = 0; i < 4; i++) {
+    a.append(i);
+  }
+  ASSERT_TRUE(a.is_inline());
+  ASSERT_EQ(a.length(), 4);
+
+  a.append(4);
+  ASSERT_FALSE(a.is_inline());
+  ASSERT_GT(a.capacity(), 4);
+  for (int i = 0; i < 5; i++) {
+    ASSERT_EQ(a.at(i), i);
+  }
+}
+
+TEST_VM(GrowableArrayInline, arena) {
+  Arena arena(mtTest);
+  const size_t used = arena.used();
+  GrowableArrayInline<int, 2> a(&arena);
+  ASSERT_TRUE(a.is_inline());
+
+  a.append(1);
+  a.append(2);
+  ASSERT_TRUE(a.is_inline());
+  ASSERT_EQ(arena.used(), used);
+
+  a.append(3);
+  ASSERT_FALSE(a.is_inline());
+  ASSERT_GT(arena.used(), used);
+  ASSERT_EQ(a.at(0), 1);
+  ASSERT_EQ(a.at(1), 2);
+  ASSERT_EQ(a.at(2), 3);
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.arraycopy;
+
+/*
+ * @test
+ * @summary Check disjoint arraycopy results just below, at and above
+ *          AVX3NonTemporalCopyThreshold, where the AVX-512 stub switches
+ *          to its non-temporal store loop.
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ * @requires vm.compiler2.enabled & vm.cpu.features ~= ".*avx512f.*"
+ * @run main/othervm -Xbatch -XX:MaxVectorSize=64 -XX:AVX3Threshold=0
+ *                   -XX:+UnlockExperimentalVMOptions -XX:AVX3NonTemporalCopyThreshold=4096
+ *                   compiler.arraycopy.TestAVX3NonTemporalCopyThreshold 4096
+ * @run main/othervm -Xbatch -XX:MaxVectorSize=64 -XX:AVX3Threshold=0
+ *                   -XX:+UnlockExperimentalVMOptions -XX:AVX3NonTemporalCopyThreshold=65536
+ *                   compiler.arraycopy.TestAVX3NonTemporalCopyThreshold 65536
+ * @run main/othervm -Xbatch -XX:MaxVectorSize=64 -XX:AVX3Threshold=0
+ *                   compiler.arraycopy.TestAVX3NonTemporalCopyThreshold 2621440
+ */
+
+public class TestAVX3NonTemporalCopyThreshold {
+
+    static void copyBytes(byte[] src, int srcPos, byte[] dst, int dstPos, int len) {
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+    }
+
+    static void copyInts(int[] src, int srcPos, int[] dst, int dstPos, int len) {
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+    }
+
+    static void copyLongs(long[] src, int srcPos, long[] dst, int dstPos, int len) {
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+    }
+
+    public static void main(String[] args) {
+        int threshold = Integer.parseInt(args[0]);
+
+        // Get the copy methods compiled, so that they call the stubs
+        byte[] bs = new byte[256];
+        int[] is = new int[64];
+        long[] ls = new long[32];
+        for (int i = 0; i < 20_000; i++) {
+            copyBytes(bs, 0, new byte[256], 0, bs.length);
+            copyInts(is, 0, new int[64], 0, is.length);
+            copyLongs(ls, 0, new long[32], 0, ls.length);
+        }
+
+        int[] deltas = { -129, -64, -1, 0, 1, 63, 64, 4097 };
+        int[] offsets = { 0, 1, 7, 31 };
+        for (int delta : deltas) {
+            int bytes = threshold + delta;
+            for (int srcOff : offsets) {
+                for (int dstOff : offsets) {
+                    testBytes(bytes, srcOff, dstOff);
+                    testInts(bytes / Integer.BYTES, srcOff, dstOff);
+                    testLongs(bytes / Long.BYTES, srcOff, dstOff);
+                }
+            }
+        }
+    }
+
+    static void testBytes(int len, int srcOff, int dstOff) {
+        byte[] src = new byte[len + srcOff];
+        byte[] dst = new byte[len + dstOff + 1];
+        for (int i = 0; i < src.length; i++) {
+            src[i] = (byte)(i * 31 + 7);
+        }
+        dst[dst.length - 1] = (byte)0x5a;
+        copyBytes(src, srcOff, dst, dstOff, len);
+        for (int i = 0; i < dstOff; i++) {
+            check(dst[i] == 0, "byte", len, srcOff, dstOff, i);
+        }
+        for (int i = 0; i < len; i++) {
+            check(dst[dstOff + i] == src[srcOff + i], "byte", len, srcOff, dstOff, dstOff + i);
+        }
+        check(dst[dst.length - 1] == (byte)0x5a, "byte", len, srcOff, dstOff, dst.length - 1);
+    }
+
+    static void testInts(int len, int srcOff, int dstOff) {
+        int[] src = new int[len + srcOff];
+        int[] dst = new int[len + dstOff + 1];
+        for (int i = 0; i < src.length; i++) {
+            src[i] = i * 0x9E3779B1;
+        }
+        dst[dst.length - 1] = 0x5a5a5a5a;
+        copyInts(src, srcOff, dst, dstOff, len);
+        for (int i = 0; i < dstOff; i++) {
+            check(dst[i] == 0, "int", len, srcOff, dstOff, i);
+        }
+        for (int i = 0; i < len; i++) {
+            check(dst[dstOff + i] == src[srcOff + i], "int", len, srcOff, dstOff, dstOff + i);
+        }
+        check(dst[dst.length - 1] == 0x5a5a5a5a, "int", len, srcOff, dstOff, dst.length - 1);
+    }
+
+    static void testLongs(int len, int srcOff, int dstOff) {
+        long[] src = new long[len + srcOff];
+        long[] dst = new long[len + dstOff + 1];
+        for (int i = 0; i < src.length; i++) {
+            src[i] = i * 0x9E3779B97F4A7C15L;
+        }
+        dst[dst.length - 1] = 0x5a5a5a5a5a5a5a5aL;
+        copyLongs(src, srcOff, dst, dstOff, len);
+        for (int i = 0; i < dstOff; i++) {
+            check(dst[i] == 0, "long", len, srcOff, dstOff, i);
+        }
+        for (int i = 0; i < len; i++) {
+            check(dst[dstOff + i] == src[srcOff + i], "long", len, srcOff, dstOff, dstOff + i);
+        }
+        check(dst[dst.length - 1] == 0x5a5a5a5a5a5a5a5aL, "long", len, srcOff, dstOff, dst.length - 1);
+    }
+
+    static void check(boolean ok, String type, int len, int srcOff, int dstOff, int index) {
+        if (!ok) {
+            throw new RuntimeException("Wrong " + type + " at index " + index + " after copying " + len +
+                                       " elements from offset " + srcOff + " to offset " + dstOff);
+        }
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c1;
+
+/*
+ * @test
+ * @summary Check that C1 code compiled with loop-depth weighted spill
+ *          decisions computes the same results under high register pressure.
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=3
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+LinearScanLoopSpillCost
+ *                   compiler.c1.TestLinearScanLoopSpillCost
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+LinearScanLoopSpillCost
+ *                   compiler.c1.TestLinearScanLoopSpillCost
+ */
+
+public class TestLinearScanLoopSpillCost {
+    // Many values live across the inner loop force spilling on every platform.
+    static long test(int[] a, int n) {
+        long v0 = 1, v1 = 2, v2 = 3, v3 = 4, v4 = 5, v5 = 6, v6 = 7, v7 = 8;
+        long v8 = 9, v9 = 10, v10 = 11, v11 = 12, v12 = 13, v13 = 14, v14 = 15;
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < a.length; j++) {
+                v0 += a[j];
+                v1 ^= v0 + j;
+            }
+            v2 += v1 * i;  v3 += v2 ^ v0;  v4 += v3 - v1;  v5 += v4 * 3;
+            v6 += v5 ^ v2; v7 += v6 + v3;  v8 += v7 - v4;  v9 += v8 * 5;
+            v10 += v9 ^ v5; v11 += v10 + v6; v12 += v11 - v7; v13 += v12 * 7;
+            v14 += v13 ^ v8;
+        }
+        return v0 + v1 + v2 + v3 + v4 + v5 + v6 + v7 + v8 + v9 + v10 + v11 + v12 + v13 + v14;
+    }
+
+    static long reference(int[] a, int n) {
+        long v0 = 1, v1 = 2, v2 = 3, v3 = 4, v4 = 5, v5 = 6, v6 = 7, v7 = 8;
+        long v8 = 9, v9 = 10, v10 = 11, v11 = 12, v12 = 13, v13 = 14, v14 = 15;
+        long[] v = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14 };
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < a.length; j++) {
+                v[0] += a[j];
+                v[1] ^= v[0] + j;
+            }
+            v[2] += v[1] * i;  v[3] += v[2] ^ v[0];  v[4] += v[3] - v[1];  v[5] += v[4] * 3;
+            v[6] += v[5] ^ v[2]; v[7] += v[6] + v[3];  v[8] += v[7] - v[4];  v[9] += v[8] * 5;
+            v[10] += v[9] ^ v[5]; v[11] += v[10] + v[6]; v[12] += v[11] - v[7]; v[13] += v[12] * 7;
+            v[14] += v[13] ^ v[8];
+        }
+        long sum = 0;
+        for (long x : v) {
+            sum += x;
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[100];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = i * 31 + 7;
+        }
+        long expected = reference(a, 50);
+        for (int i = 0; i < 20_000; i++) {
+            long res = test(a, 50);
+            if (res != expected) {
+                throw new RuntimeException("expected " + expected + ", got " + res);
+            }
+        }
+    }
+}
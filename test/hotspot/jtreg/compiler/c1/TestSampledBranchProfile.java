@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c1;
+
+/*
+ * @test
+ * @summary Check that tier 3 code with sampled branch profiling keeps
+ *          branch semantics for all compare kinds.
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=3
+ *                   -XX:+UnlockExperimentalVMOptions -XX:C1BranchProfileSampleRate=7
+ *                   compiler.c1.TestSampledBranchProfile
+ * @run main/othervm -Xbatch
+ *                   -XX:+UnlockExperimentalVMOptions -XX:C1BranchProfileSampleRate=64
+ *                   compiler.c1.TestSampledBranchProfile
+ */
+
+public class TestSampledBranchProfile {
+    static int test(int i, long l, float f, double d, Object o) {
+        int res = 0;
+        if (i > 10)          res += 1;
+        if (l < 1000L)       res += 2;
+        if (l == 0L)         res += 4;
+        if (f >= 0.5f)       res += 8;
+        if (d != 2.0)        res += 16;
+        if (o == null)       res += 32;
+        return res;
+    }
+
+    static int reference(int i, long l, float f, double d, Object o) {
+        return (i > 10 ? 1 : 0) + (l < 1000L ? 2 : 0) + (l == 0L ? 4 : 0) +
+               (f >= 0.5f ? 8 : 0) + (d != 2.0 ? 16 : 0) + (o == null ? 32 : 0);
+    }
+
+    public static void main(String[] args) {
+        Object obj = new Object();
+        for (int iter = 0; iter < 50_000; iter++) {
+            int i = iter % 21;
+            long l = (iter % 3 == 0) ? 0L : (long)iter * 7;
+            float f = (iter % 4) / 4.0f;
+            double d = (iter % 5 == 0) ? 2.0 : Double.NaN;
+            Object o = (iter % 2 == 0) ? null : obj;
+            int expected = reference(i, l, f, d, o);
+            int res = test(i, l, f, d, o);
+            if (res != expected) {
+                throw new RuntimeException("iteration " + iter + ": expected " + expected + ", got " + res);
+            }
+        }
+    }
+}
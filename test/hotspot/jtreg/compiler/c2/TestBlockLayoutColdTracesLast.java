@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=default
+ * @summary Check that code laid out with BlockLayoutColdTracesLast computes
+ *          the same results, with cold exception, trap and call paths.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+BlockLayoutColdTracesLast
+ *                   -XX:CompileCommand=quiet -XX:CompileCommand=exclude,*::reference
+ *                   compiler.c2.TestBlockLayoutColdTracesLast
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+BlockLayoutColdTracesLast
+ *                   -XX:CompileCommand=quiet -XX:CompileCommand=exclude,*::reference
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+StressGCM -XX:+StressLCM
+ *                   compiler.c2.TestBlockLayoutColdTracesLast
+ */
+
+/*
+ * @test id=debug
+ * @requires vm.compiler2.enabled & vm.debug
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+BlockLayoutColdTracesLast
+ *                   -XX:CompileCommand=quiet -XX:CompileCommand=exclude,*::reference
+ *                   -XX:+VerifyOops -XX:+VerifyLoopOptimizations
+ *                   compiler.c2.TestBlockLayoutColdTracesLast
+ */
+
+package compiler.c2;
+
+public class TestBlockLayoutColdTracesLast {
+    static final int ITERATIONS = 20_000;
+
+    static Object[] objects = { "a", 1, null, 2L, new int[3] };
+
+    // Rarely taken branches become uncommon traps, slow calls and
+    // exception handlers, the blocks that are laid out last.
+    static int test(int[] a, int i) {
+        int s = 0;
+        for (int j = 0; j < a.length; j++) {
+            s += a[j] * i;
+            if (a[j] == 1000) {
+                s += cold(j);
+            }
+        }
+        try {
+            Object o = objects[i % objects.length];
+            if (i % 997 == 0) {
+                s += o.hashCode();
+            } else if (o instanceof Integer n) {
+                s += n;
+            }
+        } catch (NullPointerException e) {
+            s ^= 0x5555;
+        }
+        try {
+            s += a[i % (a.length + 1)];
+        } catch (ArrayIndexOutOfBoundsException e) {
+            s -= 7;
+        }
+        return s;
+    }
+
+    // Same as test(), but never compiled.
+    static int reference(int[] a, int i) {
+        int s = 0;
+        for (int j = 0; j < a.length; j++) {
+            s += a[j] * i;
+            if (a[j] == 1000) {
+                s += cold(j);
+            }
+        }
+        try {
+            Object o = objects[i % objects.length];
+            if (i % 997 == 0) {
+                s += o.hashCode();
+            } else if (o instanceof Integer n) {
+                s += n;
+            }
+        } catch (NullPointerException e) {
+            s ^= 0x5555;
+        }
+        try {
+            s += a[i % (a.length + 1)];
+        } catch (ArrayIndexOutOfBoundsException e) {
+            s -= 7;
+        }
+        return s;
+    }
+
+    static int cold(int j) {
+        return Integer.toString(j).length();
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[100];
+        for (int i = 0; i < a.length; i++) {
+            a[i] = i * 37 % 1013;
+        }
+        int[] expected = new int[ITERATIONS];
+        for (int i = 0; i < ITERATIONS; i++) {
+            expected[i] = reference(a, i);
+        }
+        for (int k = 0; k < 4; k++) {
+            for (int i = 0; i < ITERATIONS; i++) {
+                int r = test(a, i);
+                if (r != expected[i]) {
+                    throw new RuntimeException("test(" + i + ") = " + r + ", expected " + expected[i]);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c2;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+/*
+ * @test
+ * @summary Check that HotMethodsFile lists methods compiled by C2 and can be
+ *          read back with CompileCommandFile.
+ * @library /test/lib
+ * @requires vm.flagless & vm.compiler2.enabled
+ * @run driver compiler.c2.TestHotMethodsFile
+ */
+
+public class TestHotMethodsFile {
+    public static void main(String[] args) throws Exception {
+        Path file = Path.of("hot_methods.txt");
+
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbatch",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:HotMethodsFile=" + file,
+            Test.class.getName());
+        output.shouldHaveExitValue(0);
+
+        List<String> lines = Files.readAllLines(file);
+        if (!lines.get(0).equals("quiet")) {
+            throw new RuntimeException("missing quiet command: " + lines.get(0));
+        }
+        String expected = "CompileThresholdScaling," + Test.class.getName().replace('.', '/') + ".hot(I)I,";
+        if (lines.stream().noneMatch(l -> l.startsWith(expected))) {
+            throw new RuntimeException("hot method not listed in " + lines);
+        }
+
+        output = ProcessTools.executeLimitedTestJava(
+            "-Xbatch",
+            "-XX:CompileCommandFile=" + file,
+            Test.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("CompileCommand: An error occurred during parsing");
+    }
+
+    static class Test {
+        static int hot(int x) {
+            return x * 31 + 7;
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 100_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println(sum);
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that FreqInlineSize and LoopUnrollLimit given as per-method
+ *          compile commands reach C2.
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.c2.TestInliningDirectiveLimits
+ */
+
+package compiler.c2;
+
+import jdk.test.lib.Platform;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestInliningDirectiveLimits {
+
+    public static void main(String[] args) throws Exception {
+        String caller = Test.class.getName() + "::caller";
+
+        // The hot, 140 byte callee is inlined with the default limits.
+        OutputAnalyzer output = run();
+        output.shouldMatch("::callee \\(\\d+ bytes\\).*inline \\(hot\\)");
+
+        // Lowering FreqInlineSize for the caller alone rejects it.
+        output = run("-XX:CompileCommand=FreqInlineSize," + caller + ",50");
+        output.shouldMatch("::callee \\(\\d+ bytes\\).*hot method too big");
+
+        // TraceLoopOpts is only available in debug builds. SuperWord is off,
+        // since its unrolling analysis may raise the limit for the loop.
+        if (Platform.isDebugBuild()) {
+            String loop = Test.class.getName() + "::loop";
+            output = run("-XX:+TraceLoopOpts", "-XX:-UseSuperWord");
+            output.shouldContain("Unroll ");
+
+            output = run("-XX:+TraceLoopOpts", "-XX:-UseSuperWord",
+                         "-XX:CompileCommand=LoopUnrollLimit," + loop + ",0");
+            output.shouldNotContain("Unroll ");
+
+            // A limit of 0 also disables unrolling of vectorizable loops,
+            // whose limit SuperWord's unrolling analysis would otherwise raise.
+            String add = Test.class.getName() + "::add";
+            output = run("-XX:+TraceLoopOpts", "-XX:+UseSuperWord",
+                         "-XX:CompileCommand=LoopUnrollLimit," + loop + ",0",
+                         "-XX:CompileCommand=LoopUnrollLimit," + add + ",0");
+            output.shouldNotContain("Unroll ");
+        }
+    }
+
+    static OutputAnalyzer run(String... commands) throws Exception {
+        String[] args = new String[commands.length + 9];
+        int i = 0;
+        args[i++] = "-XX:-TieredCompilation";
+        args[i++] = "-Xbatch";
+        args[i++] = "-XX:+UnlockDiagnosticVMOptions";
+        args[i++] = "-XX:CompileCommand=quiet";
+        args[i++] = "-XX:CompileCommand=PrintInlining," + Test.class.getName() + "::caller";
+        args[i++] = "-XX:CompileCommand=compileonly," + Test.class.getName() + "::caller";
+        args[i++] = "-XX:CompileCommand=compileonly," + Test.class.getName() + "::loop";
+        args[i++] = "-XX:CompileCommand=compileonly," + Test.class.getName() + "::add";
+        for (String c : commands) {
+            args[i++] = c;
+        }
+        args[i++] = Test.class.getName();
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(args);
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Test {
+        static int callee(int s) {
+            s = (s * 31) ^ ((s >>> 1) + 1000);
+            s = (s * 31) ^ ((s >>> 2) + 1001);
+            s = (s * 31) ^ ((s >>> 3) + 1002);
+            s = (s * 31) ^ ((s >>> 4) + 1003);
+            s = (s * 31) ^ ((s >>> 5) + 1004);
+            s = (s * 31) ^ ((s >>> 6) + 1005);
+            s = (s * 31) ^ ((s >>> 7) + 1006);
+            s = (s * 31) ^ ((s >>> 8) + 1007);
+            s = (s * 31) ^ ((s >>> 9) + 1008);
+            s = (s * 31) ^ ((s >>> 10) + 1009);
+            return s;
+        }
+
+        static int caller(int s) {
+            return callee(s);
+        }
+
+        static int loop(int[] a) {
+            int s = 0;
+            for (int i = 0; i < a.length; i++) {
+                s += a[i];
+            }
+            return s;
+        }
+
+        static void add(int[] a, int[] b) {
+            for (int i = 0; i < a.length; i++) {
+                b[i] = a[i] + 1;
+            }
+        }
+
+        public static void main(String[] args) {
+            int s = 0;
+            int[] a = new int[1000];
+            int[] b = new int[1000];
+            for (int i = 0; i < 20_000; i++) {
+                s += caller(i);
+                s += loop(a);
+                add(a, b);
+            }
+            System.out.println(s);
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that C2 bails out of register allocation above
+ *          MaxLiveRangesForRegisterAllocation
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.c2.TestMaxLiveRangesForRegisterAllocation
+ */
+
+package compiler.c2;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestMaxLiveRangesForRegisterAllocation {
+    static final String BAILOUT = "COMPILE SKIPPED: too many live ranges for register allocation";
+
+    public static void main(String[] args) throws Exception {
+        // Without a limit the method compiles.
+        run().shouldNotContain(BAILOUT);
+
+        // Any real method has more than 10 live ranges.
+        run("-XX:MaxLiveRangesForRegisterAllocation=10").shouldContain(BAILOUT);
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] args = new String[flags.length + 6];
+        int i = 0;
+        args[i++] = "-XX:-TieredCompilation";
+        args[i++] = "-Xbatch";
+        args[i++] = "-XX:+PrintCompilation";
+        args[i++] = "-XX:CompileCommand=compileonly," + Test.class.getName() + "::test";
+        args[i++] = "-XX:+UnlockExperimentalVMOptions";
+        for (String f : flags) {
+            args[i++] = f;
+        }
+        args[i++] = Test.class.getName();
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(args);
+        output.shouldHaveExitValue(0);
+        output.shouldContain(Test.class.getName() + "::test");
+        return output;
+    }
+
+    static class Test {
+        static int test(int a, int b, int c, int d) {
+            int x = a * b + c;
+            int y = b * c + d;
+            int z = c * d + a;
+            int w = d * a + b;
+            return (x ^ y) + (z ^ w) + x * y * z * w;
+        }
+
+        public static void main(String[] args) {
+            int s = 0;
+            for (int i = 0; i < 20_000; i++) {
+                s += test(i, i + 1, i + 2, i + 3);
+            }
+            System.out.println(s);
+        }
+    }
+}
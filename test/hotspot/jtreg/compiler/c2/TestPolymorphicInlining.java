@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package compiler.c2;
+
+/*
+ * @test
+ * @summary Check that calls at a megamorphic site dispatch to the right
+ *          receiver when several profiled receivers are inlined.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions
+ *                   -XX:TypeProfileWidth=4 -XX:PolymorphicInliningLimit=4
+ *                   compiler.c2.TestPolymorphicInlining
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions
+ *                   -XX:TypeProfileWidth=8 -XX:PolymorphicInliningLimit=8
+ *                   compiler.c2.TestPolymorphicInlining
+ */
+
+public class TestPolymorphicInlining {
+    static abstract class Shape {
+        abstract int id();
+    }
+
+    static class A extends Shape { int id() { return 1; } }
+    static class B extends Shape { int id() { return 2; } }
+    static class C extends Shape { int id() { return 3; } }
+    static class D extends Shape { int id() { return 4; } }
+    static class E extends Shape { int id() { return 5; } }
+    static class F extends Shape { int id() { return 6; } }
+
+    static int sum(Shape[] shapes) {
+        int sum = 0;
+        for (Shape s : shapes) {
+            sum += s.id();
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        Shape[] profiled = { new A(), new B(), new C(), new D(), new A(), new B() };
+        for (int i = 0; i < 20_000; i++) {
+            if (sum(profiled) != 13) {
+                throw new RuntimeException("wrong result during warmup");
+            }
+        }
+        // Receivers that were never or rarely seen take the virtual call.
+        Shape[] other = { new E(), new F(), new D(), new A() };
+        for (int i = 0; i < 1_000; i++) {
+            int res = sum(other);
+            if (res != 16) {
+                throw new RuntimeException("expected 16, got " + res);
+            }
+        }
+    }
+}
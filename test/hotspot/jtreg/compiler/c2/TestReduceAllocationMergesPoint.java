@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package compiler.c2;
+
+/*
+ * @test
+ * @summary Check that merges of non-escaping allocations through a Phi
+ *          compute the same results with and without reducing the merge.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:-ReduceAllocationMerges
+ *                   compiler.c2.TestReduceAllocationMergesPoint
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:+ReduceAllocationMerges
+ *                   compiler.c2.TestReduceAllocationMergesPoint
+ */
+
+public class TestReduceAllocationMergesPoint {
+
+    static final class Point {
+        final int x;
+        final int y;
+
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    // Phi -> AddP -> Load
+    static int select(boolean cond, int a, int b) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        return p.x * 31 + p.y;
+    }
+
+    // Phi -> CmpP against null
+    static int selectOrNull(int k, int a, int b) {
+        Point p = null;
+        if (k % 3 == 0) {
+            p = new Point(a, b);
+        } else if (k % 3 == 1) {
+            p = new Point(b, a);
+        }
+        return p == null ? -1 : p.x - p.y;
+    }
+
+    // Phi -> SafePoint, the merged object must be rematerialized on deoptimization.
+    static int selectAcrossCall(boolean cond, int a, int b, int[] sink) {
+        Point p = cond ? new Point(a, b) : new Point(b, a);
+        if (sink.length == 0) {
+            throw new RuntimeException("unexpected " + p.x);
+        }
+        sink[0] = p.y;
+        return p.x;
+    }
+
+    public static void main(String[] args) {
+        int[] sink = new int[1];
+        for (int i = 0; i < 20_000; i++) {
+            boolean cond = (i & 1) == 0;
+            int a = i;
+            int b = i * 7;
+
+            int expected = cond ? a * 31 + b : b * 31 + a;
+            if (select(cond, a, b) != expected) {
+                throw new RuntimeException("select(" + i + ") = " + select(cond, a, b) + ", expected " + expected);
+            }
+
+            int k = i % 3;
+            expected = k == 0 ? a - b : (k == 1 ? b - a : -1);
+            if (selectOrNull(i, a, b) != expected) {
+                throw new RuntimeException("selectOrNull(" + i + ") = " + selectOrNull(i, a, b) + ", expected " + expected);
+            }
+
+            expected = cond ? a : b;
+            int expectedSink = cond ? b : a;
+            if (selectAcrossCall(cond, a, b, sink) != expected || sink[0] != expectedSink) {
+                throw new RuntimeException("selectAcrossCall(" + i + ") failed");
+            }
+        }
+    }
+}
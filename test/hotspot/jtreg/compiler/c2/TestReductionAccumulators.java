@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package compiler.c2;
+
+/*
+ * @test
+ * @summary Check that unordered reductions split into several vector
+ *          accumulators compute the same results as the scalar loops.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions
+ *                   -XX:SuperWordReductionAccumulators=1
+ *                   compiler.c2.TestReductionAccumulators
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions
+ *                   -XX:SuperWordReductionAccumulators=3
+ *                   compiler.c2.TestReductionAccumulators
+ * @run main/othervm -Xbatch -XX:+UnlockExperimentalVMOptions
+ *                   -XX:SuperWordReductionAccumulators=8
+ *                   compiler.c2.TestReductionAccumulators
+ */
+
+import java.util.Random;
+
+public class TestReductionAccumulators {
+    static final int N = 10_000;
+
+    static int sumInt(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static long sumLong(long[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static int mulInt(int[] a) {
+        int prod = 1;
+        for (int i = 0; i < a.length; i++) {
+            prod *= a[i];
+        }
+        return prod;
+    }
+
+    static int minInt(int[] a) {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            min = Math.min(min, a[i]);
+        }
+        return min;
+    }
+
+    static int maxInt(int[] a) {
+        int max = Integer.MIN_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            max = Math.max(max, a[i]);
+        }
+        return max;
+    }
+
+    static int xorInt(int[] a) {
+        int x = 0;
+        for (int i = 0; i < a.length; i++) {
+            x ^= a[i];
+        }
+        return x;
+    }
+
+    static void check(String name, long expected, long actual) {
+        if (expected != actual) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        int[] ints = new int[N];
+        long[] longs = new long[N];
+        int expectedSum = 0, expectedMul = 1, expectedXor = 0;
+        int expectedMin = Integer.MAX_VALUE, expectedMax = Integer.MIN_VALUE;
+        long expectedLongSum = 0;
+        for (int i = 0; i < N; i++) {
+            ints[i] = random.nextInt();
+            longs[i] = random.nextLong();
+            expectedSum += ints[i];
+            expectedMul *= (ints[i] | 1);
+            expectedXor ^= ints[i];
+            expectedMin = Math.min(expectedMin, ints[i]);
+            expectedMax = Math.max(expectedMax, ints[i]);
+            expectedLongSum += longs[i];
+        }
+        int[] odd = new int[N];
+        for (int i = 0; i < N; i++) {
+            odd[i] = ints[i] | 1;
+        }
+
+        for (int iter = 0; iter < 10_000; iter++) {
+            check("sumInt", expectedSum, sumInt(ints));
+            check("sumLong", expectedLongSum, sumLong(longs));
+            check("mulInt", expectedMul, mulInt(odd));
+            check("minInt", expectedMin, minInt(ints));
+            check("maxInt", expectedMax, maxInt(ints));
+            check("xorInt", expectedXor, xorInt(ints));
+        }
+    }
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary A method that runs out of nodes is compiled at tier 4 with
+ *          reduced optimizations when RetryCompilationOnNodeLimit is on,
+ *          and is not compilable by C2 when it is off.
+ * @requires vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver compiler.c2.TestRetryCompilationOnNodeLimit
+ */
+
+package compiler.c2;
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestRetryCompilationOnNodeLimit {
+
+    public static void main(String[] args) throws Exception {
+        run(true);
+        run(false);
+    }
+
+    static void run(boolean retry) throws Exception {
+        String callee = Test.class.getName() + "::callee";
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-Xbatch",
+            // Small enough that inlining every call site of callee runs out
+            // of nodes, while the method without inlining fits.
+            "-XX:MaxNodeLimit=2000",
+            "-XX:NodeLimitFudgeFactor=50",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=exclude," + callee,
+            "-XX:" + (retry ? "+" : "-") + "RetryCompilationOnNodeLimit",
+            Test.class.getName(),
+            Boolean.toString(retry));
+        output.shouldHaveExitValue(0);
+    }
+
+    static class Test {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        static int callee(int s) {
+            s = (s * 31) ^ ((s >>> 1) + 1000);
+            s = (s * 31) ^ ((s >>> 2) + 1001);
+            s = (s * 31) ^ ((s >>> 3) + 1002);
+            s = (s * 31) ^ ((s >>> 4) + 1003);
+            s = (s * 31) ^ ((s >>> 5) + 1004);
+            s = (s * 31) ^ ((s >>> 6) + 1005);
+            s = (s * 31) ^ ((s >>> 7) + 1006);
+            s = (s * 31) ^ ((s >>> 8) + 1007);
+            s = (s * 31) ^ ((s >>> 9) + 1008);
+            s = (s * 31) ^ ((s >>> 10) + 1009);
+            s = (s * 31) ^ ((s >>> 11) + 1010);
+            s = (s * 31) ^ ((s >>> 12) + 1011);
+            s = (s * 31) ^ ((s >>> 13) + 1012);
+            s = (s * 31) ^ ((s >>> 1) + 1013);
+            s = (s * 31) ^ ((s >>> 2) + 1014);
+            s = (s * 31) ^ ((s >>> 3) + 1015);
+            s = (s * 31) ^ ((s >>> 4) + 1016);
+            s = (s * 31) ^ ((s >>> 5) + 1017);
+            s = (s * 31) ^ ((s >>> 6) + 1018);
+            s = (s * 31) ^ ((s >>> 7) + 1019);
+            return s;
+        }
+
+        static int big(int s) {
+            s = callee(s + 0);
+            s = callee(s + 1);
+            s = callee(s + 2);
+            s = callee(s + 3);
+            s = callee(s + 4);
+            s = callee(s + 5);
+            s = callee(s + 6);
+            s = callee(s + 7);
+            s = callee(s + 8);
+            s = callee(s + 9);
+            s = callee(s + 10);
+            s = callee(s + 11);
+            s = callee(s + 12);
+            s = callee(s + 13);
+            s = callee(s + 14);
+            s = callee(s + 15);
+            s = callee(s + 16);
+            s = callee(s + 17);
+            s = callee(s + 18);
+            s = callee(s + 19);
+            s = callee(s + 20);
+            s = callee(s + 21);
+            s = callee(s + 22);
+            s = callee(s + 23);
+            s = callee(s + 24);
+            s = callee(s + 25);
+            s = callee(s + 26);
+            s = callee(s + 27);
+            s = callee(s + 28);
+            s = callee(s + 29);
+            return s;
+        }
+
+        public static void main(String[] args) throws Exception {
+            boolean retry = Boolean.parseBoolean(args[0]);
+            Method m = Test.class.getDeclaredMethod("big", int.class);
+
+            for (int i = 0; i < 20_000; i++) {
+                big(i);
+            }
+            if (WB.getMethodCompilationLevel(m) != 4) {
+                WB.enqueueMethodForCompilation(m, 4);
+            }
+
+            if (retry) {
+                if (WB.getMethodCompilationLevel(m) != 4) {
+                    throw new RuntimeException("big() not compiled at tier 4, level " +
+                                               WB.getMethodCompilationLevel(m));
+                }
+            } else {
+                if (WB.isMethodCompilable(m, 4)) {
+                    throw new RuntimeException("big() should not be compilable at tier 4");
+                }
+                if (WB.getMethodCompilationLevel(m) == 4) {
+                    throw new RuntimeException("big() should not be compiled at tier 4");
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that SuperWord only aligns the main loop vectors of loops
+ *          whose profiled trip count reaches SuperWordAlignMinTripCount.
+ * @requires vm.compiler2.enabled & vm.debug & vm.flagless
+ * @requires os.arch == "amd64" | os.arch == "x86_64" | os.arch == "aarch64"
+ * @library /test/lib
+ * @run driver compiler.c2.TestSuperWordAlignMinTripCount
+ */
+
+package compiler.c2;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSuperWordAlignMinTripCount {
+    static final String SKIPPED = "should_align_main_loop_vectors: skip";
+    static final String ALIGNED = "adjust_pre_loop_limit_to_align_main_loop_vectors:";
+
+    public static void main(String[] args) throws Exception {
+        // The short loop runs about 60 iterations, below the limit.
+        OutputAnalyzer output = run("addShort", "1000");
+        output.shouldContain(SKIPPED);
+        output.shouldNotContain(ALIGNED);
+
+        // The long loop runs 10000 iterations and is still aligned.
+        output = run("addLong", "1000");
+        output.shouldNotContain(SKIPPED);
+        output.shouldContain(ALIGNED);
+
+        // 0, the default, always aligns.
+        output = run("addShort", "0");
+        output.shouldNotContain(SKIPPED);
+        output.shouldContain(ALIGNED);
+    }
+
+    static OutputAnalyzer run(String method, String minTripCount) throws Exception {
+        String m = Test.class.getName() + "::" + method;
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:-TieredCompilation",
+            "-Xbatch",
+            "-XX:-AlignVector",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:SuperWordAlignMinTripCount=" + minTripCount,
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + m,
+            "-XX:CompileCommand=TraceAutoVectorization," + m + ",ALIGN_VECTOR",
+            Test.class.getName());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Test {
+        static void addShort(int[] a, int[] b) {
+            for (int i = 0; i < a.length; i++) {
+                b[i] = a[i] + 1;
+            }
+        }
+
+        static void addLong(int[] a, int[] b) {
+            for (int i = 0; i < a.length; i++) {
+                b[i] = a[i] + 1;
+            }
+        }
+
+        public static void main(String[] args) {
+            int[] a = new int[60];
+            int[] b = new int[60];
+            int[] c = new int[10_000];
+            int[] d = new int[10_000];
+            for (int i = 0; i < 20_000; i++) {
+                addShort(a, b);
+                if (i % 100 == 0) {
+                    addLong(c, d);
+                }
+            }
+        }
+    }
+}
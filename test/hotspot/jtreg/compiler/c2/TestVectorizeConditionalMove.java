@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package compiler.c2;
+
+/*
+ * @test
+ * @summary Check that loops with a branch in their body compute the same
+ *          results when the branch is turned into a vector blend.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-UseVectorCmov
+ *                   compiler.c2.TestVectorizeConditionalMove
+ * @run main/othervm -Xbatch -XX:+UseVectorCmov
+ *                   compiler.c2.TestVectorizeConditionalMove
+ */
+
+import java.util.Random;
+
+public class TestVectorizeConditionalMove {
+    static final int N = 1_000;
+
+    static void reluInt(int[] a, int[] b) {
+        for (int i = 0; i < a.length; i++) {
+            a[i] = b[i] > 0 ? b[i] : 0;
+        }
+    }
+
+    static void clampLong(long[] a, long[] b, long lo, long hi) {
+        for (int i = 0; i < a.length; i++) {
+            long v = b[i];
+            a[i] = v < lo ? lo : v;
+            a[i] = a[i] > hi ? hi : a[i];
+        }
+    }
+
+    static void selectFloat(float[] a, float[] b, float[] c) {
+        for (int i = 0; i < a.length; i++) {
+            a[i] = b[i] >= c[i] ? b[i] : c[i];
+        }
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        int[] ib = new int[N];
+        long[] lb = new long[N];
+        float[] fb = new float[N];
+        float[] fc = new float[N];
+        for (int i = 0; i < N; i++) {
+            ib[i] = random.nextInt();
+            lb[i] = random.nextLong();
+            fb[i] = random.nextFloat() - 0.5f;
+            fc[i] = random.nextFloat() - 0.5f;
+        }
+        fb[7] = Float.NaN;
+
+        int[] ia = new int[N];
+        long[] la = new long[N];
+        float[] fa = new float[N];
+        long lo = -(1L << 40);
+        long hi = 1L << 40;
+        for (int iter = 0; iter < 10_000; iter++) {
+            reluInt(ia, ib);
+            clampLong(la, lb, lo, hi);
+            selectFloat(fa, fb, fc);
+        }
+
+        for (int i = 0; i < N; i++) {
+            int ie = ib[i] > 0 ? ib[i] : 0;
+            long le = Math.min(Math.max(lb[i], lo), hi);
+            float fe = fb[i] >= fc[i] ? fb[i] : fc[i];
+            if (ia[i] != ie) {
+                throw new RuntimeException("reluInt[" + i + "]: expected " + ie + " but got " + ia[i]);
+            }
+            if (la[i] != le) {
+                throw new RuntimeException("clampLong[" + i + "]: expected " + le + " but got " + la[i]);
+            }
+            if (Float.floatToRawIntBits(fa[i]) != Float.floatToRawIntBits(fe)) {
+                throw new RuntimeException("selectFloat[" + i + "]: expected " + fe + " but got " + fa[i]);
+            }
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package compiler.c2;
+
+/*
+ * @test
+ * @summary Check that long indexed loops over native MemorySegments compute
+ *          the same results as the equivalent int[] loops.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch compiler.c2.TestVectorizeLongIndexedSegment
+ */
+
+import java.lang.foreign.Arena;
+import java.lang.foreign.MemorySegment;
+import java.lang.foreign.ValueLayout;
+
+public class TestVectorizeLongIndexedSegment {
+    static final int N = 1_003;
+
+    // Contiguous int elements, address = base + i * 4.
+    static void addOne(MemorySegment dst, MemorySegment src, long n) {
+        for (long i = 0; i < n; i++) {
+            int v = src.getAtIndex(ValueLayout.JAVA_INT, i);
+            dst.setAtIndex(ValueLayout.JAVA_INT, i, v + 1);
+        }
+    }
+
+    // Strided access, address = base + i * 12 + 4.
+    static void copyField(MemorySegment dst, MemorySegment src, long n) {
+        for (long i = 0; i < n; i++) {
+            int v = src.get(ValueLayout.JAVA_INT_UNALIGNED, i * 12 + 4);
+            dst.setAtIndex(ValueLayout.JAVA_INT, i, v);
+        }
+    }
+
+    public static void main(String[] args) {
+        try (Arena arena = Arena.ofConfined()) {
+            MemorySegment src = arena.allocate(N * 12L, 8);
+            MemorySegment dst = arena.allocate(N * 4L, 8);
+            for (int i = 0; i < N * 3; i++) {
+                src.setAtIndex(ValueLayout.JAVA_INT, i, i * 31);
+            }
+
+            for (int iter = 0; iter < 10_000; iter++) {
+                addOne(dst, src, N);
+            }
+            for (int i = 0; i < N; i++) {
+                int expected = i * 31 + 1;
+                int actual = dst.getAtIndex(ValueLayout.JAVA_INT, i);
+                if (actual != expected) {
+                    throw new RuntimeException("addOne[" + i + "]: expected " + expected + " but got " + actual);
+                }
+            }
+
+            for (int iter = 0; iter < 10_000; iter++) {
+                copyField(dst, src, N);
+            }
+            for (int i = 0; i < N; i++) {
+                int expected = (i * 3 + 1) * 31;
+                int actual = dst.getAtIndex(ValueLayout.JAVA_INT, i);
+                if (actual != expected) {
+                    throw new RuntimeException("copyField[" + i + "]: expected " + expected + " but got " + actual);
+                }
+            }
+        }
+    }
+}
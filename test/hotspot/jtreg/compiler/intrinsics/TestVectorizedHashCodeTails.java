@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Compare the vectorizedHashCode intrinsic against a scalar reference
+ *          for all element types, short lengths and unaligned offsets.
+ * @modules java.base/jdk.internal.util
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+UseVectorizedHashCodeIntrinsic
+ *                   compiler.intrinsics.TestVectorizedHashCodeTails
+ */
+
+package compiler.intrinsics;
+
+import java.util.Random;
+
+import jdk.internal.util.ArraysSupport;
+
+public class TestVectorizedHashCodeTails {
+    // Covers twice the widest vector (64 bytes) plus a full tail.
+    static final int MAX_LENGTH = 2 * 64 + 7;
+    static final int MAX_OFFSET = 7;
+    static final int ITERATIONS = 200;
+    static final int INITIAL = 17;
+
+    static byte[] bytes = new byte[MAX_OFFSET + MAX_LENGTH];
+    static char[] chars = new char[MAX_OFFSET + MAX_LENGTH];
+    static short[] shorts = new short[MAX_OFFSET + MAX_LENGTH];
+    static int[] ints = new int[MAX_OFFSET + MAX_LENGTH];
+
+    static int hashBoolean(int off, int len) {
+        return ArraysSupport.vectorizedHashCode(bytes, off, len, INITIAL, ArraysSupport.T_BOOLEAN);
+    }
+
+    static int hashByte(int off, int len) {
+        return ArraysSupport.vectorizedHashCode(bytes, off, len, INITIAL, ArraysSupport.T_BYTE);
+    }
+
+    static int hashChar(int off, int len) {
+        return ArraysSupport.vectorizedHashCode(chars, off, len, INITIAL, ArraysSupport.T_CHAR);
+    }
+
+    static int hashShort(int off, int len) {
+        return ArraysSupport.vectorizedHashCode(shorts, off, len, INITIAL, ArraysSupport.T_SHORT);
+    }
+
+    static int hashInt(int off, int len) {
+        return ArraysSupport.vectorizedHashCode(ints, off, len, INITIAL, ArraysSupport.T_INT);
+    }
+
+    static void check(String type, int off, int len, int actual, int expected) {
+        if (actual != expected) {
+            throw new RuntimeException(type + " offset " + off + " length " + len +
+                                       ": got " + actual + ", expected " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(42);
+        for (int i = 0; i < bytes.length; i++) {
+            // Include negative values, which are sign- or zero-extended
+            // depending on the element type.
+            bytes[i] = (byte) r.nextInt();
+            chars[i] = (char) r.nextInt();
+            shorts[i] = (short) r.nextInt();
+            ints[i] = r.nextInt();
+        }
+
+        for (int iter = 0; iter < ITERATIONS; iter++) {
+            for (int off = 0; off <= MAX_OFFSET; off++) {
+                for (int len = 0; len <= MAX_LENGTH; len++) {
+                    int hb = INITIAL, hy = INITIAL, hc = INITIAL, hs = INITIAL, hi = INITIAL;
+                    for (int k = off; k < off + len; k++) {
+                        hb = 31 * hb + Byte.toUnsignedInt(bytes[k]);
+                        hy = 31 * hy + bytes[k];
+                        hc = 31 * hc + chars[k];
+                        hs = 31 * hs + shorts[k];
+                        hi = 31 * hi + ints[k];
+                    }
+                    check("boolean", off, len, hashBoolean(off, len), hb);
+                    check("byte", off, len, hashByte(off, len), hy);
+                    check("char", off, len, hashChar(off, len), hc);
+                    check("short", off, len, hashShort(off, len), hs);
+                    check("int", off, len, hashInt(off, len), hi);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that CompilerThreadsCPUPercent and CompilerThreadQueueWaitMillis
+ *          limit the compiler threads started by UseDynamicNumberOfCompilerThreads
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @run driver compiler.startup.TestCompilerThreadLimits
+ */
+
+package compiler.startup;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCompilerThreadLimits {
+    static final String ADDED = "Added compiler thread";
+
+    public static void main(String[] args) throws Exception {
+        // -Xcomp fills the compile queues at startup, so that more than the
+        // initial thread of each compiler is started.
+        run().shouldContain(ADDED);
+
+        // 50% of 4 processors leaves room for the initial C1 and C2 threads only.
+        run("-XX:CompilerThreadsCPUPercent=50").shouldNotContain(ADDED);
+
+        // No task waits in its queue for ten minutes.
+        run("-XX:CompilerThreadQueueWaitMillis=600000").shouldNotContain(ADDED);
+    }
+
+    static OutputAnalyzer run(String... flags) throws Exception {
+        String[] args = new String[flags.length + 8];
+        int i = 0;
+        args[i++] = "-Xcomp";
+        args[i++] = "-XX:+UseDynamicNumberOfCompilerThreads";
+        args[i++] = "-XX:ActiveProcessorCount=4";
+        args[i++] = "-XX:CICompilerCount=12";
+        args[i++] = "-XX:+UnlockDiagnosticVMOptions";
+        args[i++] = "-XX:+TraceCompilerThreads";
+        args[i++] = "-XX:+UnlockExperimentalVMOptions";
+        for (String f : flags) {
+            args[i++] = f;
+        }
+        args[i++] = "-version";
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(args);
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+}
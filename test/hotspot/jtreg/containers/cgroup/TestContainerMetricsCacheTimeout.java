@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that ContainerMetricsCacheTimeout controls how long the
+ *          container active processor count is cached
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI TestContainerMetricsCacheTimeout
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+import jtreg.SkippedException;
+
+public class TestContainerMetricsCacheTimeout {
+    static final int CALLS = 100;
+    static final String CACHED = "CgroupSubsystem::active_processor_count (cached)";
+
+    public static void main(String[] args) throws Exception {
+        if (!WhiteBox.getWhiteBox().isContainerized()) {
+            throw new SkippedException("Test requires a containerized JVM");
+        }
+
+        // A timeout of ten minutes serves every query from the cache.
+        int cached = countCached(run(600_000));
+        if (cached < CALLS) {
+            throw new RuntimeException("Expected at least " + CALLS + " cached reads, got " + cached);
+        }
+
+        // A timeout of 0 re-reads cgroupfs on every query.
+        cached = countCached(run(0));
+        if (cached > CALLS / 2) {
+            throw new RuntimeException("Expected cgroupfs to be re-read, got " + cached + " cached reads");
+        }
+    }
+
+    static OutputAnalyzer run(long timeout) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:ContainerMetricsCacheTimeout=" + timeout,
+            "-Xlog:os+container=trace",
+            Query.class.getName());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static int countCached(OutputAnalyzer output) {
+        int count = 0;
+        for (String line : output.asLines()) {
+            if (line.contains(CACHED)) {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    static class Query {
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < CALLS; i++) {
+                sum += Runtime.getRuntime().availableProcessors();
+            }
+            System.out.println(sum);
+        }
+    }
+}
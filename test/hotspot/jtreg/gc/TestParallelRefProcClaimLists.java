@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc;
+
+/*
+ * @test id=Parallel
+ * @summary Check that soft, weak, final and phantom references are all
+ *          processed when workers claim the discovered lists.
+ * @requires vm.gc.Parallel
+ * @run main/othervm -XX:+UseParallelGC -XX:ParallelGCThreads=8 -XX:+ParallelRefProcEnabled
+ *                   -XX:ReferencesPerThread=2500 -XX:SoftRefLRUPolicyMSPerMB=0
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+ParallelRefProcClaimLists
+ *                   gc.TestParallelRefProcClaimLists
+ */
+
+/*
+ * @test id=G1
+ * @summary Check that soft, weak, final and phantom references are all
+ *          processed when workers claim the discovered lists.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -XX:ParallelGCThreads=8 -XX:+ParallelRefProcEnabled
+ *                   -XX:ReferencesPerThread=2500 -XX:SoftRefLRUPolicyMSPerMB=0
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+ParallelRefProcClaimLists
+ *                   gc.TestParallelRefProcClaimLists
+ */
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.SoftReference;
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class TestParallelRefProcClaimLists {
+    // With ReferencesPerThread=2500, fewer workers than discovery
+    // queues process each reference type.
+    static final int COUNT = 10_000;
+    static final long TIMEOUT_MS = 60_000;
+
+    static final AtomicInteger finalized = new AtomicInteger();
+
+    static class Finalizable {
+        @SuppressWarnings("removal")
+        protected void finalize() {
+            finalized.incrementAndGet();
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ReferenceQueue<Object> queue = new ReferenceQueue<>();
+        List<Reference<Object>> refs = new ArrayList<>();
+        for (int i = 0; i < COUNT; i++) {
+            refs.add(new SoftReference<>(new Object(), queue));
+            refs.add(new WeakReference<>(new Object(), queue));
+            refs.add(new PhantomReference<>(new Object(), queue));
+            new Finalizable();
+        }
+
+        // With SoftRefLRUPolicyMSPerMB=0, soft references not accessed since
+        // the previous GC are cleared, so the second GC clears them all.
+        System.gc();
+
+        int soft = 0;
+        int weak = 0;
+        int phantom = 0;
+        long deadline = System.currentTimeMillis() + TIMEOUT_MS;
+        while (soft + weak + phantom < 3 * COUNT) {
+            Reference<?> ref = queue.remove(100);
+            if (ref == null) {
+                if (System.currentTimeMillis() > deadline) {
+                    throw new RuntimeException("Timed out: soft " + soft + ", weak " + weak + ", phantom " + phantom);
+                }
+                System.gc();
+                continue;
+            }
+            if (ref instanceof SoftReference) {
+                soft++;
+            } else if (ref instanceof WeakReference) {
+                weak++;
+            } else {
+                phantom++;
+            }
+        }
+        check("soft", soft);
+        check("weak", weak);
+        check("phantom", phantom);
+
+        while (finalized.get() < COUNT) {
+            if (System.currentTimeMillis() > deadline) {
+                throw new RuntimeException("Timed out: finalized " + finalized.get());
+            }
+            System.gc();
+            System.runFinalization();
+        }
+        Reference.reachabilityFence(refs);
+    }
+
+    static void check(String kind, int count) {
+        if (count != COUNT) {
+            throw new RuntimeException(kind + ": " + count + " references enqueued, expected " + COUNT);
+        }
+    }
+}
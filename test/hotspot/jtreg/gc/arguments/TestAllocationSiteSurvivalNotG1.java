@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.arguments;
+
+/*
+ * @test TestAllocationSiteSurvivalNotG1
+ * @summary Check that AllocationSiteSurvivalSampleRate warns and is ignored
+ *          with collectors other than G1.
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @run driver gc.arguments.TestAllocationSiteSurvivalNotG1
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestAllocationSiteSurvivalNotG1 {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseSerialGC",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:AllocationSiteSurvivalSampleRate=1",
+            "-XX:+PrintFlagsFinal",
+            "-version");
+
+        output.shouldHaveExitValue(0);
+        output.shouldContain("AllocationSiteSurvivalSampleRate is only supported by G1, ignoring");
+        output.shouldMatch("uint AllocationSiteSurvivalSampleRate\\s+= 0 ");
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.epsilon;
+
+/**
+ * @test TestAllocationSiteHistogram
+ * @requires vm.gc.Epsilon
+ * @summary Epsilon attributes sampled TLAB refills to allocation sites
+ * @library /test/lib
+ * @run driver gc.epsilon.TestAllocationSiteHistogram
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestAllocationSiteHistogram {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseEpsilonGC",
+            "-Xmx256m",
+            "-XX:EpsilonAllocationSiteSampleRate=1",
+            "-Xlog:gc+alloc=info",
+            Alloc.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Allocation sites (");
+        output.shouldContain(Alloc.class.getName() + ".allocate");
+
+        // Sampling is off by default, and nothing is printed.
+        output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseEpsilonGC",
+            "-Xmx256m",
+            "-Xlog:gc+alloc=info",
+            Alloc.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("Allocation sites (");
+    }
+
+    static class Alloc {
+        static volatile Object sink;
+
+        static void allocate() {
+            for (int i = 0; i < 100_000; i++) {
+                sink = new byte[1024];
+            }
+        }
+
+        public static void main(String[] args) {
+            allocate();
+        }
+    }
+}
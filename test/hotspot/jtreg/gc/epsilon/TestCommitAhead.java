@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.epsilon;
+
+/**
+ * @test TestCommitAhead
+ * @requires vm.gc.Epsilon
+ * @summary Epsilon expands ahead of allocations up to, and not beyond, -Xmx
+ *
+ * @run main/othervm -Xms16m -Xmx256m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC
+ *                   -XX:EpsilonCommitAhead=32m
+ *                   gc.epsilon.TestCommitAhead
+ *
+ * @run main/othervm -Xms4m -Xmx32m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC
+ *                   -XX:EpsilonCommitAhead=64m
+ *                   gc.epsilon.TestCommitAhead
+ *
+ * @run main/othervm -Xms4m -Xmx32m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseEpsilonGC
+ *                   -XX:EpsilonCommitAhead=64m -XX:+AlwaysPreTouch
+ *                   gc.epsilon.TestCommitAhead
+ */
+
+public class TestCommitAhead {
+    static volatile Object sink;
+
+    public static void main(String[] args) {
+        Runtime rt = Runtime.getRuntime();
+        long max = rt.maxMemory();
+        long target = max * 3 / 4;
+        long allocated = 0;
+        long maxCommitted = 0;
+
+        while (allocated < target) {
+            sink = new byte[1024];
+            allocated += 1024;
+            long committed = rt.totalMemory();
+            if (committed > max) {
+                throw new IllegalStateException("Committed " + committed + " beyond max " + max);
+            }
+            maxCommitted = Math.max(maxCommitted, committed);
+        }
+
+        if (maxCommitted < target) {
+            throw new IllegalStateException("Committed " + maxCommitted + " below allocated " + target);
+        }
+    }
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/*
+ * @test TestAllocationSiteSurvival
+ * @summary Check that G1 tracks the survival of sampled allocation sites and
+ *          finds a site whose objects are all retained to be long-lived.
+ * @requires vm.gc.G1
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestAllocationSiteSurvival
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestAllocationSiteSurvival {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-XX:AllocationSiteSurvivalSampleRate=1",
+            "-XX:MaxTenuringThreshold=1",
+            "-XX:-ResizeTLAB",
+            "-XX:TLABSize=2k",
+            "-Xmx64m",
+            "-Xlog:gc+alloc=trace",
+            GCTest.class.getName());
+
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Allocation sites:");
+        output.shouldMatch("tenured \\(\\d+ of \\d+\\).*GCTest.retain");
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        public static ArrayList<byte[]> holder = new ArrayList<>();
+
+        static void retain() {
+            for (int i = 0; i < 4000; i++) {
+                holder.add(new byte[512]);
+            }
+        }
+
+        public static void main(String[] args) {
+            retain();
+            // The retained objects are copied to survivor in the first and
+            // tenured in the following young collections.
+            for (int i = 0; i < 3; i++) {
+                WB.youngGC();
+            }
+            System.out.println(holder.size());
+        }
+    }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestFullGCParallelCompaction
+ * @summary Check that parallel Full GC compaction with work stealing between
+ *          compaction queues keeps objects intact for skewed live data.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UseG1GC -Xmx128m -XX:G1HeapRegionSize=1m -XX:ParallelGCThreads=8
+ *                   -XX:+VerifyAfterGC -Xlog:gc+phases=trace
+ *                   gc.g1.TestFullGCParallelCompaction
+ */
+
+import java.util.ArrayList;
+import java.util.Random;
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestFullGCParallelCompaction {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    private static final int ARRAY_SIZE = 1024;
+    private static final int NUM_ARRAYS = 48 * 1024;
+
+    private static ArrayList<int[]> live = new ArrayList<>();
+
+    private static int[] newArray(int seed) {
+        int[] result = new int[ARRAY_SIZE];
+        for (int i = 0; i < result.length; i++) {
+            result[i] = seed + i;
+        }
+        return result;
+    }
+
+    public static void main(String[] args) {
+        Random random = new Random(42);
+        ArrayList<int[]> garbage = new ArrayList<>();
+
+        // Allocate so that live data is concentrated in a few parts of the heap,
+        // giving compaction queues very different amounts of work.
+        for (int i = 0; i < NUM_ARRAYS; i++) {
+            int[] array = newArray(i);
+            boolean dense = (i / 2048) % 4 == 0;
+            if (dense || random.nextInt(16) == 0) {
+                live.add(array);
+            } else {
+                garbage.add(array);
+            }
+            if (garbage.size() > 4096) {
+                garbage.clear();
+            }
+        }
+        garbage = null;
+
+        for (int gc = 0; gc < 3; gc++) {
+            WB.fullGC();
+            for (int[] array : live) {
+                int seed = array[0];
+                for (int j = 0; j < array.length; j++) {
+                    if (array[j] != seed + j) {
+                        throw new RuntimeException("Array with seed " + seed + " corrupted at index " + j);
+                    }
+                }
+            }
+            // Free part of the live data to make the next compaction move objects again.
+            ArrayList<int[]> remaining = new ArrayList<>();
+            for (int i = 0; i < live.size(); i++) {
+                if (i % 3 != 0) {
+                    remaining.add(live.get(i));
+                }
+            }
+            live = remaining;
+        }
+    }
+}
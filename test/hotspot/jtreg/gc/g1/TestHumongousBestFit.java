@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/*
+ * @test TestHumongousBestFit
+ * @summary Check that G1 can allocate and reclaim humongous objects of various
+ *          sizes with best-fit humongous placement.
+ * @requires vm.gc.G1
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+G1HumongousBestFit
+ *                   -XX:+UseG1GC -Xms64m -Xmx64m -XX:G1HeapRegionSize=1m
+ *                   -XX:+VerifyAfterGC -Xlog:gc
+ *                   gc.g1.TestHumongousBestFit
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestHumongousBestFit {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final int M = 1024 * 1024;
+
+    public static ArrayList<byte[]> holder = new ArrayList<>();
+
+    public static void main(String[] args) {
+        // Interleave humongous objects of different sizes, then free every
+        // other one to leave holes of different lengths behind.
+        int[] sizes = { 3 * M / 2, 5 * M / 2, M / 2 + 1, 7 * M / 2 };
+        for (int i = 0; i < 8; i++) {
+            holder.add(new byte[sizes[i % sizes.length]]);
+        }
+        for (int i = 0; i < holder.size(); i += 2) {
+            holder.set(i, null);
+        }
+        WB.fullGC();
+
+        // Refill the holes; every object must still be humongous and live.
+        for (int i = 0; i < holder.size(); i += 2) {
+            byte[] o = new byte[sizes[(i + 1) % sizes.length]];
+            if (!WB.g1IsHumongous(o)) {
+                throw new RuntimeException("Object of size " + o.length + " should be humongous");
+            }
+            holder.set(i, o);
+        }
+        WB.youngGC();
+
+        for (byte[] o : holder) {
+            if (o == null || !WB.g1IsHumongous(o)) {
+                throw new RuntimeException("Humongous object lost");
+            }
+        }
+    }
+}
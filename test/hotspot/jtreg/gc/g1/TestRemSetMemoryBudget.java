@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestRemSetMemoryBudget
+ * @summary Check that G1 enforces the remembered set memory budget after young
+ *          collections.
+ * @requires vm.gc.G1
+ * @modules java.base/jdk.internal.misc
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestRemSetMemoryBudget
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestRemSetMemoryBudget {
+
+    private static final String BUDGET_EXCEEDED = "Remembered set memory budget";
+
+    private static OutputAnalyzer run(long budget) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-XX:G1RemSetMemoryBudget=" + budget,
+            "-Xmx64m",
+            "-XX:G1HeapRegionSize=1m",
+            "-Xlog:gc+remset=debug",
+            GCTest.class.getName());
+
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Humongous type arrays always have a tracked remembered set, so even a
+        // tiny budget is exceeded.
+        run(1).shouldContain(BUDGET_EXCEEDED);
+        // The default does not limit remembered set memory.
+        run(0).shouldNotContain(BUDGET_EXCEEDED);
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        public static Object[] holder = new Object[16];
+
+        public static void main(String[] args) {
+            for (int i = 0; i < holder.length; i++) {
+                holder[i] = new byte[1024 * 1024];
+            }
+            for (int i = 0; i < 3; i++) {
+                WB.youngGC();
+            }
+            System.out.println(holder.length);
+        }
+    }
+}
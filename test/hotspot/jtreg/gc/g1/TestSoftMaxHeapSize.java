@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestSoftMaxHeapSize
+ * @summary Check that G1 keeps committed capacity and the IHOP target
+ *          occupancy within SoftMaxHeapSize, also after it is lowered at runtime.
+ * @requires vm.gc.G1
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestSoftMaxHeapSize
+ */
+
+import java.lang.management.ManagementFactory;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestSoftMaxHeapSize {
+    static final long M = 1024 * 1024;
+    static final long INITIAL_SOFT_MAX = 64 * M;
+    static final long LOWERED_SOFT_MAX = 32 * M;
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseG1GC",
+            "-XX:G1HeapRegionSize=1m",
+            "-Xms16m",
+            "-Xmx512m",
+            "-XX:SoftMaxHeapSize=" + INITIAL_SOFT_MAX,
+            "-Xlog:gc+ihop=debug",
+            GCTest.class.getName());
+        output.shouldHaveExitValue(0);
+
+        // Every IHOP target is within the initial soft limit, and the last
+        // one, after the limit has been lowered and the heap resized, within
+        // the lowered one.
+        Pattern p = Pattern.compile("Target occupancy update: old: \\d+B, new: (\\d+)B");
+        Matcher m = p.matcher(output.getStdout());
+        long last = -1;
+        while (m.find()) {
+            last = Long.parseLong(m.group(1));
+            if (last > INITIAL_SOFT_MAX) {
+                throw new RuntimeException("IHOP target " + last + " above " + INITIAL_SOFT_MAX);
+            }
+        }
+        if (last > LOWERED_SOFT_MAX) {
+            throw new RuntimeException("Final IHOP target " + last + " above " + LOWERED_SOFT_MAX);
+        }
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        static volatile Object sink;
+
+        static void allocate(int mb) {
+            for (int i = 0; i < mb * 1024; i++) {
+                sink = new byte[1024];
+            }
+        }
+
+        static void checkCommitted(long limit, String when) {
+            long committed = ManagementFactory.getMemoryMXBean().getHeapMemoryUsage().getCommitted();
+            if (committed > limit) {
+                throw new RuntimeException("Committed " + committed + " above " + limit + " after " + when);
+            }
+        }
+
+        public static void main(String[] args) throws Exception {
+            for (int i = 0; i < 10; i++) {
+                allocate(64);
+                WB.youngGC();
+                checkCommitted(INITIAL_SOFT_MAX, "young GC");
+            }
+            WB.fullGC();
+            checkCommitted(INITIAL_SOFT_MAX, "full GC");
+
+            new PidJcmdExecutor().execute("VM.set_flag SoftMaxHeapSize " + LOWERED_SOFT_MAX);
+
+            WB.fullGC();
+            checkCommitted(LOWERED_SOFT_MAX, "full GC with lowered limit");
+            for (int i = 0; i < 10; i++) {
+                allocate(64);
+                WB.youngGC();
+                checkCommitted(LOWERED_SOFT_MAX, "young GC with lowered limit");
+            }
+        }
+    }
+}
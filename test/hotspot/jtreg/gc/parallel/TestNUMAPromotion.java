@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.parallel;
+
+/*
+ * @test TestNUMAPromotion
+ * @summary Check that objects promoted into per-node old LABs with
+ *          PSNUMAPromotion stay intact.
+ * @requires vm.gc.Parallel
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseNUMA -Xmx256m -Xmn64m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+PSNUMAPromotion
+ *                   -XX:MaxTenuringThreshold=0
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   gc.parallel.TestNUMAPromotion
+ * @run main/othervm -XX:+UseParallelGC -XX:+UseNUMA -Xmx256m -Xmn64m
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+PSNUMAPromotion
+ *                   -XX:MaxTenuringThreshold=2
+ *                   gc.parallel.TestNUMAPromotion
+ */
+
+public class TestNUMAPromotion {
+    static final int THREADS = 4;
+    static final int RETAINED = 50_000;
+
+    static class Node {
+        final int id;
+        final byte[] payload;
+        Node next;
+
+        Node(int id) {
+            this.id = id;
+            this.payload = new byte[32 + id % 64];
+            this.payload[0] = (byte)id;
+        }
+    }
+
+    static volatile Object sink;
+
+    public static void main(String[] args) throws Exception {
+        // Several threads allocate, so that eden chunks of more than one
+        // node, if there are several, are promoted from.
+        Thread[] threads = new Thread[THREADS];
+        Throwable[] failure = new Throwable[1];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread(TestNUMAPromotion::work);
+            threads[t].setUncaughtExceptionHandler((th, e) -> failure[0] = e);
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (failure[0] != null) {
+            throw new RuntimeException(failure[0]);
+        }
+    }
+
+    static void work() {
+        Node[] retained = new Node[RETAINED];
+        for (int round = 0; round < 20; round++) {
+            for (int i = 0; i < RETAINED; i++) {
+                Node n = new Node(i);
+                n.next = (i > 0) ? retained[i - 1] : null;
+                retained[i] = n;
+                sink = new byte[256];
+            }
+            for (int i = 0; i < RETAINED; i++) {
+                Node n = retained[i];
+                if (n.id != i || n.payload.length != 32 + i % 64 || n.payload[0] != (byte)i) {
+                    throw new RuntimeException("Broken node " + i + " in round " + round);
+                }
+                if (i > 0 && n.next != retained[i - 1]) {
+                    throw new RuntimeException("Broken link at node " + i + " in round " + round);
+                }
+            }
+        }
+    }
+}
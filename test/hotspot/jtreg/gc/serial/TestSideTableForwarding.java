@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.serial;
+
+/*
+ * @test TestSideTableForwarding
+ * @summary Exercise Serial full GC with side-table forwarding on locked and
+ *          hashed objects, dead space fillers, and after promotion failure.
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.serial.TestSideTableForwarding 0
+ * @run driver gc.serial.TestSideTableForwarding 50
+ */
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryPoolMXBean;
+import java.util.ArrayList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestSideTableForwarding {
+
+    public static void main(String[] args) throws Exception {
+        String deadRatio = args[0];
+
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseSerialGC",
+            "-XX:+SerialFullGCSideTableForwarding",
+            "-XX:+VerifyBeforeGC",
+            "-XX:+VerifyAfterGC",
+            "-XX:MarkSweepDeadRatio=" + deadRatio,
+            // Only compact maximally when explicitly asked to, so that dead
+            // space fillers are used with a non-zero dead ratio.
+            "-XX:MarkSweepAlwaysCompactCount=1000",
+            "-XX:MaxTenuringThreshold=0",
+            "-Xms64m",
+            "-Xmx64m",
+            "-Xmn16m",
+            "-Xlog:gc,gc+promotion",
+            GCTest.class.getName());
+
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Pause Full");
+        output.shouldContain("Promotion failed");
+    }
+
+    static class GCTest {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        static final int NUM_HASHED = 10_000;
+
+        static Object[] hashed = new Object[NUM_HASHED];
+        static int[] hashes = new int[NUM_HASHED];
+        static ArrayList<Object> retained = new ArrayList<>();
+        static final Object waitLock = new Object();
+        static final Object holdLock = new Object();
+
+        static void checkHashes() {
+            for (int i = 0; i < NUM_HASHED; i++) {
+                if (System.identityHashCode(hashed[i]) != hashes[i]) {
+                    throw new RuntimeException("identity hash changed at " + i);
+                }
+            }
+        }
+
+        static MemoryPoolMXBean oldPool() {
+            for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+                if (pool.getName().equals("Tenured Gen")) {
+                    return pool;
+                }
+            }
+            throw new RuntimeException("no old generation pool");
+        }
+
+        public static void main(String[] args) throws Exception {
+            // Hashed objects, interleaved with garbage so they move.
+            ArrayList<Object> garbage = new ArrayList<>();
+            for (int i = 0; i < NUM_HASHED; i++) {
+                hashed[i] = new Object();
+                hashes[i] = System.identityHashCode(hashed[i]);
+                garbage.add(new byte[64]);
+            }
+
+            // An inflated monitor held by a waiting thread.
+            Thread waiter = new Thread(() -> {
+                synchronized (waitLock) {
+                    try {
+                        waitLock.wait();
+                    } catch (InterruptedException e) {
+                        throw new RuntimeException(e);
+                    }
+                }
+            });
+            synchronized (waitLock) {
+                waiter.start();
+            }
+
+            // Full GCs with holes in the heap, while holding a lock.
+            synchronized (holdLock) {
+                for (int i = 0; i < 5; i++) {
+                    for (int j = 0; j < 1000; j++) {
+                        Object o = new byte[128];
+                        if (j % 3 == 0) {
+                            retained.add(o);
+                        }
+                    }
+                    garbage = null;
+                    System.gc();
+                    checkHashes();
+                }
+            }
+
+            // Fill the old generation almost completely.
+            MemoryPoolMXBean old = oldPool();
+            long max = old.getUsage().getMax();
+            while (old.getUsage().getUsed() < max - 6 * 1024 * 1024) {
+                for (int i = 0; i < 1024; i++) {
+                    retained.add(new byte[1024]);
+                }
+                WB.youngGC();
+            }
+
+            // Young GCs with nothing to promote, so that the next attempt is
+            // considered safe by the promotion average.
+            for (int i = 0; i < 30; i++) {
+                WB.youngGC();
+            }
+
+            // Retain more than the old generation has room for, and fail promotion.
+            ArrayList<Object> young = new ArrayList<>();
+            for (int i = 0; i < 8 * 1024; i++) {
+                young.add(new byte[1024]);
+            }
+            synchronized (holdLock) {
+                WB.youngGC();
+            }
+            checkHashes();
+
+            // Free the old generation again and compact it.
+            retained.clear();
+            young = null;
+            WB.fullGC();
+            checkHashes();
+
+            synchronized (waitLock) {
+                waitLock.notify();
+            }
+            waiter.join();
+        }
+    }
+}
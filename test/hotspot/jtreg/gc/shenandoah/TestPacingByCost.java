@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.shenandoah;
+
+/*
+ * @test
+ * @summary Check that ShenandoahPacingByCost splits the pacing budget between
+ *          evacuation and update-refs by their measured cost
+ * @requires vm.gc.Shenandoah
+ * @library /test/lib
+ * @run driver gc.shenandoah.TestPacingByCost
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPacingByCost {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseShenandoahGC",
+            "-Xmx256m",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:ShenandoahGCHeuristics=aggressive",
+            "-XX:+ShenandoahPacing",
+            "-XX:+ShenandoahPacingByCost",
+            "-Xlog:gc+ergo",
+            Allocate.class.getName());
+        output.shouldHaveExitValue(0);
+
+        // The first cycles have no measured rates and split the budget in
+        // half. Later ones use the measured cost, within 10% and 90%.
+        Pattern p = Pattern.compile("Pacer for Evacuation\\..*Evac Share: (\\d+)%");
+        Matcher m = p.matcher(output.getStdout());
+        int cycles = 0;
+        boolean byCost = false;
+        while (m.find()) {
+            int share = Integer.parseInt(m.group(1));
+            if (share < 10 || share > 90) {
+                throw new RuntimeException("Evacuation share out of bounds: " + share + "%");
+            }
+            byCost |= (share != 50);
+            cycles++;
+        }
+        if (cycles < 5) {
+            throw new RuntimeException("Too few evacuations: " + cycles);
+        }
+        if (!byCost) {
+            throw new RuntimeException("Evacuation share never adjusted by cost");
+        }
+    }
+
+    static class Allocate {
+        static final int LIVE = 20_000;
+        static Object[] live = new Object[LIVE];
+        static volatile Object sink;
+
+        public static void main(String[] args) {
+            // Keep some live data in regions with garbage, so that every
+            // collection set has something to evacuate.
+            long end = System.nanoTime() + 5_000_000_000L;
+            for (int i = 0; System.nanoTime() < end; i++) {
+                live[i % LIVE] = new byte[256];
+                sink = new byte[1024];
+            }
+        }
+    }
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.shenandoah;
+
+/*
+ * @test id=aggressive
+ * @summary Check that references are updated correctly when update-refs
+ *          splits regions into chunks
+ * @requires vm.gc.Shenandoah
+ * @run main/othervm -Xmx512m -XX:+UseShenandoahGC
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:ShenandoahGCHeuristics=aggressive -XX:ShenandoahUpdateRefsChunkSize=64k
+ *                   -XX:+ShenandoahVerify
+ *                   gc.shenandoah.TestUpdateRefsChunkSize
+ */
+
+/*
+ * @test id=degenerated
+ * @summary Check that degenerated update-refs continues with chunked regions
+ * @requires vm.gc.Shenandoah
+ * @run main/othervm -Xmx512m -XX:+UseShenandoahGC
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:ShenandoahGCMode=passive -XX:+ShenandoahDegeneratedGC
+ *                   -XX:ShenandoahUpdateRefsChunkSize=64k -XX:+ShenandoahVerify
+ *                   gc.shenandoah.TestUpdateRefsChunkSize
+ */
+
+public class TestUpdateRefsChunkSize {
+    static final int NODES = 100_000;
+    // Humongous at any Shenandoah region size up to 32M, and larger than
+    // many chunks.
+    static final int LARGE = 16 * 1024 * 1024;
+
+    static class Node {
+        final int id;
+        Node next;
+        Node(int id) { this.id = id; }
+    }
+
+    static volatile Object sink;
+
+    public static void main(String[] args) {
+        Node[] nodes = new Node[NODES];
+        Object[] large = new Object[LARGE / 4];
+        for (int i = 0; i < NODES; i++) {
+            nodes[i] = new Node(i);
+            large[(int)((long)i * (large.length - 1) / NODES)] = nodes[i];
+        }
+        for (int i = 0; i < NODES; i++) {
+            nodes[i].next = nodes[(i + 1) % NODES];
+        }
+
+        for (int round = 0; round < 20; round++) {
+            // Garbage between the nodes makes the GC evacuate them, and
+            // update every reference to them afterwards.
+            for (int i = 0; i < 100_000; i++) {
+                sink = new byte[128];
+            }
+            for (int i = 0; i < NODES; i++) {
+                Node n = nodes[i];
+                if (n.id != i || n.next.id != (i + 1) % NODES) {
+                    throw new RuntimeException("Broken node " + i + " in round " + round);
+                }
+                if (large[(int)((long)i * (large.length - 1) / NODES)] != n) {
+                    throw new RuntimeException("Broken large array slot for node " + i + " in round " + round);
+                }
+                // Replace some nodes, so that live and dead objects mix.
+                if ((i + round) % 7 == 0) {
+                    Node m = new Node(i);
+                    m.next = n.next;
+                    nodes[(i + NODES - 1) % NODES].next = m;
+                    nodes[i] = m;
+                    large[(int)((long)i * (large.length - 1) / NODES)] = m;
+                }
+            }
+            System.gc();
+        }
+    }
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.z;
+
+/*
+ * @test TestPageCachePrepopulate
+ * @summary Check that ZPageCachePrepopulate fills the page cache while
+ *          the mutators allocate
+ * @requires vm.gc.ZGenerational
+ * @library /test/lib
+ * @run driver gc.z.TestPageCachePrepopulate
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestPageCachePrepopulate {
+    static final String PREPOPULATED = "Page Cache Prepopulated: ";
+
+    public static void main(String[] args) throws Exception {
+        run(false).shouldNotContain(PREPOPULATED);
+        run(true).shouldContain(PREPOPULATED);
+    }
+
+    static OutputAnalyzer run(boolean prepopulate) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseZGC",
+            "-XX:+ZGenerational",
+            "-Xms128M",
+            "-Xmx512M",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:" + (prepopulate ? "+" : "-") + "ZPageCachePrepopulate",
+            "-XX:ZPageCachePrepopulateInterval=10",
+            "-Xlog:gc+heap=debug",
+            Allocate.class.getName());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    static class Allocate {
+        static volatile Object sink;
+
+        public static void main(String[] args) {
+            // Allocate at a steady rate for a few seconds, so that the
+            // allocation rate is sampled and predicted.
+            long end = System.nanoTime() + 3_000_000_000L;
+            while (System.nanoTime() < end) {
+                for (int i = 0; i < 1024; i++) {
+                    sink = new byte[1024];
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Stress contended monitors with MonitorSpinAIMD, with both short
+ *          hold times, where spinning pays, and long ones, where it does not.
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+MonitorSpinAIMD MonitorSpinAIMDTest
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+MonitorSpinAIMD -XX:LockingMode=0 MonitorSpinAIMDTest
+ */
+
+public class MonitorSpinAIMDTest {
+    static final int THREADS = Math.max(4, Runtime.getRuntime().availableProcessors());
+    static final int ITERATIONS = 20_000;
+
+    static final Object shortLock = new Object();
+    static final Object longLock = new Object();
+    static long shortCount;
+    static long longCount;
+    static volatile long sink;
+
+    public static void main(String[] args) throws Exception {
+        Thread[] threads = new Thread[THREADS];
+        for (int t = 0; t < THREADS; t++) {
+            threads[t] = new Thread(MonitorSpinAIMDTest::contend);
+            threads[t].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+        long expected = (long)THREADS * ITERATIONS;
+        if (shortCount != expected) {
+            throw new RuntimeException("shortCount " + shortCount + " != " + expected);
+        }
+        if (longCount != expected / 100) {
+            throw new RuntimeException("longCount " + longCount + " != " + expected / 100);
+        }
+    }
+
+    static void contend() {
+        for (int i = 0; i < ITERATIONS; i++) {
+            synchronized (shortLock) {
+                shortCount++;
+            }
+            if (i % 100 == 0) {
+                // Held long enough that spinning on it fails and its spin
+                // duration is decreased.
+                synchronized (longLock) {
+                    longCount++;
+                    long s = 0;
+                    for (int j = 0; j < 100_000; j++) {
+                        s += j ^ s;
+                    }
+                    sink = s;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that NMT detail mode scales sampled malloc call sites
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:NativeMemoryTracking=detail
+ *                   -XX:NMTMallocSiteSampleInterval=16 MallocSiteSampling
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.JDKToolFinder;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class MallocSiteSampling {
+    private static final int COUNT = 20000;
+    private static final int SIZE = 128;
+
+    public static void main(String[] args) throws Exception {
+        WhiteBox wb = WhiteBox.getWhiteBox();
+        long[] addrs = new long[COUNT];
+        for (int i = 0; i < COUNT; i++) {
+            addrs[i] = wb.NMTMalloc(SIZE);
+        }
+
+        String pid = Long.toString(ProcessTools.getProcessId());
+        ProcessBuilder pb = new ProcessBuilder();
+        pb.command(new String[] { JDKToolFinder.getJDKTool("jcmd"), pid, "VM.native_memory", "detail", "scale=B"});
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Malloc call sites sampled once every 16 allocations");
+
+        // Only about one in 16 of the allocations above has its call stack
+        // recorded, the report scales the site back up to an estimate.
+        long count = 0;
+        long size = 0;
+        Pattern site = Pattern.compile("\\(malloc=(\\d+)B type=Test #(\\d+)\\)");
+        boolean inSite = false;
+        for (String line : output.asLines()) {
+            if (line.contains("WB_NMTMalloc")) {
+                inSite = true;
+            } else if (inSite) {
+                Matcher m = site.matcher(line);
+                if (m.find()) {
+                    size += Long.parseLong(m.group(1));
+                    count += Long.parseLong(m.group(2));
+                    inSite = false;
+                } else if (line.isBlank()) {
+                    inSite = false;
+                }
+            }
+        }
+        System.out.println("Estimated count: " + count + ", estimated size: " + size);
+        if (count < COUNT * 3 / 4 || count > COUNT * 5 / 4) {
+            throw new RuntimeException("Estimated count " + count + " too far from " + COUNT);
+        }
+        if (size != count * SIZE) {
+            throw new RuntimeException("Estimated size " + size + " does not match count " + count);
+        }
+
+        for (long addr : addrs) {
+            wb.NMTFree(addr);
+        }
+    }
+}
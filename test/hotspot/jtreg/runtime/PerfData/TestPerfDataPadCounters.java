@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that jvmstat reads the same counters, with correct values,
+ *          whether or not PerfDataPadCounters pads the entries.
+ * @modules jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run main/othervm -XX:+UsePerfData TestPerfDataPadCounters
+ * @run main/othervm -XX:+UsePerfData -XX:+UnlockExperimentalVMOptions -XX:+PerfDataPadCounters
+ *                   TestPerfDataPadCounters
+ */
+
+import java.util.List;
+
+import sun.jvmstat.monitor.Monitor;
+import sun.jvmstat.monitor.MonitoredHost;
+import sun.jvmstat.monitor.MonitoredVm;
+import sun.jvmstat.monitor.VmIdentifier;
+
+public class TestPerfDataPadCounters {
+
+    public static void main(String[] args) throws Exception {
+        long pid = ProcessHandle.current().pid();
+        MonitoredHost host = MonitoredHost.getMonitoredHost("localhost");
+        MonitoredVm vm = host.getMonitoredVm(new VmIdentifier("local://" + pid + "@localhost"));
+        try {
+            // Every entry must be found and decoded when walking the layout
+            List<Monitor> all = vm.findByPattern(".*");
+            if (all.size() < 100) {
+                throw new RuntimeException("Only " + all.size() + " counters found");
+            }
+            for (Monitor m : all) {
+                if (m.getValue() == null) {
+                    throw new RuntimeException("No value for " + m.getName());
+                }
+            }
+
+            String version = (String)vm.findByName("java.property.java.vm.version").getValue();
+            if (!version.equals(System.getProperty("java.vm.version"))) {
+                throw new RuntimeException("java.vm.version: " + version + " != " +
+                                           System.getProperty("java.vm.version"));
+            }
+
+            // Counters updated by the VM must be read from their live location
+            Monitor safepoints = vm.findByName("sun.rt.safepoints");
+            long before = ((Number)safepoints.getValue()).longValue();
+            System.gc();
+            long after = ((Number)safepoints.getValue()).longValue();
+            if (after <= before) {
+                throw new RuntimeException("sun.rt.safepoints did not increase: " + before + " -> " + after);
+            }
+        } finally {
+            host.detach(vm);
+        }
+    }
+}
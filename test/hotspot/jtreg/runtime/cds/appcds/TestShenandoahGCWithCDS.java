@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test TestShenandoahGCWithCDS
+ * @summary Heap objects archived with G1 are loaded when running with Shenandoah.
+ * @requires vm.cds.write.archived.java.heap
+ * @requires vm.gc.Shenandoah
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver TestShenandoahGCWithCDS false
+ * @run driver TestShenandoahGCWithCDS true
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestShenandoahGCWithCDS {
+    static final String ARCHIVED_STRING = "TestShenandoahGCWithCDS-archived-string";
+
+    public static void main(String[] args) throws Exception {
+        boolean verify = Boolean.parseBoolean(args[0]);
+        String archive = "TestShenandoahGCWithCDS-" + verify + ".jsa";
+
+        Path config = Path.of("TestShenandoahGCWithCDS-" + verify + ".txt");
+        Files.writeString(config,
+                          "VERSION: 1.0\n" +
+                          "@SECTION: String\n" +
+                          ARCHIVED_STRING.length() + ": " + ARCHIVED_STRING + "\n");
+
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseG1GC",
+            "-XX:+UseCompressedOops",
+            "-Xshare:dump",
+            "-XX:SharedArchiveFile=" + archive,
+            "-XX:SharedArchiveConfigFile=" + config,
+            "-Xlog:cds");
+        output.shouldHaveExitValue(0);
+
+        output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+UseShenandoahGC",
+            "-XX:ShenandoahRegionSize=1m",
+            "-XX:" + (verify ? "+" : "-") + "ShenandoahVerify",
+            "-XX:+UseCompressedOops",
+            "-Xmx256m",
+            "-Xshare:on",
+            "-XX:SharedArchiveFile=" + archive,
+            "-Xlog:cds",
+            Test.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Loaded heap");
+        output.shouldNotContain("Cannot use CDS heap data");
+    }
+
+    static class Test {
+        private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+        public static void main(String[] args) {
+            if (WB.areSharedStringsMapped()) {
+                throw new RuntimeException("Shenandoah must load, not map, the archived heap");
+            }
+            if (!WB.isSharedInternedString(ARCHIVED_STRING)) {
+                throw new RuntimeException("String is not from the loaded archive");
+            }
+            // Let the GC, and the verifier when enabled, walk the loaded objects.
+            for (int i = 0; i < 3; i++) {
+                System.gc();
+            }
+            if (!WB.isSharedInternedString(ARCHIVED_STRING)) {
+                throw new RuntimeException("Archived string lost after GC");
+            }
+        }
+    }
+}
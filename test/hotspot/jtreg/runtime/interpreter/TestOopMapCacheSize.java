@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Walk deep interpreted stacks at GC with a non-default
+ *          InterpreterOopMapCacheSize, both smaller and larger than
+ *          the default, so that the cache array is heap allocated
+ *          and entries are replaced.
+ * @run main/othervm -Xint -XX:+UnlockExperimentalVMOptions -XX:InterpreterOopMapCacheSize=8 TestOopMapCacheSize
+ * @run main/othervm -Xint -XX:+UnlockExperimentalVMOptions -XX:InterpreterOopMapCacheSize=1024
+ *                   TestOopMapCacheSize
+ */
+
+public class TestOopMapCacheSize {
+    static final int DEPTH = 60;
+    static final int ROUNDS = 20;
+
+    static volatile Object sink;
+
+    public static void main(String[] args) {
+        for (int round = 0; round < ROUNDS; round++) {
+            String s = "r" + round;
+            int len = a(DEPTH, s);
+            if (len != s.length() * (DEPTH + 1)) {
+                throw new RuntimeException("Wrong result " + len + " in round " + round);
+            }
+        }
+    }
+
+    // Each method keeps oops live in locals at a different bci when it
+    // recurses, so the bottom of the stack needs many distinct oop maps.
+
+    static int a(int depth, String s) {
+        Object[] box = new Object[] { s };
+        int r = (depth == 0) ? gc(s) : b(depth - 1, s);
+        return r + check(box, s);
+    }
+
+    static int b(int depth, String s) {
+        long pad = depth;
+        StringBuilder sb = new StringBuilder(s);
+        int r = (depth == 0) ? gc(s) : c(depth - 1, s);
+        return r + check(sb.toString(), s) + (int)(pad - depth);
+    }
+
+    static int c(int depth, String s) {
+        Integer boxed = Integer.valueOf(depth);
+        String t = s;
+        int r = (depth == 0) ? gc(t) : d(depth - 1, t);
+        return r + check(t, s) + (boxed.intValue() - depth);
+    }
+
+    static int d(int depth, String s) {
+        int[] ints = new int[depth + 1];
+        Object o = s;
+        int r = (depth == 0) ? gc(s) : a(depth - 1, s);
+        return r + check(o, s) + ints.length - (depth + 1);
+    }
+
+    static int gc(String s) {
+        for (int i = 0; i < 1000; i++) {
+            sink = new byte[1024];
+        }
+        System.gc();
+        return 0;
+    }
+
+    static int check(Object o, String s) {
+        String t = (o instanceof Object[] arr) ? (String)arr[0] : (String)o;
+        if (!t.equals(s)) {
+            throw new RuntimeException("Stale local: " + t + " != " + s);
+        }
+        return s.length();
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that -Xlog:async:stall does not drop messages when the
+ *          async log buffer overflows
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver AsyncLogStallTest
+ */
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class AsyncLogStallTest {
+    static final String DROPPED = "messages dropped due to async logging";
+
+    public static void main(String[] args) throws Exception {
+        // All trace logging at startup fills the smallest buffer many
+        // times over, so logsites have to stall for the AsyncLog Thread.
+        List<String> stalled = run("stall");
+        for (String line : stalled) {
+            if (line.contains(DROPPED)) {
+                throw new RuntimeException("Message dropped with -Xlog:async:stall: " + line);
+            }
+        }
+        if (stalled.size() < 10_000) {
+            throw new RuntimeException("Too few lines logged to overflow the buffer: " + stalled.size());
+        }
+
+        // The same run with the default policy is expected to drop.
+        List<String> dropped = run("drop");
+        long reports = dropped.stream().filter(l -> l.contains(DROPPED)).count();
+        System.out.println("Reports of dropped messages with -Xlog:async:drop: " + reports);
+    }
+
+    static List<String> run(String policy) throws Exception {
+        String logFile = "async-" + policy + ".log";
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xlog:async:" + policy,
+            "-XX:AsyncLogBufferSize=100K",
+            "-Xlog:all=trace:file=" + logFile,
+            "-version");
+        output.shouldHaveExitValue(0);
+        return Files.readAllLines(Path.of(logFile));
+    }
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that periodic native heap trims are skipped when less than
+ *          TrimNativeHeapMinFreeBytes could be returned, and are not otherwise.
+ * @requires os.family == "linux" & !vm.musl
+ * @library /test/lib
+ * @run driver TestTrimNativeMinFreeBytes
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTrimNativeMinFreeBytes {
+
+    static OutputAnalyzer run(String minFreeBytes) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+                "-XX:TrimNativeHeapInterval=100",
+                "-XX:+UnlockExperimentalVMOptions",
+                "-XX:TrimNativeHeapMinFreeBytes=" + minFreeBytes,
+                "-Xlog:trimnative=debug",
+                "-Xmx64m",
+                Sleeper.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Periodic native trim enabled");
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Far more than the C-heap could ever hold free: every trim is skipped.
+        OutputAnalyzer output = run("1T");
+        output.shouldContain("Periodic Trim skipped");
+        output.shouldNotMatch("Periodic Trim \\(\\d+\\)");
+
+        // Default: trims are never skipped.
+        output = run("0");
+        output.shouldMatch("Periodic Trim \\(\\d+\\)");
+        output.shouldNotContain("Periodic Trim skipped");
+    }
+
+    public static class Sleeper {
+        public static void main(String[] args) throws Exception {
+            Thread.sleep(2000);
+        }
+    }
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that GC.heap_dump to a named pipe writes a valid dump
+ * @requires os.family != "windows"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm HeapDumpFifoTest
+ * @run main/othervm HeapDumpFifoTest -parallel=4
+ */
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.hprof.HprofParser;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class HeapDumpFifoTest {
+    public static void main(String[] args) throws Exception {
+        String heapDumpArgs = args.length > 0 ? args[0] : "";
+
+        File fifo = new File("heap_dump_fifo." + ProcessHandle.current().pid());
+        File dump = new File(fifo.getName() + ".hprof");
+        fifo.delete();
+        dump.delete();
+
+        Process mkfifo = new ProcessBuilder("mkfifo", fifo.getAbsolutePath()).inheritIO().start();
+        if (mkfifo.waitFor() != 0) {
+            throw new RuntimeException("mkfifo failed");
+        }
+
+        // An unmounted virtual thread, whose stack trace is written after
+        // the heap segments.
+        Thread vthread = Thread.ofVirtual().start(LockSupport::park);
+
+        Thread reader = new Thread(() -> {
+            try (InputStream in = new FileInputStream(fifo);
+                 OutputStream out = new FileOutputStream(dump)) {
+                in.transferTo(out);
+            } catch (Exception e) {
+                throw new RuntimeException(e);
+            }
+        });
+        reader.start();
+
+        OutputAnalyzer output = new PidJcmdExecutor().execute(
+            "GC.heap_dump -overwrite " + heapDumpArgs + " " + fifo.getAbsolutePath());
+        output.shouldContain("Heap dump file created");
+        reader.join();
+
+        LockSupport.unpark(vthread);
+        vthread.join();
+
+        if (!dump.exists() || dump.length() == 0) {
+            throw new RuntimeException("No dump read from " + fifo);
+        }
+        HprofParser.parse(dump);
+
+        fifo.delete();
+        dump.delete();
+    }
+}
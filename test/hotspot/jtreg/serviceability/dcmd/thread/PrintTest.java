@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that Thread.print reports locked, blocked and waiting
+ *          threads the same at a safepoint and with -handshake
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm PrintTest
+ */
+
+import java.util.concurrent.CountDownLatch;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class PrintTest {
+    static final Object lock = new Object();
+    static final Object waitLock = new Object();
+    static final CountDownLatch release = new CountDownLatch(1);
+
+    static final String OBJECT = "<0x\\p{XDigit}+> \\(a java.lang.Object\\)";
+
+    public static void main(String[] args) throws Exception {
+        Thread owner = new Thread(() -> {
+            synchronized (lock) {
+                try {
+                    release.await();
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            }
+        }, "PrintTest-Owner");
+        Thread blocked = new Thread(() -> {
+            synchronized (lock) {
+                // Entered only after the owner is released.
+            }
+        }, "PrintTest-Blocked");
+        Thread waiter = new Thread(() -> {
+            synchronized (waitLock) {
+                try {
+                    waitLock.wait();
+                } catch (InterruptedException e) {
+                    throw new RuntimeException(e);
+                }
+            }
+        }, "PrintTest-Waiter");
+
+        owner.start();
+        while (!owner.getState().equals(Thread.State.WAITING)) {
+            Thread.sleep(10);
+        }
+        blocked.start();
+        waiter.start();
+        while (!blocked.getState().equals(Thread.State.BLOCKED) ||
+               !waiter.getState().equals(Thread.State.WAITING)) {
+            Thread.sleep(10);
+        }
+
+        check(new PidJcmdExecutor().execute("Thread.print"));
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.print -handshake");
+        output.shouldContain("threads printed one at a time");
+        check(output);
+
+        release.countDown();
+        synchronized (waitLock) {
+            waitLock.notify();
+        }
+        owner.join();
+        blocked.join();
+        waiter.join();
+    }
+
+    static void check(OutputAnalyzer output) {
+        output.shouldMatch("\"PrintTest-Owner\" .*");
+        output.shouldMatch("\\s+- locked " + OBJECT);
+        output.shouldMatch("\"PrintTest-Blocked\" .*");
+        output.shouldMatch("java.lang.Thread.State: BLOCKED \\(on object monitor\\)");
+        output.shouldMatch("\\s+- waiting to lock " + OBJECT);
+        output.shouldMatch("\"PrintTest-Waiter\" .*");
+        output.shouldMatch("\\s+- waiting on " + OBJECT);
+    }
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedFrame;
+import jdk.test.lib.Asserts;
+import jdk.test.lib.jfr.Events;
+import jdk.test.whitebox.WhiteBox;
+
+/**
+ * @test
+ * @summary Test that NativeMemoryAllocationSample events carry the size,
+ *          weight and memory type of the sampled os::malloc call
+ * @key jfr
+ * @requires vm.hasJFR
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:JfrNativeAllocationSampleInterval=64k
+ *                   jdk.jfr.event.runtime.TestNativeMemoryAllocationSampleEvent
+ */
+public class TestNativeMemoryAllocationSampleEvent {
+    private static final String EVENT_NAME = "jdk.NativeMemoryAllocationSample";
+    private static final long INTERVAL = 64 * 1024;
+    // Larger than the interval, so every call is sampled.
+    private static final long SIZE = 100 * 1024;
+    private static final int COUNT = 50;
+
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    public static void main(String[] args) throws Exception {
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME).withStackTrace();
+            recording.start();
+            allocate();
+            recording.stop();
+
+            int found = 0;
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            for (RecordedEvent event : events) {
+                System.out.println(event);
+                // Only the WhiteBox allocations use the Test memory type.
+                if (!"Test".equals(event.getValue("type.name"))) {
+                    continue;
+                }
+                found++;
+                long size = event.getLong("size");
+                long weight = event.getLong("weight");
+                Asserts.assertEquals(size, SIZE, "Wrong sampled size");
+                // The weight includes the bytes the thread allocated since its
+                // previous sample, which are always fewer than the interval.
+                Asserts.assertGreaterThanOrEqual(weight, SIZE, "Weight smaller than the sample");
+                Asserts.assertLessThan(weight, SIZE + INTERVAL, "Weight spans more than one interval");
+                Asserts.assertTrue(isFromAllocate(event), "Missing allocate() in stack trace");
+                Asserts.assertEquals(event.getThread().getJavaName(), Thread.currentThread().getName(), "Wrong thread");
+            }
+            Asserts.assertEquals(found, COUNT, "Every Test allocation above the interval should be sampled");
+        }
+    }
+
+    private static void allocate() {
+        for (int i = 0; i < COUNT; i++) {
+            long addr = WB.NMTMalloc(SIZE);
+            Asserts.assertNotEquals(addr, 0L, "NMTMalloc failed");
+            WB.NMTFree(addr);
+        }
+    }
+
+    private static boolean isFromAllocate(RecordedEvent event) {
+        if (event.getStackTrace() == null) {
+            return false;
+        }
+        for (RecordedFrame frame : event.getStackTrace().getFrames()) {
+            if (frame.getMethod().getName().equals("allocate")
+                && frame.getMethod().getType().getName().equals(TestNativeMemoryAllocationSampleEvent.class.getName())) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Throughput of C1 tier 3 code for a loop nest with more live values than
+ * registers. The values used only outside the inner loop are the ones
+ * worth spilling, see -XX:+LinearScanLoopSpillCost.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = {"-XX:TieredStopAtLevel=3"})
+public class C1LoopSpillCost {
+
+    @Param({"1024"})
+    public int size;
+
+    int[] a;
+    int[] b;
+
+    @Setup
+    public void setup() {
+        a = new int[size];
+        b = new int[size];
+        for (int i = 0; i < size; i++) {
+            a[i] = i * 31;
+            b[i] = i ^ 0x5a5a;
+        }
+    }
+
+    @Benchmark
+    public int loopNest() {
+        int[] a = this.a;
+        int[] b = this.b;
+        int o0 = 1, o1 = 2, o2 = 3, o3 = 4, o4 = 5, o5 = 6, o6 = 7, o7 = 8;
+        int s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+        for (int j = 0; j < 16; j++) {
+            for (int i = 0; i < a.length; i++) {
+                int x = a[i];
+                int y = b[i];
+                s0 += x * y;
+                s1 ^= x + y;
+                s2 += x >>> 3;
+                s3 -= y << 1;
+            }
+            o0 += s0; o1 ^= s1; o2 += s2; o3 -= s3;
+            o4 += o0; o5 ^= o1; o6 += o2; o7 -= o3;
+        }
+        return o0 + o1 + o2 + o3 + o4 + o5 + o6 + o7 + s0 + s1 + s2 + s3;
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:TieredStopAtLevel=3",
+                                      "-XX:+UnlockExperimentalVMOptions",
+                                      "-XX:+LinearScanLoopSpillCost"})
+    public static class LoopSpillCost extends C1LoopSpillCost {}
+}
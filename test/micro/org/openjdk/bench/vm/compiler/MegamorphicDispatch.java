@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OperationsPerInvocation;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Interface and virtual dispatch at call sites that see one, two and many
+ * receiver types. The receivers are shuffled so that the megamorphic call
+ * sites cannot be predicted from their order.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Fork(value = 3)
+public class MegamorphicDispatch {
+
+    interface I { int m(); }
+
+    static abstract class A implements I { public abstract int v(); }
+
+    static class C0 extends A { public int m() { return 0; } public int v() { return 0; } }
+    static class C1 extends A { public int m() { return 1; } public int v() { return 1; } }
+    static class C2 extends A { public int m() { return 2; } public int v() { return 2; } }
+    static class C3 extends A { public int m() { return 3; } public int v() { return 3; } }
+    static class C4 extends A { public int m() { return 4; } public int v() { return 4; } }
+    static class C5 extends A { public int m() { return 5; } public int v() { return 5; } }
+    static class C6 extends A { public int m() { return 6; } public int v() { return 6; } }
+    static class C7 extends A { public int m() { return 7; } public int v() { return 7; } }
+
+    static final int COUNT = 1024;
+
+    A[] mono;
+    A[] bi;
+    A[] mega;
+
+    @Setup
+    public void setup() {
+        A[] all = { new C0(), new C1(), new C2(), new C3(), new C4(), new C5(), new C6(), new C7() };
+        java.util.Random r = new java.util.Random(42);
+        mono = new A[COUNT];
+        bi = new A[COUNT];
+        mega = new A[COUNT];
+        for (int i = 0; i < COUNT; i++) {
+            mono[i] = all[0];
+            bi[i] = all[r.nextInt(2)];
+            mega[i] = all[r.nextInt(all.length)];
+        }
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(COUNT)
+    public int interfaceMonomorphic() {
+        int sum = 0;
+        for (I i : mono) {
+            sum += i.m();
+        }
+        return sum;
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(COUNT)
+    public int interfaceBimorphic() {
+        int sum = 0;
+        for (I i : bi) {
+            sum += i.m();
+        }
+        return sum;
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(COUNT)
+    public int interfaceMegamorphic() {
+        int sum = 0;
+        for (I i : mega) {
+            sum += i.m();
+        }
+        return sum;
+    }
+
+    @Benchmark
+    @OperationsPerInvocation(COUNT)
+    public int virtualMegamorphic() {
+        int sum = 0;
+        for (A a : mega) {
+            sum += a.v();
+        }
+        return sum;
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.lang.invoke.MethodHandles;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Defining, linking and initializing a class. Each invocation defines the
+ * same class bytes in a fresh class loader, so every class goes through
+ * parsing, verification and linking once.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Fork(value = 3, jvmArgsAppend = { "-Xms1g", "-Xmx1g" })
+public class ClassLoading {
+
+    public static class Loadee {
+        static int counter;
+        int f;
+        static { counter = 1; }
+        public int m(int x) { return x + f + counter; }
+        public Loadee() { f = 42; }
+    }
+
+    static final class OneShotLoader extends ClassLoader {
+        OneShotLoader() {
+            super(ClassLoading.class.getClassLoader());
+        }
+
+        Class<?> define(String name, byte[] bytes) {
+            return defineClass(name, bytes, 0, bytes.length);
+        }
+    }
+
+    byte[] bytes;
+    String name;
+
+    @Setup
+    public void setup() throws IOException {
+        name = Loadee.class.getName();
+        String resource = name.substring(name.lastIndexOf('.') + 1) + ".class";
+        try (InputStream in = ClassLoading.class.getResourceAsStream(resource)) {
+            bytes = in.readAllBytes();
+        }
+    }
+
+    @Benchmark
+    public Class<?> define() {
+        return new OneShotLoader().define(name, bytes);
+    }
+
+    @Benchmark
+    public Object defineLinkAndInitialize() throws ReflectiveOperationException {
+        Class<?> c = new OneShotLoader().define(name, bytes);
+        return c.getConstructor().newInstance();
+    }
+
+    @Benchmark
+    public Class<?> defineHidden() throws IllegalAccessException {
+        return MethodHandles.lookup().defineHiddenClass(bytes, true).lookupClass();
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.CompilerControl;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Exception throw and catch, with and without a stack trace being filled
+ * in, unwinding a given number of compiled frames that are kept out of
+ * line so the throw cannot be turned into a local branch.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@Warmup(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@Measurement(iterations = 5, time = 1, timeUnit = TimeUnit.SECONDS)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Fork(value = 3)
+public class ExceptionThrow {
+
+    static class NoStackTrace extends RuntimeException {
+        NoStackTrace() {
+            super(null, null, false, false);
+        }
+    }
+
+    static final NoStackTrace PREALLOCATED = new NoStackTrace();
+
+    @Param({"1", "16"})
+    public int depth;
+
+    @CompilerControl(CompilerControl.Mode.DONT_INLINE)
+    private static int thrower(int d, int mode) {
+        if (d > 1) {
+            return thrower(d - 1, mode) + 1;
+        }
+        switch (mode) {
+            case 0:  throw new RuntimeException();
+            case 1:  throw new NoStackTrace();
+            default: throw PREALLOCATED;
+        }
+    }
+
+    private int run(int mode) {
+        try {
+            return thrower(depth, mode);
+        } catch (RuntimeException e) {
+            return e.hashCode();
+        }
+    }
+
+    @Benchmark
+    public int throwWithStackTrace() {
+        return run(0);
+    }
+
+    @Benchmark
+    public int throwWithoutStackTrace() {
+        return run(1);
+    }
+
+    @Benchmark
+    public int throwPreallocated() {
+        return run(2);
+    }
+}